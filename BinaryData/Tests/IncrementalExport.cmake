@@ -0,0 +1,51 @@
+# Exports the results of a folder of audio files incrementally twice to the same directory, checks that a file of the
+# directory that has not been exported is preserved, that the second processing doesn't analyze the tracks again and
+# compares an exported file with the expected results.
+file(REMOVE_RECURSE ${INPUT_DIR} ${OUTPUT_DIR})
+file(MAKE_DIRECTORY ${INPUT_DIR} ${OUTPUT_DIR})
+file(COPY ${INPUT} DESTINATION ${INPUT_DIR})
+file(WRITE ${OUTPUT_DIR}/${EXPORTED_FILE_NAME}.json "foreign")
+
+foreach(INDEX 1 2)
+  execute_process(
+      COMMAND ${PARTIELS} --export --input=${INPUT_DIR} --template=${TEMPLATE} --output=${OUTPUT_DIR} --format=json --incremental --jobs=1 --summary=${INPUT_DIR}/Summary${INDEX}.json
+      OUTPUT_VARIABLE EXPORT_OUT_VAR
+      ERROR_VARIABLE EXPORT_ERR_VAR
+      RESULT_VARIABLE EXPORT_RES_VAR
+  )
+  if(NOT EXPORT_RES_VAR EQUAL 0)
+    message(FATAL_ERROR "❌ The incremental export ${INDEX} failed (${EXPORT_RES_VAR}): ${EXPORT_OUT_VAR} ${EXPORT_ERR_VAR}")
+  endif()
+endforeach()
+
+file(READ ${OUTPUT_DIR}/${EXPORTED_FILE_NAME}.json FOREIGN_CONTENT)
+if(NOT FOREIGN_CONTENT STREQUAL "foreign")
+  message(FATAL_ERROR "❌ The file that has not been exported has been replaced")
+endif()
+
+if(EXISTS "${OUTPUT_DIR}/${EXPORTED_FILE_NAME} (3).json")
+  message(FATAL_ERROR "❌ The second incremental export has not reused the file of the first export")
+endif()
+
+file(READ ${INPUT_DIR}/Summary1.json SUMMARY1_CONTENT)
+if(NOT SUMMARY1_CONTENT MATCHES "\"upToDate\": 0")
+  message(FATAL_ERROR "❌ The first incremental export has not analyzed the tracks: ${SUMMARY1_CONTENT}")
+endif()
+
+file(READ ${INPUT_DIR}/Summary2.json SUMMARY2_CONTENT)
+if(NOT SUMMARY2_CONTENT MATCHES "\"upToDate\": ${NUM_UP_TO_DATE}")
+  message(FATAL_ERROR "❌ The second incremental export has analyzed the tracks again: ${SUMMARY2_CONTENT}")
+endif()
+
+execute_process(
+    COMMAND ${PARTIELS} --compare-files ${EXPECTED_FILE} "${OUTPUT_DIR}/${EXPORTED_FILE_NAME} (2).json"
+    OUTPUT_VARIABLE COMPARE_OUT_VAR
+    ERROR_VARIABLE COMPARE_ERR_VAR
+    RESULT_VARIABLE COMPARE_RES_VAR
+)
+
+if(NOT COMPARE_RES_VAR EQUAL 0)
+  message(FATAL_ERROR "❌ The exported file is different from the expected file: ${COMPARE_OUT_VAR} ${COMPARE_ERR_VAR}")
+else()
+  message(STATUS "✅ The second incremental export skipped the up-to-date tracks and the exported file matches the expected file")
+endif()
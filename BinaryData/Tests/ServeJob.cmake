@@ -0,0 +1,42 @@
+# Runs the service with a job read from a file, checks that the job succeeded and compares an exported file
+# with the expected results.
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+set(JOB_FILE ${OUTPUT_DIR}/job.ndjson)
+file(WRITE ${JOB_FILE} "{\"id\":\"serve\",\"input\":\"${INPUT}\",\"template\":\"${TEMPLATE}\",\"output\":\"${OUTPUT_DIR}\",\"format\":\"json\"}\n")
+
+execute_process(
+    COMMAND ${PARTIELS} --serve --jobs=1
+    INPUT_FILE ${JOB_FILE}
+    OUTPUT_VARIABLE SERVE_OUT_VAR
+    ERROR_VARIABLE SERVE_ERR_VAR
+    RESULT_VARIABLE SERVE_RES_VAR
+)
+
+if(NOT SERVE_RES_VAR EQUAL 0)
+  message(FATAL_ERROR "❌ The service failed (${SERVE_RES_VAR}): ${SERVE_OUT_VAR} ${SERVE_ERR_VAR}")
+endif()
+
+if(NOT SERVE_OUT_VAR MATCHES "\"id\":\"serve\",\"status\":\"queued\"")
+  message(FATAL_ERROR "❌ The job has not been queued: ${SERVE_OUT_VAR}")
+endif()
+
+if(NOT SERVE_OUT_VAR MATCHES "\"status\":\"succeeded\"")
+  message(FATAL_ERROR "❌ The job has not succeeded: ${SERVE_OUT_VAR}")
+endif()
+
+if(NOT SERVE_OUT_VAR MATCHES "${EXPORTED_FILE_NAME}")
+  message(FATAL_ERROR "❌ The exported file is not reported: ${SERVE_OUT_VAR}")
+endif()
+
+execute_process(
+    COMMAND ${PARTIELS} --compare-files ${EXPECTED_FILE} ${OUTPUT_DIR}/${EXPORTED_FILE_NAME}
+    OUTPUT_VARIABLE COMPARE_OUT_VAR
+    ERROR_VARIABLE COMPARE_ERR_VAR
+    RESULT_VARIABLE COMPARE_RES_VAR
+)
+
+if(NOT COMPARE_RES_VAR EQUAL 0)
+  message(FATAL_ERROR "❌ The exported file is different from the expected file: ${COMPARE_OUT_VAR} ${COMPARE_ERR_VAR}")
+else()
+  message(STATUS "✅ The job succeeded and the exported file matches the expected file")
+endif()
@@ -29,6 +29,9 @@ Application::AudioReader::AudioReader()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
             case AttrType::routingMatrix:
             {
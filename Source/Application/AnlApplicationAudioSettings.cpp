@@ -173,6 +173,9 @@ Application::AudioSettingsContent::AudioSettingsContent()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
             case AttrType::routingMatrix:
             {
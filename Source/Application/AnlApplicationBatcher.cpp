@@ -5,22 +5,31 @@
 ANALYSE_FILE_BEGIN
 
 Application::BatcherContent::BatcherContent()
-: mDocumentDirector(mDocumentAccessor, Instance::get().getAudioFormatManager(), mUndoManager)
-, mAudioFileLayoutTable(Instance::get().getAudioFormatManager(), AudioFileLayoutTable::SupportMode::channelLayoutAll | AudioFileLayoutTable::SupportMode::channelLayoutMono | AudioFileLayoutTable::SupportMode::multipleSampleRates, AudioFileLayout::ChannelLayout::all)
+: mAudioFileLayoutTable(Instance::get().getAudioFormatManager(), AudioFileLayoutTable::SupportMode::channelLayoutAll | AudioFileLayoutTable::SupportMode::channelLayoutMono | AudioFileLayoutTable::SupportMode::multipleSampleRates, AudioFileLayout::ChannelLayout::all)
 , mExporterPanel(Instance::get().getDocumentAccessor(), false, true)
 , mPropertyAdaptationToSampleRate(juce::translate("Adapt to Sample Rate"), juce::translate("Adapt the block size and the step size of the analyzes to the sample rate"), [](bool state)
                                   {
                                       auto& acsr = Instance::get().getApplicationAccessor();
                                       acsr.setAttr<AttrType::adaptationToSampleRate>(state, NotificationType::synchronous);
                                   })
+, mPropertyNumJobs(juce::translate("Concurrent Files"), juce::translate("The number of audio files analyzed and exported at the same time"), "", {1.0, 256.0}, 1.0, [](double value)
+                   {
+                       auto& acsr = Instance::get().getApplicationAccessor();
+                       acsr.setAttr<AttrType::batchNumJobs>(static_cast<int>(value), NotificationType::synchronous);
+                   })
+, mPropertyIncremental(juce::translate("Incremental Processing"), juce::translate("Skip the tracks and the groups whose results are up-to-date in the output folder"), [](bool state)
+                       {
+                           auto& acsr = Instance::get().getApplicationAccessor();
+                           acsr.setAttr<AttrType::batchIncremental>(state, NotificationType::synchronous);
+                       })
 , mPropertyExport(juce::translate("Process"), juce::translate("Process the files"), [this]()
                   {
-                      if(mProcess.valid())
+                      if(mBatcher != nullptr && mBatcher->isRunning())
                       {
-                          mShoulAbort.store(true);
                           mPropertyExport.entry.setButtonText(juce::translate("Aborting..."));
                           mPropertyExport.entry.setTooltip(juce::translate("Batch processing aborting..."));
                           mAudioFileLayoutTable.onLayoutChanged();
+                          mBatcher->abort();
                       }
                       else
                       {
@@ -64,6 +73,7 @@ Application::BatcherContent::BatcherContent()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::compactConsolidation:
                 break;
             case AttrType::exportOptions:
             {
@@ -78,6 +88,16 @@ Application::BatcherContent::BatcherContent()
                 mPropertyAdaptationToSampleRate.entry.setToggleState(acsr.getAttr<AttrType::adaptationToSampleRate>(), juce::NotificationType::dontSendNotification);
             }
             break;
+            case AttrType::batchNumJobs:
+            {
+                mPropertyNumJobs.entry.setValue(static_cast<double>(acsr.getAttr<AttrType::batchNumJobs>()), juce::NotificationType::dontSendNotification);
+            }
+            break;
+            case AttrType::batchIncremental:
+            {
+                mPropertyIncremental.entry.setToggleState(acsr.getAttr<AttrType::batchIncremental>(), juce::NotificationType::dontSendNotification);
+            }
+            break;
         }
     };
 
@@ -95,6 +115,8 @@ Application::BatcherContent::BatcherContent()
     addAndMakeVisible(mExporterPanel);
     addAndMakeVisible(mPropertyExport);
     addAndMakeVisible(mPropertyAdaptationToSampleRate);
+    addAndMakeVisible(mPropertyNumJobs);
+    addAndMakeVisible(mPropertyIncremental);
     addAndMakeVisible(mLoadingIcon);
     setSize(300, 200);
 }
@@ -114,33 +136,67 @@ void Application::BatcherContent::resized()
     mSeparator.setBounds(bounds.removeFromTop(1));
     mExporterPanel.setBounds(bounds.removeFromTop(mExporterPanel.getHeight()));
     mPropertyAdaptationToSampleRate.setBounds(bounds.removeFromTop(mPropertyAdaptationToSampleRate.getHeight()));
+    mPropertyNumJobs.setBounds(bounds.removeFromTop(mPropertyNumJobs.getHeight()));
+    mPropertyIncremental.setBounds(bounds.removeFromTop(mPropertyIncremental.getHeight()));
     mPropertyExport.setBounds(bounds.removeFromTop(mPropertyExport.getHeight()));
     mLoadingIcon.setBounds(bounds.removeFromTop(22).withSizeKeepingCentre(22, 22));
     setSize(bounds.getWidth(), bounds.getY() + 2);
 }
 
-void Application::BatcherContent::handleAsyncUpdate()
+void Application::BatcherContent::showReports(size_t numFiles)
 {
     mAudioFileLayoutTable.setEnabled(true);
     mExporterPanel.setEnabled(true);
     mPropertyAdaptationToSampleRate.setEnabled(true);
+    mPropertyNumJobs.setEnabled(true);
+    mPropertyIncremental.setEnabled(true);
     mAudioFileLayoutTable.onLayoutChanged();
 
-    mShoulAbort.store(false);
     mPropertyExport.entry.setButtonText(juce::translate("Process"));
     mPropertyExport.entry.setTooltip(juce::translate("Launch the batch processing."));
 
     mLoadingIcon.setActive(false);
     juce::MouseCursor::hideWaitCursor();
-    MiscWeakAssert(mProcess.valid());
-    if(!mProcess.valid())
+    MiscWeakAssert(mBatcher != nullptr);
+    if(mBatcher == nullptr)
     {
         return;
     }
-    mDocumentDirector.setAlertCatcher(nullptr);
-    auto const result = mProcess.get();
-    auto message = std::get<2>(result);
-    auto const alertMessages = mAlertCatcher.getMessages();
+
+    auto const& reports = mBatcher->getReports();
+    std::map<AlertWindow::Catcher::entry_t, juce::StringArray> alertMessages;
+    juce::StringArray failures;
+    auto numUpToDate = 0_z;
+    for(auto const& report : reports)
+    {
+        numUpToDate += report.numUpToDate;
+        if(report.result.failed())
+        {
+            failures.add(report.reader.front().file.getFileName() + ": " + report.result.getErrorMessage());
+        }
+        for(auto const& alertMessage : report.messages)
+        {
+            alertMessages[alertMessage.first].addArray(alertMessage.second);
+        }
+    }
+
+    // The files that have not been processed because of an abortion are also considered as failed
+    auto const numSucceeded = reports.size() - static_cast<size_t>(failures.size());
+    auto const succeeded = numSucceeded == numFiles;
+    auto message = succeeded ? juce::translate("The files have been successfully exported to DIRNAME.").replace("DIRNAME", mOutputDirectory.getFullPathName()) : juce::translate("NUMFAILED of NUMFILES files could not be processed:").replace("NUMFAILED", juce::String(numFiles - numSucceeded)).replace("NUMFILES", juce::String(numFiles));
+    if(numUpToDate > 0_z)
+    {
+        message += "\n" + juce::translate("NUMUPTODATE results were up-to-date and have not been processed again.").replace("NUMUPTODATE", juce::String(numUpToDate));
+    }
+    static constexpr auto maxFailures = 20;
+    for(auto index = 0; index < std::min(failures.size(), maxFailures); ++index)
+    {
+        message += "\n" + failures[index];
+    }
+    if(failures.size() > maxFailures)
+    {
+        message += "\n" + juce::translate("And NUMFAILED more...").replace("NUMFAILED", juce::String(failures.size() - maxFailures));
+    }
     if(!alertMessages.empty())
     {
         message += "\n\n" + juce::translate("Alert messages have been generated during the batch processing:");
@@ -153,8 +209,8 @@ void Application::BatcherContent::handleAsyncUpdate()
         message += alertMessage.second.joinIntoString(" - ");
     }
     auto const options = juce::MessageBoxOptions()
-                             .withIconType(static_cast<juce::AlertWindow::AlertIconType>(std::get<0>(result)))
-                             .withTitle(std::get<1>(result))
+                             .withIconType(succeeded ? juce::AlertWindow::AlertIconType::InfoIcon : juce::AlertWindow::AlertIconType::WarningIcon)
+                             .withTitle(succeeded ? juce::translate("Batch processing succeeded!") : juce::translate("Batch processing failed!"))
                              .withMessage(message)
                              .withButton(juce::translate("Ok"));
     juce::AlertWindow::showAsync(options, nullptr);
@@ -162,8 +218,8 @@ void Application::BatcherContent::handleAsyncUpdate()
 
 void Application::BatcherContent::process()
 {
-    MiscWeakAssert(!mProcess.valid());
-    if(mProcess.valid())
+    MiscWeakAssert(mBatcher == nullptr || !mBatcher->isRunning());
+    if(mBatcher != nullptr && mBatcher->isRunning())
     {
         return;
     }
@@ -183,7 +239,6 @@ void Application::BatcherContent::process()
     using Flags = juce::FileBrowserComponent::FileChooserFlags;
     mFileChooser->launchAsync(Flags::openMode | Flags::canSelectDirectories, [=, this](juce::FileChooser const& fileChooser)
                               {
-                                  auto copyAcsr = std::make_unique<Document::Accessor>();
                                   auto const files = fileChooser.getResults();
                                   if(files.isEmpty())
                                   {
@@ -197,17 +252,21 @@ void Application::BatcherContent::process()
                                   mAudioFileLayoutTable.setEnabled(false);
                                   mExporterPanel.setEnabled(false);
                                   mPropertyAdaptationToSampleRate.setEnabled(false);
+                                  mPropertyNumJobs.setEnabled(false);
+                                  mPropertyIncremental.setEnabled(false);
                                   mPropertyExport.entry.setButtonText(juce::translate("Abort"));
                                   mPropertyExport.entry.setTooltip(juce::translate("Abort the batch processing."));
 
-                                  mShoulAbort.store(false);
-
-                                  auto const adaptationToSampleRate = Instance::get().getApplicationAccessor().getAttr<AttrType::adaptationToSampleRate>();
-                                  auto const originalSampleRate = Instance::get().getDocumentAccessor().getAttr<Document::AttrType::samplerate>();
+                                  auto const& applicationAcsr = Instance::get().getApplicationAccessor();
+                                  auto const adaptationToSampleRate = applicationAcsr.getAttr<AttrType::adaptationToSampleRate>();
+                                  auto const numJobs = static_cast<size_t>(std::max(applicationAcsr.getAttr<AttrType::batchNumJobs>(), 1));
+                                  auto const incremental = applicationAcsr.getAttr<AttrType::batchIncremental>();
 
-                                  copyAcsr->copyFrom(Instance::get().getDocumentAccessor(), NotificationType::synchronous);
-                                  copyAcsr->setAttr<Document::AttrType::reader>(std::vector<AudioFileLayout>{}, NotificationType::synchronous);
-                                  for(auto const& acsr : copyAcsr->getAcsrs<Document::AcsrType::tracks>())
+                                  // Each file is processed in its own document created from a copy of the current document
+                                  Document::Accessor templateAcsr;
+                                  templateAcsr.copyFrom(Instance::get().getDocumentAccessor(), NotificationType::synchronous);
+                                  templateAcsr.setAttr<Document::AttrType::reader>(std::vector<AudioFileLayout>{}, NotificationType::synchronous);
+                                  for(auto const& acsr : templateAcsr.getAcsrs<Document::AcsrType::tracks>())
                                   {
                                       auto const resultFile = acsr.get().getAttr<Track::AttrType::file>().file;
                                       if(resultFile.hasFileExtension("dat"))
@@ -215,81 +274,28 @@ void Application::BatcherContent::process()
                                           acsr.get().setAttr<Track::AttrType::file>(Track::FileInfo{}, NotificationType::synchronous);
                                       }
                                   }
-                                  mAlertCatcher.clearMessages();
-                                  mDocumentDirector.setAlertCatcher(&mAlertCatcher);
-
-                                  mProcess = std::async([=, cAcsr = std::move(copyAcsr), this]() -> ProcessResult
-                                                        {
-                                                            juce::Thread::setCurrentThreadName("Batch");
-                                                            juce::MessageManager::Lock lock;
-
-                                                            for(auto const& layout : layouts)
-                                                            {
-                                                                if(!lock.tryEnter())
-                                                                {
-                                                                    triggerAsyncUpdate();
-                                                                    return std::make_tuple(AlertWindow::MessageType::warning, juce::translate("Batch processing failed!"), "Message manager could be unlocked!");
-                                                                }
-
-                                                                mDocumentAccessor.copyFrom({}, NotificationType::synchronous);
-                                                                mDocumentAccessor.setAttr<Document::AttrType::reader>({layout}, NotificationType::synchronous);
-                                                                auto const currentSampleRate = mDocumentAccessor.getAttr<Document::AttrType::samplerate>();
-
-                                                                {
-                                                                    Document::Accessor tempAcsr;
-                                                                    tempAcsr.copyFrom(*cAcsr.get(), NotificationType::synchronous);
-                                                                    tempAcsr.setAttr<Document::AttrType::reader>({layout}, NotificationType::synchronous);
-                                                                    for(auto trackAcsr : tempAcsr.getAcsrs<Document::AcsrType::tracks>())
-                                                                    {
-                                                                        auto trackChannelsLayout = trackAcsr.get().getAttr<Track::AttrType::channelsLayout>();
-                                                                        std::fill(trackChannelsLayout.begin(), trackChannelsLayout.end(), true);
-                                                                        trackAcsr.get().setAttr<Track::AttrType::channelsLayout>(trackChannelsLayout, NotificationType::synchronous);
-                                                                    }
-                                                                    if(adaptationToSampleRate && originalSampleRate > 0.0)
-                                                                    {
-                                                                        auto const ratio = currentSampleRate / originalSampleRate;
-                                                                        for(auto trackAcsr : tempAcsr.getAcsrs<Document::AcsrType::tracks>())
-                                                                        {
-                                                                            auto state = trackAcsr.get().getAttr<Track::AttrType::state>();
-                                                                            state.blockSize = static_cast<size_t>(std::round(static_cast<double>(state.blockSize) * ratio));
-                                                                            state.stepSize = static_cast<size_t>(std::round(static_cast<double>(state.stepSize) * ratio));
-                                                                            trackAcsr.get().setAttr<Track::AttrType::state>(state, NotificationType::synchronous);
-                                                                        }
-                                                                    }
 
-                                                                    mDocumentAccessor.copyFrom(tempAcsr, NotificationType::synchronous);
-                                                                }
-
-                                                                mDocumentAccessor.getAcsr<Document::AcsrType::timeZoom>().setAttr<Zoom::AttrType::visibleRange>(Zoom::Range{0.0, std::numeric_limits<double>::max()}, NotificationType::synchronous);
-
-                                                                auto const trackAcsrs = mDocumentAccessor.getAcsrs<Document::AcsrType::tracks>();
-                                                                lock.exit();
-
-                                                                while(std::any_of(trackAcsrs.cbegin(), trackAcsrs.cend(), [&](auto const& trackAcsr)
-                                                                                  {
-                                                                                      if(!lock.tryEnter())
-                                                                                      {
-                                                                                          return false;
-                                                                                      }
-                                                                                      auto const processing = trackAcsr.get().template getAttr<Track::AttrType::processing>();
-                                                                                      lock.exit();
-                                                                                      return std::get<0>(processing) || std::get<2>(processing);
-                                                                                  }))
-                                                                {
-                                                                    using namespace std::chrono_literals;
-                                                                    std::this_thread::sleep_for(20ms);
-                                                                }
-
-                                                                auto const result = Document::Exporter::exportTo(mDocumentAccessor, file, {}, {}, layout.file.getFileNameWithoutExtension() + " ", identifiers, options, mShoulAbort);
-                                                                if(result.failed())
-                                                                {
-                                                                    triggerAsyncUpdate();
-                                                                    return std::make_tuple(AlertWindow::MessageType::warning, juce::translate("Batch processing failed!"), result.getErrorMessage());
-                                                                }
-                                                            }
-                                                            triggerAsyncUpdate();
-                                                            return std::make_tuple(AlertWindow::MessageType::info, juce::translate("Batch processing succeeded!"), juce::translate("The files have been successfully exported to DIRNAME.").replace("DIRNAME", file.getFullPathName()));
-                                                        });
+                                  mOutputDirectory = file;
+                                  Document::Batcher::Selection selection;
+                                  selection.identifiers = identifiers;
+                                  // The batch processing of the application adapts the sizes of all the tracks to the sample rate
+                                  mBatcher = std::make_unique<Document::Batcher>(templateAcsr, Instance::get().getAudioFormatManager(), adaptationToSampleRate, Document::Template::AdaptationRule::allSizes, selection, options, incremental, 0_z);
+                                  mBatcher->onFileEnded = [this, numFiles = layouts.size()](Document::Batcher::Report const&)
+                                  {
+                                      auto const numProcessed = mBatcher->getReports().size();
+                                      mPropertyExport.entry.setTooltip(juce::translate("Abort the batch processing (NUMPROCESSED/NUMFILES files processed).").replace("NUMPROCESSED", juce::String(numProcessed)).replace("NUMFILES", juce::String(numFiles)));
+                                  };
+                                  mBatcher->onEnded = [this, numFiles = layouts.size()]()
+                                  {
+                                      showReports(numFiles);
+                                  };
+                                  std::vector<std::vector<AudioFileLayout>> readers;
+                                  readers.reserve(layouts.size());
+                                  for(auto const& layout : layouts)
+                                  {
+                                      readers.push_back({layout});
+                                  }
+                                  mBatcher->launch(readers, file, numJobs);
                               });
 }
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../Document/AnlDocumentDirector.h"
+#include "../Document/AnlDocumentBatcher.h"
 #include "AnlApplicationModel.h"
 
 ANALYSE_FILE_BEGIN
@@ -10,7 +10,6 @@ namespace Application
     class BatcherContent
     : public juce::Component
     , public juce::DragAndDropContainer
-    , private juce::AsyncUpdater
     {
     public:
         BatcherContent();
@@ -22,29 +21,24 @@ namespace Application
         bool canCloseWindow() const;
 
     private:
-        // juce::AsyncUpdater
-        void handleAsyncUpdate() override;
-
         void process();
+        void showReports(size_t numFiles);
 
-        AlertWindow::Catcher mAlertCatcher;
-        juce::UndoManager mUndoManager;
-        Document::Accessor mDocumentAccessor;
-        Document::Director mDocumentDirector;
         Accessor::Listener mListener{typeid(*this).name()};
 
         AudioFileLayoutTable mAudioFileLayoutTable;
         ColouredPanel mSeparator;
         Document::Exporter::Panel mExporterPanel;
         PropertyToggle mPropertyAdaptationToSampleRate;
+        PropertyNumber mPropertyNumJobs;
+        PropertyToggle mPropertyIncremental;
         PropertyTextButton mPropertyExport;
         LoadingIcon mLoadingIcon;
         ComponentListener mComponentListener;
         std::unique_ptr<juce::FileChooser> mFileChooser;
 
-        using ProcessResult = std::tuple<AlertWindow::MessageType, juce::String, juce::String>;
-        std::atomic<bool> mShoulAbort{false};
-        std::future<ProcessResult> mProcess;
+        std::unique_ptr<Document::Batcher> mBatcher;
+        juce::File mOutputDirectory;
     };
 
     class BatcherPanel
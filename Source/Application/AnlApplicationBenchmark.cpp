@@ -0,0 +1,349 @@
+#include "AnlApplicationBenchmark.h"
+#include "../Track/AnlTrackLoader.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    double getElapsedTime(juce::int64 startTime)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime);
+    }
+
+    // The medians are rounded to the microsecond so the reports don't contain insignificant digits
+    double getMedian(std::vector<double> values)
+    {
+        if(values.empty())
+        {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        auto const middle = values.size() / 2_z;
+        auto const median = values.size() % 2_z == 0_z ? (values[middle - 1_z] + values[middle]) / 2.0 : values[middle];
+        return std::round(median * 1000000.0) / 1000000.0;
+    }
+} // namespace
+
+Application::Benchmark::Benchmark(Options const& options)
+: mOptions(options)
+{
+}
+
+Application::Benchmark::~Benchmark()
+{
+    cancelPendingUpdate();
+}
+
+juce::Result Application::Benchmark::generateAudioFile(juce::File const& file, double duration, int numChannels, double sampleRate)
+{
+    if(duration <= 0.0 || numChannels <= 0 || sampleRate <= 0.0)
+    {
+        return juce::Result::fail("Invalid audio file configuration");
+    }
+    file.deleteFile();
+    auto stream = file.createOutputStream();
+    if(stream == nullptr)
+    {
+        return juce::Result::fail("Could not write file: " + file.getFullPathName());
+    }
+    juce::WavAudioFormat format;
+    std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(stream.get(), sampleRate, static_cast<unsigned int>(numChannels), 24, {}, 0));
+    if(writer == nullptr)
+    {
+        return juce::Result::fail("Could not write file: " + file.getFullPathName());
+    }
+    juce::ignoreUnused(stream.release());
+
+    // Each channel contains a harmonic tone with a sliding pitch, onsets every half second and a seeded noise
+    juce::Random random(42);
+    auto const numSamples = static_cast<juce::int64>(std::ceil(duration * sampleRate));
+    auto constexpr blockSize = 4096;
+    juce::AudioBuffer<float> buffer(numChannels, blockSize);
+    for(juce::int64 position = 0; position < numSamples; position += blockSize)
+    {
+        auto const blockLength = static_cast<int>(std::min(static_cast<juce::int64>(blockSize), numSamples - position));
+        for(auto channel = 0; channel < numChannels; ++channel)
+        {
+            auto* samples = buffer.getWritePointer(channel);
+            for(auto index = 0; index < blockLength; ++index)
+            {
+                auto const time = static_cast<double>(position + index) / sampleRate;
+                auto const frequency = 110.0 * static_cast<double>(channel + 1) * (1.0 + 0.5 * std::sin(2.0 * juce::MathConstants<double>::pi * time / 10.0));
+                auto const phase = 2.0 * juce::MathConstants<double>::pi * frequency * time;
+                auto const envelope = std::exp(-8.0 * std::fmod(time, 0.5));
+                auto value = 0.0;
+                for(auto harmonic = 1; harmonic <= 8; ++harmonic)
+                {
+                    value += std::sin(phase * static_cast<double>(harmonic)) / static_cast<double>(harmonic);
+                }
+                samples[index] = static_cast<float>(0.25 * envelope * value) + (random.nextFloat() - 0.5f) * 0.02f;
+            }
+        }
+        if(!writer->writeFromAudioSampleBuffer(buffer, 0, blockLength))
+        {
+            return juce::Result::fail("Could not write file: " + file.getFullPathName());
+        }
+    }
+    return juce::Result::ok();
+}
+
+std::vector<Document::Exporter::Options> Application::Benchmark::getExportOptions()
+{
+    std::vector<Document::Exporter::Options> exportOptions;
+    for(auto const format : magic_enum::enum_values<Document::Exporter::Options::Format>())
+    {
+        Document::Exporter::Options options;
+        options.format = format;
+        options.useAutoSize = false;
+        options.sdifFrameSignature = "1BEN";
+        options.sdifMatrixSignature = "1BEN";
+        exportOptions.push_back(options);
+    }
+    return exportOptions;
+}
+
+juce::Result Application::Benchmark::launch()
+{
+    MiscWeakAssert(!isRunning());
+    if(isRunning())
+    {
+        return juce::Result::fail("The benchmark is already running");
+    }
+    if(!mOptions.templateFile.existsAsFile())
+    {
+        return juce::Result::fail("Could not find file: " + mOptions.templateFile.getFullPathName());
+    }
+    auto const result = mOptions.directory.createDirectory();
+    if(result.failed())
+    {
+        return result;
+    }
+    mAudioFile = mOptions.directory.getChildFile("Benchmark.wav");
+    auto const startTime = juce::Time::getHighResolutionTicks();
+    auto const audioResult = generateAudioFile(mAudioFile, mOptions.duration, mOptions.numChannels, mOptions.sampleRate);
+    if(audioResult.failed())
+    {
+        return audioResult;
+    }
+    MiscDebug("Benchmark", "Audio file generated in " + juce::String(getElapsedTime(startTime)) + "s");
+
+    mIteration = 0_z;
+    mAnalyses.clear();
+    mTracks.clear();
+    mExports.clear();
+    mLoadings.clear();
+    mSdifConversions.clear();
+    mErrors.clear();
+    return launchIteration();
+}
+
+bool Application::Benchmark::isRunning() const
+{
+    return mExecutor != nullptr;
+}
+
+juce::Result Application::Benchmark::launchIteration()
+{
+    mExecutor = std::make_unique<Document::Executor>();
+    mExecutor->onEnded = [this]()
+    {
+        endIteration();
+    };
+    mStartTime = juce::Time::getHighResolutionTicks();
+    auto result = mExecutor->load(mAudioFile, mOptions.templateFile, false);
+    if(result.wasOk())
+    {
+        result = mExecutor->launch();
+    }
+    if(result.failed())
+    {
+        mExecutor.reset();
+    }
+    return result;
+}
+
+void Application::Benchmark::endIteration()
+{
+    // The duration of the analysis includes the loading of the document and the plugins
+    mAnalyses["total"].push_back(getElapsedTime(mStartTime));
+
+    auto const exportDirectory = mOptions.directory.getChildFile("Export");
+    std::atomic<bool> const shouldAbort{false};
+    std::atomic<float> advancement{0.0f};
+    for(auto const& options : getExportOptions())
+    {
+        auto const formatName = options.getFormatName().toLowerCase().toStdString();
+        auto const formatDirectory = exportDirectory.getChildFile(options.getFormatName());
+        formatDirectory.deleteRecursively();
+        formatDirectory.createDirectory();
+
+        auto const identifiers = mExecutor->getExportIdentifiers(options, false, false);
+        if(identifiers.empty())
+        {
+            continue;
+        }
+        auto const exportStartTime = juce::Time::getHighResolutionTicks();
+        auto const exportResult = mExecutor->exportTo(formatDirectory, "", identifiers, options, shouldAbort);
+        mExports[formatName].push_back(getElapsedTime(exportStartTime));
+        if(exportResult.failed())
+        {
+            mErrors.insert(formatName + ": " + exportResult.getErrorMessage().toStdString());
+            continue;
+        }
+        if(options.useImageFormat())
+        {
+            continue;
+        }
+
+        auto loadingDuration = 0.0;
+        for(auto const& file : formatDirectory.findChildFiles(juce::File::TypesOfFileToFind::findFiles, false))
+        {
+            auto const loadingStartTime = juce::Time::getHighResolutionTicks();
+            auto const description = Track::Loader::getFileDescription(file, mOptions.sampleRate);
+            auto const loadingResult = std::get<0_z>(description).wasOk() ? Track::Loader::loadFromFile(std::get<1_z>(description), shouldAbort, advancement) : std::variant<Track::Results, juce::String>(std::get<0_z>(description).getErrorMessage());
+            loadingDuration += getElapsedTime(loadingStartTime);
+            if(auto const* message = std::get_if<juce::String>(&loadingResult))
+            {
+                mErrors.insert(formatName + ": " + message->toStdString());
+            }
+        }
+        mLoadings[formatName].push_back(loadingDuration);
+    }
+
+    measureSdifConversion();
+
+    auto const profile = mExecutor->getProfile();
+    for(auto const& track : profile.at("tracks"))
+    {
+        auto& measures = mTracks[track.at("name").get<std::string>()];
+        for(auto const& [stage, duration] : track.at("durations").items())
+        {
+            // The exports are measured by format
+            if(stage != Track::Profiler::getStageName(Track::Profiler::Stage::exporting).toStdString())
+            {
+                measures[stage].push_back(duration.get<double>());
+            }
+        }
+        measures["peakMemory"].push_back(track.at("peakMemory").get<double>());
+    }
+
+    for(auto const& message : mExecutor->getAlertCatcher().getMessages())
+    {
+        for(auto const& text : message.second)
+        {
+            mErrors.insert((std::get<1>(message.first) + ": " + text).toStdString());
+        }
+    }
+
+    // The executor is deleted asynchronously because the function is called by the executor
+    triggerAsyncUpdate();
+}
+
+void Application::Benchmark::measureSdifConversion()
+{
+    // The columns have the size of a spectrogram of a few minutes so the conversion dominates the file access
+    auto constexpr numChannels = 2_z;
+    auto constexpr numFrames = 20000_z;
+    auto constexpr numBins = 128_z;
+    SdifConverter::Columns columns(numChannels);
+    for(auto channel = 0_z; channel < numChannels; ++channel)
+    {
+        columns[channel].reserve(numFrames);
+        for(auto frame = 0_z; frame < numFrames; ++frame)
+        {
+            std::vector<float> values(numBins);
+            for(auto bin = 0_z; bin < numBins; ++bin)
+            {
+                values[bin] = static_cast<float>(channel * numBins + bin) + static_cast<float>(frame % 64_z) * 0.5f;
+            }
+            columns[channel].push_back(std::make_tuple(static_cast<double>(frame) * 0.01, 0.0, std::move(values), std::vector<float>{}));
+        }
+    }
+
+    auto const file = mOptions.directory.getChildFile("Benchmark.sdif");
+    auto const signature = SdifConverter::getSignature("1BEN");
+    auto const writeStartTime = juce::Time::getHighResolutionTicks();
+    auto const writeResult = SdifConverter::write(file, {0.0, static_cast<double>(numFrames)}, signature, signature, {}, columns, []()
+                                                  {
+                                                      return true;
+                                                  });
+    mSdifConversions["write"].push_back(getElapsedTime(writeStartTime));
+    if(writeResult.failed())
+    {
+        mErrors.insert("sdif: " + writeResult.getErrorMessage().toStdString());
+        return;
+    }
+
+    std::atomic<bool> const shouldAbort{false};
+    std::atomic<float> advancement{0.0f};
+    auto const readStartTime = juce::Time::getHighResolutionTicks();
+    auto const readResult = Track::Loader::loadFromSdif(file, signature, signature, {}, {}, shouldAbort, advancement);
+    mSdifConversions["read"].push_back(getElapsedTime(readStartTime));
+    if(auto const* message = std::get_if<juce::String>(&readResult))
+    {
+        mErrors.insert("sdif: " + message->toStdString());
+    }
+    file.deleteFile();
+}
+
+void Application::Benchmark::handleAsyncUpdate()
+{
+    if(++mIteration >= std::max(mOptions.numIterations, 1_z))
+    {
+        end(juce::Result::ok());
+        return;
+    }
+    auto const result = launchIteration();
+    if(result.failed())
+    {
+        end(result);
+    }
+}
+
+void Application::Benchmark::end(juce::Result const& result)
+{
+    mExecutor.reset();
+    if(onEnded != nullptr)
+    {
+        onEnded(result, createReport());
+    }
+}
+
+nlohmann::json Application::Benchmark::createReport() const
+{
+    auto const toJson = [](Measures const& measures)
+    {
+        auto json = nlohmann::json::object();
+        for(auto const& [name, values] : measures)
+        {
+            json[name] = getMedian(values);
+        }
+        return json;
+    };
+
+    auto configuration = nlohmann::json::object();
+    configuration["duration"] = mOptions.duration;
+    configuration["numChannels"] = mOptions.numChannels;
+    configuration["sampleRate"] = mOptions.sampleRate;
+    configuration["numIterations"] = mOptions.numIterations;
+    configuration["template"] = mOptions.templateFile.getFileName().toStdString();
+
+    auto tracks = nlohmann::json::object();
+    for(auto const& [name, measures] : mTracks)
+    {
+        tracks[name] = toJson(measures);
+    }
+
+    auto report = nlohmann::json::object();
+    report["version"] = juce::JUCEApplication::getInstance() != nullptr ? juce::JUCEApplication::getInstance()->getApplicationVersion().toStdString() : std::string{};
+    report["configuration"] = std::move(configuration);
+    report["analysis"] = toJson(mAnalyses);
+    report["tracks"] = std::move(tracks);
+    report["export"] = toJson(mExports);
+    report["load"] = toJson(mLoadings);
+    report["sdif"] = toJson(mSdifConversions);
+    report["errors"] = mErrors;
+    return report;
+}
+
+ANALYSE_FILE_END
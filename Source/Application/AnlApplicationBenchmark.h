@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../Document/AnlDocumentExecutor.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Application
+{
+    //! @brief Measures the performance of the analysis-to-export pipeline.
+    //! @details The benchmark generates a synthetic audio file, analyzes it with a template (the factory template
+    //! uses the waveform and the spectrogram plugins), exports the results to all the formats and loads the
+    //! exported files. The durations of the stages of the tracks (reading, processing, converting and rendering),
+    //! the durations of the exports and the loadings of each format and the duration of the whole analysis are
+    //! measured for several iterations and the medians are reported as JSON with sorted keys so the reports of
+    //! different versions can be compared. The durations of the writing and the reading of a large SDIF file of
+    //! columns are also measured to follow the throughput of the SDIF conversion independently of the template.
+    class Benchmark
+    : private juce::AsyncUpdater
+    {
+    public:
+        struct Options
+        {
+            double duration{60.0}; // In seconds
+            int numChannels{2};
+            double sampleRate{44100.0};
+            size_t numIterations{3_z};
+            juce::File templateFile;
+            juce::File directory; // The working directory
+        };
+
+        explicit Benchmark(Options const& options);
+        ~Benchmark() override;
+
+        //! @brief Generates the audio file and launches the first iteration.
+        juce::Result launch();
+
+        //! @brief Checks if the benchmark is running.
+        bool isRunning() const;
+
+        //! @brief Generates a deterministic audio file with tones, onsets and noise.
+        static juce::Result generateAudioFile(juce::File const& file, double duration, int numChannels, double sampleRate);
+
+        //! @brief The callback that is called with the report once all the iterations have ended.
+        std::function<void(juce::Result const& result, nlohmann::json const& report)> onEnded = nullptr;
+
+    private:
+        using Measures = std::map<std::string, std::vector<double>>;
+
+        // juce::AsyncUpdater
+        void handleAsyncUpdate() override;
+
+        juce::Result launchIteration();
+        void endIteration();
+        void end(juce::Result const& result);
+        nlohmann::json createReport() const;
+
+        static std::vector<Document::Exporter::Options> getExportOptions();
+        void measureSdifConversion();
+
+        Options const mOptions;
+        juce::File mAudioFile;
+        std::unique_ptr<Document::Executor> mExecutor;
+        size_t mIteration{0_z};
+        juce::int64 mStartTime{0};
+        Measures mAnalyses;
+        std::map<std::string, Measures> mTracks;
+        Measures mExports;
+        Measures mLoadings;
+        Measures mSdifConversions;
+        std::set<std::string> mErrors;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Benchmark)
+    };
+} // namespace Application
+
+ANALYSE_FILE_END
@@ -1,8 +1,142 @@
 #include "AnlApplicationCommandLine.h"
+#include "AnlApplicationBenchmark.h"
 #include "AnlApplicationInstance.h"
+#include "AnlApplicationServer.h"
 
 ANALYSE_FILE_BEGIN
 
+namespace
+{
+    bool isManifestFile(juce::File const& file)
+    {
+        return file.existsAsFile() && file.hasFileExtension("json;csv;txt");
+    }
+
+    std::variant<juce::Array<juce::File>, juce::Result> getManifestFiles(juce::File const& manifestFile)
+    {
+        // The relative paths of the manifest are relative to the manifest location
+        auto const directory = manifestFile.getParentDirectory();
+        juce::Array<juce::File> files;
+        if(manifestFile.hasFileExtension("json"))
+        {
+            nlohmann::json container;
+            try
+            {
+                container = nlohmann::json::parse(manifestFile.loadFileAsString().toStdString());
+            }
+            catch(nlohmann::json::parse_error& e)
+            {
+                return juce::Result::fail(juce::translate(e.what()));
+            }
+            if(!container.is_array())
+            {
+                return juce::Result::fail(juce::translate("The manifest file FLNM must contain an array of audio files!").replace("FLNM", manifestFile.getFileName()));
+            }
+            for(auto const& entry : container)
+            {
+                if(entry.is_string())
+                {
+                    files.add(directory.getChildFile(juce::String(entry.get<std::string>())));
+                }
+                else if(entry.is_object() && entry.contains("input") && entry.at("input").is_string())
+                {
+                    files.add(directory.getChildFile(juce::String(entry.at("input").get<std::string>())));
+                }
+                else
+                {
+                    return juce::Result::fail(juce::translate("The manifest file FLNM contains an invalid entry!").replace("FLNM", manifestFile.getFileName()));
+                }
+            }
+            return files;
+        }
+
+        // The CSV and text manifests contain one audio file per line, the first column of the CSV manifests is used
+        // and the lines starting with # are ignored as well as an optional input header
+        juce::StringArray lines;
+        manifestFile.readLines(lines);
+        for(auto const& line : lines)
+        {
+            auto const path = (manifestFile.hasFileExtension("csv") ? line.upToFirstOccurrenceOf(",", false, false) : line).trim().unquoted();
+            if(path.isEmpty() || path.startsWithChar('#') || (files.isEmpty() && path.equalsIgnoreCase("input")))
+            {
+                continue;
+            }
+            files.add(directory.getChildFile(path));
+        }
+        return files;
+    }
+
+    std::variant<juce::Array<juce::File>, juce::Result> getInputFiles(juce::File const& input, juce::String const& audioWildcard, bool recursive)
+    {
+        if(isManifestFile(input))
+        {
+            return getManifestFiles(input);
+        }
+        auto const isPattern = input.getFileName().containsAnyOf("*?");
+        auto const directory = isPattern ? input.getParentDirectory() : input;
+        if(!directory.isDirectory())
+        {
+            return juce::Result::fail("Could not find folder: " + directory.getFullPathName());
+        }
+        auto files = directory.findChildFiles(juce::File::TypesOfFileToFind::findFiles, recursive, isPattern ? input.getFileName() : audioWildcard);
+        files.sort();
+        return files;
+    }
+
+    size_t getMemoryBudget(juce::ArgumentList const& args)
+    {
+        if(!args.containsOption("--memory"))
+        {
+            return 0_z;
+        }
+        auto const megabytes = args.getValueForOption("--memory").getLargeIntValue();
+        if(megabytes <= 0)
+        {
+            juce::ConsoleApplication::fail("Invalid memory budget: " + args.getValueForOption("--memory"));
+        }
+        return static_cast<size_t>(megabytes) * 1024_z * 1024_z;
+    }
+
+    void writeProfile(juce::File const& file, nlohmann::json const& profile)
+    {
+        if(file.getParentDirectory().createDirectory().failed() || !file.replaceWithText(profile.dump(4)))
+        {
+            std::cerr << "Could not write file: " << file.getFullPathName() << std::endl;
+        }
+    }
+
+    nlohmann::json getSummary(std::vector<Document::Batcher::Report> const& reports)
+    {
+        auto json = nlohmann::json::object();
+        auto files = nlohmann::json::array();
+        auto numFailed = 0_z;
+        for(auto const& report : reports)
+        {
+            auto entry = nlohmann::json::object();
+            entry["input"] = report.reader.empty() ? std::string{} : report.reader.front().file.getFullPathName().toStdString();
+            entry["success"] = report.result.wasOk();
+            entry["error"] = report.result.getErrorMessage().toStdString();
+            entry["upToDate"] = report.numUpToDate;
+            auto messages = nlohmann::json::array();
+            for(auto const& message : report.messages)
+            {
+                auto const type = juce::String(std::string(magic_enum::enum_name(std::get<0>(message.first)))).toUpperCase();
+                for(auto const& text : message.second)
+                {
+                    messages.push_back((type + " - " + std::get<1>(message.first) + ": " + text).toStdString());
+                }
+            }
+            entry["messages"] = std::move(messages);
+            files.push_back(std::move(entry));
+            numFailed += report.result.failed() ? 1_z : 0_z;
+        }
+        json["succeeded"] = reports.size() - numFailed;
+        json["failed"] = numFailed;
+        json["files"] = std::move(files);
+        return json;
+    }
+} // namespace
+
 Application::CommandLine::CommandLine()
 {
     PluginList::Accessor pluginListAcsr;
@@ -10,6 +144,8 @@ Application::CommandLine::CommandLine()
     pluginListAcsr.setAttr<PluginList::AttrType::quarantineMode>(PluginList::QuarantineMode::ignore, NotificationType::synchronous);
     PluginList::setEnvironment(pluginListAcsr, true);
 
+    mAudioFormatManager.registerBasicFormats();
+
     addHelpCommand("--help|-h", "Usage:", false);
     addVersionCommand("--version|-v", juce::String(ProjectInfo::projectName) + " v" + Instance::get().getApplicationVersion());
     addCommand({"", "[file(s)]", "Loads the document or creates a new document with the audio files specified as arguments.", "", {}});
@@ -52,12 +188,12 @@ Application::CommandLine::CommandLine()
     addCommand(
         {"--export|-e",
          "--export|-e [options]",
-         "Analyzes an audio file and exports the results.\n\t"
+         "Analyzes an audio file or a set of audio files and exports the results.\n\t"
          "--document|-d <document> Defines the path to the document to analyze (required if --input/template are undefined).\n\t"
-         "--input|-i <audiofile> Defines the path to the audio file to analyze (required if --template is defined).\n\t"
+         "--input|-i <audiofile> Defines the path to the audio file to analyze, or the path to a folder, a quoted wildcard pattern or a manifest file (json, csv or txt) of audio files to analyze (required if --template is defined).\n\t"
          "--template|-t <templatefile> Defines the path to the template file (required if --input is defined).\n\t"
          "--output|-o <outputdirectory> Defines the path of the output folder (required).\n\t"
-         "--format|-f <formatname> Defines the export format (jpeg, png, csv, lab, json, cue, reaper, puredata, max or sdif) (required).\n\t"
+         "--format|-f <formatname> Defines the export format (jpeg, png, csv, lab, json, cue, reaper, puredata, max, sdif, npy or npz) (required).\n\t"
          "--width <width> Defines the width of the exported image in pixels (required with the jpeg and png formats).\n\t"
          "--height <height> Defines the height of the exported image in pixels (required with the jpeg and png formats).\n\t"
          "--ppi <ppi> Defines the pixel density of the exported image in pixels per inch (optional with the jpeg and png formats - default 72).\n\t"
@@ -69,16 +205,23 @@ Application::CommandLine::CommandLine()
          "--noescape Disables escaping of special characters in labels (optional with the csv and lab formats).\n\t"
          "--reapertype <type> Defines the type of the reaper format  (optional with the reaper format 'marker' or 'region', default is 'region').\n\t"
          "--description Includes the plugin description (optional with the json format).\n\t"
-         "--thresholds Applies extra thresholds filtering to the exported results (optional with the csv, lab, json, cue, and reaper formats).\n\t"
+         "--thresholds Applies extra thresholds filtering to the exported results (optional with the csv, lab, json, cue, reaper, puredata, max, npy, and npz formats).\n\t"
          "--frame <framesignature> Defines the 4 characters frame signature (required with the sdif format).\n\t"
          "--matrix <matrixsignature> Defines the 4 characters matrix signature (required with the sdif format).\n\t"
-         "--colname <string> Defines the name of the column (optional with the sdif format).",
+         "--colname <string> Defines the name of the column (optional with the sdif format).\n\t"
+         "--recursive Searches the audio files in the subfolders (optional if --input is a folder or a wildcard pattern).\n\t"
+         "--jobs|-j <number> Defines the number of audio files processed concurrently (optional if --input is a folder, a wildcard pattern or a manifest - default is the number of cores).\n\t"
+         "--summary <jsonfile> Defines the path of the JSON summary of the processing (optional if --input is a folder, a wildcard pattern or a manifest - default prints the summary).\n\t"
+         "--incremental Skips the tracks and the groups whose results are up-to-date in the output folder (optional if --input is a folder, a wildcard pattern or a manifest).\n\t"
+         "--memory <megabytes> Defines the maximum size of the results kept in memory, the results of the analyzed tracks that exceed it are written to temporary files until they are exported (optional - default is no limit, shared between the audio files processed concurrently).\n\t"
+         "--profile <jsonfile> Defines the path of the JSON report of the durations of the stages (read, process, convert, load, render and export) and the peak memory of the results of the tracks (optional).\n\t"
+         "--trace <jsonfile> Defines the path of the Chrome trace event file of the analyses, the loadings, the renderings, the exports and the notifications of the threads that can be opened in Perfetto (optional).",
          "",
          [this](juce::ArgumentList const& args)
          {
              mShouldWait = false;
              MiscDebug("CommandLine", "Parsing arguments...");
-             using Options = Document::Exporter::Options;
+             startTrace(args);
 
              auto const outputDir = args.getFileForOption("-o|--output");
              if(!outputDir.exists())
@@ -94,130 +237,49 @@ Application::CommandLine::CommandLine()
                  fail("Could not find folder: " + outputDir.getFullPathName());
              }
 
-             Options options;
-             bool useGroupOverview = false;
-             bool ignoreGridResults = false;
-             auto const format = args.getValueForOption("-f|--format");
-             if(args.containsOption("--options"))
-             {
-                 auto const optionsFile = args.getExistingFileForOption("--options");
-                 auto xml = juce::XmlDocument::parse(optionsFile);
-                 if(xml == nullptr)
-                 {
-                     auto const result = juce::Result::fail(juce::translate("The options file FLNM cannot be parsed!").replace("FLNM", optionsFile.getFileName()));
-                     fail(result.getErrorMessage());
-                 }
+             Document::Exporter::Options options;
+             auto useGroupOverview = false;
+             auto ignoreGridResults = false;
+             std::tie(options, useGroupOverview, ignoreGridResults) = parseExportOptions(args);
 
-                 options = XmlParser::fromXml(*xml, "exportOptions", options);
-             }
-             else if(!args.containsOption("-f|--format"))
-             {
-                 fail("Format not specified! Available formats are jpeg, png, csv, lab, json, cue, reaper, puredata, max or sdif.");
-             }
-             else if(format == "jpeg" || format == "png")
+             if(!args.containsOption("-d|--document"))
              {
-                 if(!args.containsOption("--width"))
+                 // A folder, a wildcard pattern or a manifest of audio files is processed in batch
+                 auto const input = args.getFileForOption("-i|--input");
+                 if(!input.existsAsFile() || isManifestFile(input))
                  {
-                     fail("Width not specified! Specify the width of the image in pixels.");
-                 }
-                 if(!args.containsOption("--height"))
-                 {
-                     fail("Height not specified! Specify the height of the image in pixels.");
-                 }
-
-                 options.format = format == "jpeg" ? Options::Format::jpeg : Options::Format::png;
-                 options.imageWidth = args.getValueForOption("--width").getIntValue();
-                 options.imageHeight = args.getValueForOption("--height").getIntValue();
-                 options.imagePpi = args.containsOption("--ppi") ? args.getValueForOption("--ppi").getIntValue() : 72;
-                 useGroupOverview = args.containsOption("--groups");
-             }
-             else if(format == "csv" || format == "lab" || format == "json" || format == "cue" || format == "reaper" || format == "sdif" || format == "puredata" || format == "max")
-             {
-                 if(format == "csv")
-                 {
-                     options.format = Options::Format::csv;
-                 }
-                 else if(format == "lab")
-                 {
-                     options.format = Options::Format::lab;
-                 }
-                 else if(format == "json")
-                 {
-                     options.format = Options::Format::json;
-                 }
-                 else if(format == "cue")
-                 {
-                     options.format = Options::Format::cue;
-                 }
-                 else if(format == "reaper")
-                 {
-                     options.format = Options::Format::reaper;
-                 }
-                 else if(format == "puredata")
-                 {
-                     options.format = Options::Format::puredata;
-                 }
-                 else if(format == "max")
-                 {
-                     options.format = Options::Format::max;
-                 }
-                 else
-                 {
-                     options.format = Options::Format::sdif;
-                     if(!args.containsOption("--frame"))
+                     auto const files = getInputFiles(input, mAudioFormatManager.getWildcardForAllFormats(), args.containsOption("--recursive"));
+                     if(files.index() == 1_z)
                      {
-                         fail("Frame signature not specified! Specifiy the frame signature of the SDIf file.");
-                     }
-                     if(!args.containsOption("--matrix"))
-                     {
-                         fail("Matrix signature not specified! Specifiy the matrix signature of the SDIf file.");
+                         fail(std::get<1_z>(files).getErrorMessage());
                      }
+                     auto const templateFile = args.getExistingFileForOption("-t|--template");
+                     auto const adaptToSampleRate = args.containsOption("--adapt");
+                     auto const numJobs = args.containsOption("-j|--jobs") ? static_cast<size_t>(std::max(args.getValueForOption("-j|--jobs").getIntValue(), 1)) : Document::Batcher::getDefaultNumJobs();
+                     auto const summaryFile = args.containsOption("--summary") ? args.getFileForOption("--summary") : juce::File{};
+                     auto const incremental = args.containsOption("--incremental");
+                     auto const profileFile = args.containsOption("--profile") ? args.getFileForOption("--profile") : juce::File{};
+                     exportFiles(std::get<0_z>(files), templateFile, outputDir, adaptToSampleRate, options, useGroupOverview, ignoreGridResults, numJobs, summaryFile, incremental, profileFile, getMemoryBudget(args));
+                     return;
                  }
-                 ignoreGridResults = args.containsOption("--nogrids");
-                 if(args.containsOption("--header"))
-                 {
-                     auto const header = args.getValueForOption("--header");
-                     auto const csvHeader = magic_enum::enum_cast<Document::Exporter::Options::CsvHeaderType>(header.toStdString());
-                     if(csvHeader.has_value())
-                     {
-                         options.csvHeaderType = csvHeader.value();
-                     }
-                     else
-                     {
-                         fail("Header '" + header + "' unsupported! Available headers are none, generic, or specific.");
-                     }
-                 }
-                 else
-                 {
-                     options.csvHeaderType = Document::Exporter::Options::CsvHeaderType::none;
-                 }
-                 options.includeDescription = args.containsOption("--description");
-                 options.applyExtraThresholds = args.containsOption("--thresholds");
-                 options.disableLabelEscaping = args.containsOption("--noescape");
-                 options.reaperType = args.getValueForOption("--reapertype").toLowerCase() == "marker" ? Options::ReaperType::marker : Options::ReaperType::region;
-                 options.sdifFrameSignature = args.getValueForOption("--frame").removeCharacters("\"").toUpperCase();
-                 options.sdifMatrixSignature = args.getValueForOption("--matrix").removeCharacters("\"").toUpperCase();
-                 options.sdifColumnName = args.getValueForOption("--colname");
-                 auto const separator = magic_enum::enum_cast<Document::Exporter::Options::ColumnSeparator>(args.getValueForOption("--separator").toStdString());
-                 if(separator.has_value())
-                 {
-                     options.columnSeparator = *separator;
-                     options.labSeparator = *separator;
-                 }
-             }
-             else
-             {
-                 fail("Format '" + format + "' unsupported! Available formats are jpeg, png, csv, lab, json, cue, reaper, puredata, max or sdif.");
              }
 
-             options.useAutoSize = false;
-
+             auto const profileFile = args.containsOption("--profile") ? args.getFileForOption("--profile") : juce::File{};
+             auto const startTime = juce::Time::getHighResolutionTicks();
              mExecutor = std::make_unique<Document::Executor>();
+             mExecutor->setMemoryBudget(getMemoryBudget(args));
              mExecutor->onEnded = [=, this]()
              {
                  LookAndFeel lookAndFeel;
                  juce::LookAndFeel::setDefaultLookAndFeel(&lookAndFeel);
                  auto const result = mExecutor->exportTo(outputDir, "", options, useGroupOverview, ignoreGridResults);
+                 if(profileFile != juce::File{})
+                 {
+                     auto profile = mExecutor->getProfile();
+                     profile["duration"] = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime);
+                     writeProfile(profileFile, profile);
+                 }
+                 endTrace();
                  mShouldWait = false;
                  if(result.failed())
                  {
@@ -258,6 +320,98 @@ Application::CommandLine::CommandLine()
                  fail(result.getErrorMessage());
              }
          }});
+    addCommand(
+        {"--serve",
+         "--serve [options]",
+         "Runs a service that analyzes audio files and exports the results on demand.\n\t"
+         "The jobs are read from the standard input as JSON objects (one per line) whose keys are the long options of the --export command (document, input, template, output, format, etc.) and an optional id.\n\t"
+         "The progress and the results of the jobs (with the paths of the exported files) are written to the standard output as JSON objects (one per line).\n\t"
+         "The service ends once the standard input is closed and all the jobs have been processed.\n\t"
+         "--jobs|-j <number> Defines the number of jobs processed concurrently (optional - default is the number of cores).\n\t"
+         "--trace <jsonfile> Defines the path of the Chrome trace event file of the threads written once the service has ended (optional).",
+         "",
+         [this](juce::ArgumentList const& args)
+         {
+             startTrace(args);
+             auto const numJobs = args.containsOption("-j|--jobs") ? static_cast<size_t>(std::max(args.getValueForOption("-j|--jobs").getIntValue(), 1)) : Document::Batcher::getDefaultNumJobs();
+             mLookAndFeel = std::make_unique<LookAndFeel>();
+             juce::LookAndFeel::setDefaultLookAndFeel(mLookAndFeel.get());
+             mServer = std::make_unique<Server>(numJobs);
+             mServer->onEnded = [this]()
+             {
+                 endTrace();
+                 juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+                 mLookAndFeel.reset();
+                 sendQuitSignal(0);
+             };
+         }});
+    addCommand(
+        {"--bench",
+         "--bench [options]",
+         "Measures the performance of the analyses, the renderings, the exports and the loadings of the results of a synthetic audio file.\n\t"
+         "The medians of the durations (in seconds) of several iterations are written as JSON.\n\t"
+         "--template|-t <templatefile> Defines the path to the template file (optional - default is the factory template).\n\t"
+         "--duration <seconds> Defines the duration of the synthetic audio file (optional - default is 60).\n\t"
+         "--channels <number> Defines the number of channels of the synthetic audio file (optional - default is 2).\n\t"
+         "--samplerate <samplerate> Defines the sample rate of the synthetic audio file (optional - default is 44100).\n\t"
+         "--iterations <number> Defines the number of iterations (optional - default is 3).\n\t"
+         "--output|-o <jsonfile> Defines the path of the JSON report (optional - default prints the report).",
+         "",
+         [this](juce::ArgumentList const& args)
+         {
+             Benchmark::Options options;
+             options.templateFile = args.containsOption("-t|--template") ? args.getExistingFileForOption("-t|--template") : Accessor::getFactoryTemplateFile();
+             if(args.containsOption("--duration"))
+             {
+                 options.duration = args.getValueForOption("--duration").getDoubleValue();
+             }
+             if(args.containsOption("--channels"))
+             {
+                 options.numChannels = args.getValueForOption("--channels").getIntValue();
+             }
+             if(args.containsOption("--samplerate"))
+             {
+                 options.sampleRate = args.getValueForOption("--samplerate").getDoubleValue();
+             }
+             if(args.containsOption("--iterations"))
+             {
+                 options.numIterations = static_cast<size_t>(std::max(args.getValueForOption("--iterations").getIntValue(), 1));
+             }
+             options.directory = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory).getChildFile("PartielsBenchmark");
+             auto const outputFile = args.containsOption("-o|--output") ? args.getFileForOption("-o|--output") : juce::File{};
+
+             mLookAndFeel = std::make_unique<LookAndFeel>();
+             juce::LookAndFeel::setDefaultLookAndFeel(mLookAndFeel.get());
+             mBenchmark = std::make_unique<Benchmark>(options);
+             mBenchmark->onEnded = [this, outputFile, directory = options.directory](juce::Result const& result, nlohmann::json const& report)
+             {
+                 juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+                 mLookAndFeel.reset();
+                 directory.deleteRecursively();
+                 auto const content = report.dump(4);
+                 if(outputFile == juce::File{})
+                 {
+                     std::cout << content << std::endl;
+                 }
+                 else if(outputFile.getParentDirectory().createDirectory().failed() || !outputFile.replaceWithText(content))
+                 {
+                     std::cerr << "Could not write file: " << outputFile.getFullPathName() << std::endl;
+                 }
+                 if(result.failed())
+                 {
+                     std::cerr << result.getErrorMessage() << std::endl;
+                 }
+                 sendQuitSignal(result.failed() ? 1 : 0);
+             };
+             auto const result = mBenchmark->launch();
+             if(result.failed())
+             {
+                 juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+                 mLookAndFeel.reset();
+                 mBenchmark.reset();
+                 fail(result.getErrorMessage());
+             }
+         }});
     addCommand(
         {"--sdif2json",
          "--sdif2json [options]",
@@ -408,11 +562,263 @@ Application::CommandLine::CommandLine()
 Application::CommandLine::~CommandLine()
 {
     MiscWeakAssert(!isRunning());
+    if(mLookAndFeel != nullptr)
+    {
+        juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+    }
 }
 
 bool Application::CommandLine::isRunning() const
 {
-    return mShouldWait || (mExecutor != nullptr && mExecutor->isRunning());
+    return mShouldWait || (mExecutor != nullptr && mExecutor->isRunning()) || (mBatcher != nullptr && mBatcher->isRunning()) || (mServer != nullptr && mServer->isRunning()) || (mBenchmark != nullptr && mBenchmark->isRunning());
+}
+
+std::tuple<Document::Exporter::Options, bool, bool> Application::CommandLine::parseExportOptions(juce::ArgumentList const& args)
+{
+    using Options = Document::Exporter::Options;
+
+    Options options;
+    bool useGroupOverview = false;
+    bool ignoreGridResults = false;
+    auto const format = args.getValueForOption("-f|--format");
+    if(args.containsOption("--options"))
+    {
+        auto const optionsFile = args.getExistingFileForOption("--options");
+        auto xml = juce::XmlDocument::parse(optionsFile);
+        if(xml == nullptr)
+        {
+            auto const result = juce::Result::fail(juce::translate("The options file FLNM cannot be parsed!").replace("FLNM", optionsFile.getFileName()));
+            fail(result.getErrorMessage());
+        }
+
+        options = XmlParser::fromXml(*xml, "exportOptions", options);
+    }
+    else if(!args.containsOption("-f|--format"))
+    {
+        fail("Format not specified! Available formats are jpeg, png, csv, lab, json, cue, reaper, puredata, max, sdif, npy or npz.");
+    }
+    else if(format == "jpeg" || format == "png")
+    {
+        if(!args.containsOption("--width"))
+        {
+            fail("Width not specified! Specify the width of the image in pixels.");
+        }
+        if(!args.containsOption("--height"))
+        {
+            fail("Height not specified! Specify the height of the image in pixels.");
+        }
+
+        options.format = format == "jpeg" ? Options::Format::jpeg : Options::Format::png;
+        options.imageWidth = args.getValueForOption("--width").getIntValue();
+        options.imageHeight = args.getValueForOption("--height").getIntValue();
+        options.imagePpi = args.containsOption("--ppi") ? args.getValueForOption("--ppi").getIntValue() : 72;
+        useGroupOverview = args.containsOption("--groups");
+    }
+    else if(format == "csv" || format == "lab" || format == "json" || format == "cue" || format == "reaper" || format == "sdif" || format == "puredata" || format == "max" || format == "npy" || format == "npz")
+    {
+        if(format == "csv")
+        {
+            options.format = Options::Format::csv;
+        }
+        else if(format == "lab")
+        {
+            options.format = Options::Format::lab;
+        }
+        else if(format == "json")
+        {
+            options.format = Options::Format::json;
+        }
+        else if(format == "cue")
+        {
+            options.format = Options::Format::cue;
+        }
+        else if(format == "reaper")
+        {
+            options.format = Options::Format::reaper;
+        }
+        else if(format == "puredata")
+        {
+            options.format = Options::Format::puredata;
+        }
+        else if(format == "max")
+        {
+            options.format = Options::Format::max;
+        }
+        else if(format == "npy")
+        {
+            options.format = Options::Format::npy;
+        }
+        else if(format == "npz")
+        {
+            options.format = Options::Format::npz;
+        }
+        else
+        {
+            options.format = Options::Format::sdif;
+            if(!args.containsOption("--frame"))
+            {
+                fail("Frame signature not specified! Specifiy the frame signature of the SDIf file.");
+            }
+            if(!args.containsOption("--matrix"))
+            {
+                fail("Matrix signature not specified! Specifiy the matrix signature of the SDIf file.");
+            }
+        }
+        ignoreGridResults = args.containsOption("--nogrids");
+        if(args.containsOption("--header"))
+        {
+            auto const header = args.getValueForOption("--header");
+            auto const csvHeader = magic_enum::enum_cast<Document::Exporter::Options::CsvHeaderType>(header.toStdString());
+            if(csvHeader.has_value())
+            {
+                options.csvHeaderType = csvHeader.value();
+            }
+            else
+            {
+                fail("Header '" + header + "' unsupported! Available headers are none, generic, or specific.");
+            }
+        }
+        else
+        {
+            options.csvHeaderType = Document::Exporter::Options::CsvHeaderType::none;
+        }
+        options.includeDescription = args.containsOption("--description");
+        options.applyExtraThresholds = args.containsOption("--thresholds");
+        options.disableLabelEscaping = args.containsOption("--noescape");
+        options.reaperType = args.getValueForOption("--reapertype").toLowerCase() == "marker" ? Options::ReaperType::marker : Options::ReaperType::region;
+        options.sdifFrameSignature = args.getValueForOption("--frame").removeCharacters("\"").toUpperCase();
+        options.sdifMatrixSignature = args.getValueForOption("--matrix").removeCharacters("\"").toUpperCase();
+        options.sdifColumnName = args.getValueForOption("--colname");
+        auto const separator = magic_enum::enum_cast<Document::Exporter::Options::ColumnSeparator>(args.getValueForOption("--separator").toStdString());
+        if(separator.has_value())
+        {
+            options.columnSeparator = *separator;
+            options.labSeparator = *separator;
+        }
+    }
+    else
+    {
+        fail("Format '" + format + "' unsupported! Available formats are jpeg, png, csv, lab, json, cue, reaper, puredata, max, sdif, npy or npz.");
+    }
+
+    options.useAutoSize = false;
+    return {options, useGroupOverview, ignoreGridResults};
+}
+
+void Application::CommandLine::exportFiles(juce::Array<juce::File> const& files, juce::File const& templateFile, juce::File const& outputDir, bool adaptToSampleRate, Document::Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults, size_t numJobs, juce::File const& summaryFile, bool incremental, juce::File const& profileFile, size_t memoryBudget)
+{
+    if(files.isEmpty())
+    {
+        fail("No audio file found!");
+    }
+
+    // The template is parsed once and copied in the document of each audio file
+    Document::Accessor templateAcsr;
+    auto const templateResult = Document::Executor::parseTemplate(templateFile, templateAcsr);
+    if(templateResult.failed())
+    {
+        fail(templateResult.getErrorMessage());
+    }
+
+    // The files that cannot be loaded are reported without being processed
+    std::vector<Document::Batcher::Report> failedReports;
+    std::vector<std::vector<AudioFileLayout>> readers;
+    for(auto const& file : files)
+    {
+        Document::Batcher::Report report;
+        report.reader = {AudioFileLayout(file)};
+        if(!file.existsAsFile())
+        {
+            report.result = juce::Result::fail("Could not find file: " + file.getFullPathName());
+            failedReports.push_back(std::move(report));
+        }
+        else if(mAudioFormatManager.findFormatForFileExtension(file.getFileExtension()) == nullptr)
+        {
+            report.result = juce::Result::fail(juce::translate("The audio file FLNM is not supported!").replace("FLNM", file.getFileName()));
+            failedReports.push_back(std::move(report));
+        }
+        else
+        {
+            readers.push_back(getAudioFileLayouts(mAudioFormatManager, juce::Array<juce::File>{file}, AudioFileLayout::ChannelLayout::split));
+        }
+    }
+
+    Document::Batcher::Selection selection;
+    selection.useGroupOverview = useGroupOverview;
+    selection.ignoreGridResults = ignoreGridResults;
+    mBatcher = std::make_unique<Document::Batcher>(templateAcsr, mAudioFormatManager, adaptToSampleRate, Document::Template::AdaptationRule::unconstrainedSizes, selection, options, incremental, memoryBudget);
+    auto const startTime = juce::Time::getHighResolutionTicks();
+    mBatcher->onEnded = [=, this]()
+    {
+        auto reports = failedReports;
+        auto const& batcherReports = mBatcher->getReports();
+        reports.insert(reports.end(), batcherReports.cbegin(), batcherReports.cend());
+        if(profileFile != juce::File{})
+        {
+            auto files = nlohmann::json::array();
+            for(auto const& report : batcherReports)
+            {
+                auto entry = report.profile.is_object() ? report.profile : nlohmann::json::object();
+                entry["input"] = report.reader.empty() ? std::string{} : report.reader.front().file.getFullPathName().toStdString();
+                files.push_back(std::move(entry));
+            }
+            auto profile = nlohmann::json::object();
+            profile["duration"] = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime);
+            profile["files"] = std::move(files);
+            writeProfile(profileFile, profile);
+        }
+        endTrace();
+        juce::LookAndFeel::setDefaultLookAndFeel(nullptr);
+        mLookAndFeel.reset();
+
+        auto const summary = getSummary(reports).dump(4);
+        if(summaryFile == juce::File{})
+        {
+            std::cout << summary << std::endl;
+        }
+        else if(summaryFile.getParentDirectory().createDirectory().failed() || !summaryFile.replaceWithText(summary))
+        {
+            std::cerr << "Could not write file: " << summaryFile.getFullPathName() << std::endl;
+        }
+
+        auto failed = false;
+        for(auto const& report : reports)
+        {
+            if(report.result.failed())
+            {
+                failed = true;
+                std::cerr << report.reader.front().file.getFileName() << ": " << report.result.getErrorMessage() << std::endl;
+            }
+        }
+        mShouldWait = false;
+        sendQuitSignal(failed ? 1 : 0);
+    };
+
+    mLookAndFeel = std::make_unique<LookAndFeel>();
+    juce::LookAndFeel::setDefaultLookAndFeel(mLookAndFeel.get());
+    mShouldWait = true;
+    mBatcher->launch(readers, outputDir, numJobs);
+}
+
+void Application::CommandLine::startTrace(juce::ArgumentList const& args)
+{
+    mTraceFile = args.containsOption("--trace") ? args.getFileForOption("--trace") : juce::File{};
+    Tracer::setEnabled(mTraceFile != juce::File{});
+}
+
+void Application::CommandLine::endTrace()
+{
+    if(mTraceFile == juce::File{})
+    {
+        return;
+    }
+    Tracer::setEnabled(false);
+    auto const result = Tracer::writeTo(mTraceFile);
+    if(result.failed())
+    {
+        std::cerr << result.getErrorMessage() << std::endl;
+    }
+    mTraceFile = juce::File{};
 }
 
 void Application::CommandLine::sendQuitSignal(int value)
@@ -1,11 +1,15 @@
 #pragma once
 
-#include "../Document/AnlDocumentExecutor.h"
+#include "../Document/AnlDocumentBatcher.h"
 
 ANALYSE_FILE_BEGIN
 
 namespace Application
 {
+    class Benchmark;
+    class LookAndFeel;
+    class Server;
+
     class CommandLine
     : public juce::ConsoleApplication
     {
@@ -15,15 +19,30 @@ namespace Application
 
         bool isRunning() const;
 
+        //! @brief Parses the export options of the command line.
+        //! @details Returns the export options and the flags to use the group overviews and to ignore the grid results.
+        static std::tuple<Document::Exporter::Options, bool, bool> parseExportOptions(juce::ArgumentList const& args);
+
         static std::unique_ptr<CommandLine> createAndRun(juce::String const& commandLine);
 
     private:
         void runUnitTests();
         void compareFiles(juce::ArgumentList const& args);
 
+        void exportFiles(juce::Array<juce::File> const& files, juce::File const& templateFile, juce::File const& outputDir, bool adaptToSampleRate, Document::Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults, size_t numJobs, juce::File const& summaryFile, bool incremental, juce::File const& profileFile, size_t memoryBudget);
+
+        void startTrace(juce::ArgumentList const& args);
+        void endTrace();
+
         static void sendQuitSignal(int value);
 
         std::unique_ptr<Document::Executor> mExecutor;
+        juce::AudioFormatManager mAudioFormatManager;
+        std::unique_ptr<Document::Batcher> mBatcher;
+        std::unique_ptr<Server> mServer;
+        std::unique_ptr<Benchmark> mBenchmark;
+        std::unique_ptr<LookAndFeel> mLookAndFeel;
+        juce::File mTraceFile;
         bool mShouldWait{false};
     };
 } // namespace Application
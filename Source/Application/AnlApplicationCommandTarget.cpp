@@ -38,6 +38,9 @@ Application::CommandTarget::CommandTarget()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
         }
     };
@@ -192,6 +195,7 @@ void Application::CommandTarget::getAllCommands(juce::Array<juce::CommandID>& co
         , CommandIDs::helpAutoUpdate
         , CommandIDs::helpCheckForUpdate
         , CommandIDs::helpOpenKeyMappings
+        , CommandIDs::helpOpenProfile
     });
     // clang-format on
     Instance::get().getAllCommands(commands);
@@ -728,6 +732,12 @@ void Application::CommandTarget::getCommandInfo(juce::CommandID const commandID,
             result.setActive(true);
             break;
         }
+        case CommandIDs::helpOpenProfile:
+        {
+            result.setInfo(juce::translate("Profile..."), juce::translate("Shows the durations of the stages and the memory used by the tracks"), "Help", 0);
+            result.setActive(true);
+            break;
+        }
     }
 
     Instance::get().getCommandInfo(commandID, result);
@@ -768,7 +778,7 @@ bool Application::CommandTarget::perform(juce::ApplicationCommandTarget::Invocat
         auto const options = Instance::get().getApplicationAccessor().getAttr<AttrType::exportOptions>();
         if(!std::get<0_z>(selectedItems).empty())
         {
-            auto const groupResult = Document::Exporter::exportTo(documentAcsr, fileOrDirectory, selection, std::set<size_t>{}, prefix, std::get<0_z>(selectedItems), options, mShouldAbort);
+            auto const groupResult = Document::Exporter::exportTo(documentAcsr, fileOrDirectory, selection, std::set<size_t>{}, prefix, std::get<0_z>(selectedItems), options, true, mShouldAbort);
             MiscWeakAssert(groupResult.wasOk());
             if(groupResult.failed())
             {
@@ -777,7 +787,7 @@ bool Application::CommandTarget::perform(juce::ApplicationCommandTarget::Invocat
         }
         if(!std::get<1_z>(selectedItems).empty())
         {
-            auto const trackResult = Document::Exporter::exportTo(documentAcsr, fileOrDirectory, selection, std::set<size_t>{}, prefix, std::get<1_z>(selectedItems), options, mShouldAbort);
+            auto const trackResult = Document::Exporter::exportTo(documentAcsr, fileOrDirectory, selection, std::set<size_t>{}, prefix, std::get<1_z>(selectedItems), options, true, mShouldAbort);
             MiscWeakAssert(trackResult.wasOk());
             if(trackResult.failed())
             {
@@ -1365,7 +1375,7 @@ bool Application::CommandTarget::perform(juce::ApplicationCommandTarget::Invocat
                                                      auto const& fd = trackAcsr.getAttr<Track::AttrType::fileDescription>();
                                                      if(!fd.isEmpty() && fd.format != Track::FileDescription::Format::binary)
                                                      {
-                                                         auto const trackResult = Document::Exporter::exportTo(lDocumentAcsr, fd.file, exportSelection, std::set<size_t>{}, "", trackId, Document::Exporter::Options(fd), mShouldAbort);
+                                                         auto const trackResult = Document::Exporter::exportTo(lDocumentAcsr, fd.file, exportSelection, std::set<size_t>{}, "", trackId, Document::Exporter::Options(fd), true, mShouldAbort);
                                                          MiscWeakAssert(trackResult.wasOk());
                                                          if(trackResult.failed())
                                                          {
@@ -1646,6 +1656,14 @@ bool Application::CommandTarget::perform(juce::ApplicationCommandTarget::Invocat
             }
             return true;
         }
+        case CommandIDs::helpOpenProfile:
+        {
+            if(auto* window = Instance::get().getWindow())
+            {
+                window->getInterface().showProfilePanel();
+            }
+            return true;
+        }
     }
     return Instance::get().perform(info);
 }
@@ -165,6 +165,9 @@ Application::ConverterContent::ConverterContent()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
             case AttrType::autoLoadConvertedFile:
             {
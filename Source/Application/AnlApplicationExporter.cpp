@@ -57,6 +57,9 @@ Application::ExporterContent::ExporterContent()
             case AttrType::globalGraphicPreset:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
             case AttrType::exportOptions:
             {
@@ -135,7 +138,7 @@ void Application::ExporterContent::exportToFile()
                                   mProcess = std::async([=, this, file = results.getFirst()]() -> ProcessResult
                                                         {
                                                             juce::Thread::setCurrentThreadName("ExporterContent");
-                                                            auto const result = Document::Exporter::exportTo(Instance::get().getDocumentAccessor(), file, timeRange, {}, "", identifiers, options, mShoulAbort);
+                                                            auto const result = Document::Exporter::exportTo(Instance::get().getDocumentAccessor(), file, timeRange, {}, "", identifiers, options, true, mShoulAbort);
                                                             triggerAsyncUpdate();
                                                             if(result.failed())
                                                             {
@@ -127,6 +127,9 @@ Application::GraphicPresetContent::GraphicPresetContent()
             case AttrType::timeZoomAnchorOnPlayhead:
             case AttrType::ignoreTimeSelectionDuringQuickExport:
             case AttrType::preserveFullDurationWhenEditing:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
+            case AttrType::compactConsolidation:
                 break;
         }
     };
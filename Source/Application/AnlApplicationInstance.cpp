@@ -124,6 +124,8 @@ void Application::Instance::initialise(juce::String const& commandLine)
             case AttrType::lastVersion:
             case AttrType::timeZoomAnchorOnPlayhead:
             case AttrType::globalGraphicPreset:
+            case AttrType::batchNumJobs:
+            case AttrType::batchIncremental:
                 break;
             case AttrType::currentTranslationFile:
             {
@@ -166,6 +168,12 @@ void Application::Instance::initialise(juce::String const& commandLine)
                 mDocumentDirector->setPreserveFullDurationWhenEditing(acsr.getAttr<AttrType::preserveFullDurationWhenEditing>());
                 break;
             }
+            case AttrType::compactConsolidation:
+            {
+                updateMainMenu();
+                mDocumentFileBased->setUseCompactConsolidation(acsr.getAttr<AttrType::compactConsolidation>());
+                break;
+            }
         }
     };
     mApplicationAccessor->addListener(*mApplicationListener.get(), NotificationType::synchronous);
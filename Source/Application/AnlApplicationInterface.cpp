@@ -311,6 +311,7 @@ Application::Interface::Interface()
                              , std::ref<HideablePanel>(mReaderLayoutPanel)
                              , std::ref<HideablePanel>(mDocumentFileInfoPanel)
                              , std::ref<HideablePanel>(mKeyMappingsPanel)
+                             , std::ref<HideablePanel>(mProfilePanel)
                              });
     // clang-format on
     mDocumentReceiver.onSignal = [this]([[maybe_unused]] Document::Accessor const& acsr, Document::SignalType signal, [[maybe_unused]] juce::var value)
@@ -417,6 +418,11 @@ void Application::Interface::showKeyMappingsPanel()
     mPanelManager.show(mKeyMappingsPanel);
 }
 
+void Application::Interface::showProfilePanel()
+{
+    mPanelManager.show(mProfilePanel);
+}
+
 void Application::Interface::showPluginListTablePanel()
 {
     mDocumentContainer.showPluginListTablePanel();
@@ -12,6 +12,7 @@
 #include "AnlApplicationGraphicPreset.h"
 #include "AnlApplicationKeyMappings.h"
 #include "AnlApplicationLoader.h"
+#include "AnlApplicationProfile.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -42,6 +43,7 @@ namespace Application
         void showReaderLayoutPanel();
         void showDocumentFileInfoPanel();
         void showKeyMappingsPanel();
+        void showProfilePanel();
         void showTrackLoaderPanel();
 
         void showPluginListTablePanel();
@@ -170,6 +172,7 @@ namespace Application
         ReaderLayoutPanel mReaderLayoutPanel;
         Document::FileInfoPanel mDocumentFileInfoPanel;
         KeyMappingsPanel mKeyMappingsPanel;
+        ProfilePanel mProfilePanel;
         HideablePanelManager mPanelManager;
     };
 } // namespace Application
@@ -167,6 +167,7 @@ juce::PopupMenu Application::MainMenuModel::getMenuForIndex(int topLevelMenuInde
         menu.addCommandItem(&commandManager, CommandIDs::helpCheckForUpdate);
         menu.addSeparator();
         menu.addCommandItem(&commandManager, CommandIDs::helpSdifConverter);
+        menu.addCommandItem(&commandManager, CommandIDs::helpOpenProfile);
     }
     else
     {
@@ -199,6 +200,11 @@ void Application::MainMenuModel::addGlobalSettingsMenu(juce::PopupMenu& menu)
                                {
                                    Instance::get().getApplicationAccessor().setAttr<AttrType::preserveFullDurationWhenEditing>(!Instance::get().getApplicationAccessor().getAttr<AttrType::preserveFullDurationWhenEditing>(), NotificationType::synchronous);
                                });
+    auto const compactConsolidation = accessor.getAttr<AttrType::compactConsolidation>();
+    globalSettingsMenu.addItem(juce::translate("Compact Consolidated Results"), true, compactConsolidation, []()
+                               {
+                                   Instance::get().getApplicationAccessor().setAttr<AttrType::compactConsolidation>(!Instance::get().getApplicationAccessor().getAttr<AttrType::compactConsolidation>(), NotificationType::synchronous);
+                               });
     juce::PopupMenu templateMenu;
     auto const templateFile = accessor.getAttr<AttrType::defaultTemplateFile>();
     templateMenu.addItem(juce::translate("None"), true, !templateFile.existsAsFile(), []()
@@ -40,6 +40,9 @@ namespace Application
         , globalGraphicPreset
         , ignoreTimeSelectionDuringQuickExport
         , preserveFullDurationWhenEditing
+        , batchNumJobs
+        , batchIncremental
+        , compactConsolidation
     };
     
     enum class AcsrType : size_t
@@ -68,6 +71,9 @@ namespace Application
     , Model::Attr<AttrType::globalGraphicPreset, Track::GraphicsSettings, Model::Flag::basic>
     , Model::Attr<AttrType::ignoreTimeSelectionDuringQuickExport, bool, Model::Flag::basic>
     , Model::Attr<AttrType::preserveFullDurationWhenEditing, bool, Model::Flag::basic>
+    , Model::Attr<AttrType::batchNumJobs, int, Model::Flag::basic>
+    , Model::Attr<AttrType::batchIncremental, bool, Model::Flag::basic>
+    , Model::Attr<AttrType::compactConsolidation, bool, Model::Flag::basic>
     >;
     
     using AcsrContainer = Model::Container
@@ -104,6 +110,9 @@ namespace Application
             , {}
             , {false}
             , {false}
+            , {static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u))}
+            , {false}
+            , {false}
         }))
         {
         }
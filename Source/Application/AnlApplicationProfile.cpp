@@ -0,0 +1,177 @@
+#include "AnlApplicationProfile.h"
+#include "../Document/AnlDocumentTools.h"
+#include "AnlApplicationInstance.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    juce::String getStageLabel(Track::Profiler::Stage stage)
+    {
+        switch(stage)
+        {
+            case Track::Profiler::Stage::reading:
+                return juce::translate("Reading");
+            case Track::Profiler::Stage::processing:
+                return juce::translate("Processing");
+            case Track::Profiler::Stage::converting:
+                return juce::translate("Converting");
+            case Track::Profiler::Stage::loading:
+                return juce::translate("Loading");
+            case Track::Profiler::Stage::rendering:
+                return juce::translate("Rendering");
+            case Track::Profiler::Stage::exporting:
+                return juce::translate("Exporting");
+        }
+        return {};
+    }
+} // namespace
+
+Application::ProfileContent::Container::Section::Content::Content()
+{
+    for(auto const stage : magic_enum::enum_values<Track::Profiler::Stage>())
+    {
+        auto property = std::make_unique<PropertyLabel>(getStageLabel(stage), juce::translate("The duration of the stage in milliseconds"));
+        addAndMakeVisible(property.get());
+        mProperties.push_back(std::move(property));
+    }
+    auto property = std::make_unique<PropertyLabel>(juce::translate("Memory"), juce::translate("The peak memory used by the results"));
+    addAndMakeVisible(property.get());
+    mProperties.push_back(std::move(property));
+}
+
+void Application::ProfileContent::Container::Section::Content::resized()
+{
+    auto bounds = getLocalBounds().withHeight(std::numeric_limits<int>::max());
+    auto const setBounds = [&](juce::Component* component)
+    {
+        if(component != nullptr && component->isVisible())
+        {
+            component->setBounds(bounds.removeFromTop(component->getHeight()));
+        }
+    };
+    for(auto& property : mProperties)
+    {
+        setBounds(property.get());
+    }
+    setSize(getWidth(), bounds.getY());
+}
+
+void Application::ProfileContent::Container::Section::Content::setSummary(Track::Profiler::Summary const& summary)
+{
+    MiscWeakAssert(mProperties.size() == summary.durations.size() + 1_z);
+    for(auto index = 0_z; index < std::min(mProperties.size(), summary.durations.size()); ++index)
+    {
+        mProperties[index]->entry.setText(juce::String(summary.durations[index] * 1000.0, 1) + " ms", juce::NotificationType::dontSendNotification);
+    }
+    if(!mProperties.empty())
+    {
+        mProperties.back()->entry.setText(juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(summary.peakMemory)), juce::NotificationType::dontSendNotification);
+    }
+}
+
+Application::ProfileContent::Container::Section::Section(juce::String const& name)
+: table(name.toUpperCase(), true)
+{
+    table.setComponents({content});
+}
+
+Application::ProfileContent::Container::Container()
+{
+    mComponentListener.onComponentResized = [&]([[maybe_unused]] juce::Component& component)
+    {
+        resized();
+    };
+}
+
+Application::ProfileContent::Container::~Container()
+{
+    for(auto& section : mSections)
+    {
+        mComponentListener.detachFrom(section->table);
+    }
+    mSections.clear();
+}
+
+void Application::ProfileContent::Container::resized()
+{
+    auto bounds = getLocalBounds().withHeight(std::numeric_limits<int>::max());
+    auto const setBounds = [&](juce::Component& component)
+    {
+        if(component.isVisible())
+        {
+            component.setBounds(bounds.removeFromTop(component.getHeight()));
+        }
+    };
+    for(auto& section : mSections)
+    {
+        setBounds(section->table);
+    }
+    setSize(getWidth(), std::max(bounds.getY(), 120) + 2);
+}
+
+void Application::ProfileContent::Container::update()
+{
+    auto& documentDirector = Instance::get().getDocumentDirector();
+    auto const& documentAcsr = Instance::get().getDocumentAccessor();
+    auto const identifiers = Document::Tools::getEffectiveTrackIdentifiers(documentAcsr);
+    if(identifiers != mIdentifiers)
+    {
+        // The sections are created again only if the tracks have changed to preserve the state of the tables
+        for(auto& section : mSections)
+        {
+            mComponentListener.detachFrom(section->table);
+        }
+        mSections.clear();
+        mIdentifiers = identifiers;
+        for(auto const& identifier : mIdentifiers)
+        {
+            auto const& trackAcsr = Document::Tools::getTrackAcsr(documentAcsr, identifier);
+            auto section = std::make_unique<Section>(trackAcsr.getAttr<Track::AttrType::name>());
+            addAndMakeVisible(section->table);
+            mComponentListener.attachTo(section->table);
+            mSections.push_back(std::move(section));
+        }
+        resized();
+    }
+    MiscWeakAssert(mSections.size() == mIdentifiers.size());
+    for(auto index = 0_z; index < std::min(mSections.size(), mIdentifiers.size()); ++index)
+    {
+        mSections[index]->content.setSummary(documentDirector.getTrackDirector(mIdentifiers[index]).getProfiler().getSummary());
+    }
+}
+
+Application::ProfileContent::ProfileContent()
+{
+    setSize(320, 400);
+    mContainer.setSize(getWidth() - mViewport.getScrollBarThickness(), 400);
+    mViewport.setViewedComponent(std::addressof(mContainer), false);
+    addAndMakeVisible(mViewport);
+    startTimer(500);
+}
+
+Application::ProfileContent::~ProfileContent()
+{
+    stopTimer();
+}
+
+void Application::ProfileContent::resized()
+{
+    mViewport.setBounds(getLocalBounds());
+}
+
+void Application::ProfileContent::timerCallback()
+{
+    // The profiles are only updated while the panel is shown
+    if(isShowing())
+    {
+        mContainer.update();
+    }
+}
+
+Application::ProfilePanel::ProfilePanel()
+: HideablePanelTyped<ProfileContent>(juce::translate("Profile"))
+{
+}
+
+ANALYSE_FILE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../Track/AnlTrackProfiler.h"
+#include "AnlApplicationModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Application
+{
+    //! @brief Shows the durations of the stages and the peak memory of the results of the tracks of the document.
+    class ProfileContent
+    : public juce::Component
+    , private juce::Timer
+    {
+    public:
+        ProfileContent();
+        ~ProfileContent() override;
+
+        // juce::Component
+        void resized() override;
+
+    private:
+        class Container
+        : public juce::Component
+        {
+        public:
+            Container();
+            ~Container() override;
+
+            // juce::Component
+            void resized() override;
+
+            void update();
+
+        private:
+            struct Section
+            {
+            public:
+                Section(juce::String const& name);
+                ~Section() = default;
+
+                class Content
+                : public juce::Component
+                {
+                public:
+                    Content();
+                    ~Content() override = default;
+
+                    void resized() override;
+                    void setSummary(Track::Profiler::Summary const& summary);
+
+                private:
+                    std::vector<std::unique_ptr<PropertyLabel>> mProperties;
+                };
+
+                Content content;
+                ConcertinaTable table;
+            };
+
+            ComponentListener mComponentListener;
+            std::vector<juce::String> mIdentifiers;
+            std::vector<std::unique_ptr<Section>> mSections;
+        };
+
+        // juce::Timer
+        void timerCallback() override;
+
+        Container mContainer;
+        juce::Viewport mViewport;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProfileContent)
+    };
+
+    class ProfilePanel
+    : public HideablePanelTyped<ProfileContent>
+    {
+    public:
+        ProfilePanel();
+        ~ProfilePanel() override = default;
+    };
+} // namespace Application
+
+ANALYSE_FILE_END
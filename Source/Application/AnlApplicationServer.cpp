@@ -0,0 +1,351 @@
+#include "AnlApplicationServer.h"
+#include "AnlApplicationCommandLine.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    nlohmann::json getMessages(AlertWindow::Catcher const& catcher)
+    {
+        auto messages = nlohmann::json::array();
+        for(auto const& message : catcher.getMessages())
+        {
+            auto const type = juce::String(std::string(magic_enum::enum_name(std::get<0>(message.first)))).toUpperCase();
+            for(auto const& text : message.second)
+            {
+                messages.push_back((type + " - " + std::get<1>(message.first) + ": " + text).toStdString());
+            }
+        }
+        return messages;
+    }
+} // namespace
+
+Application::Server::Server(size_t numExecutors)
+{
+    mAudioFormatManager.registerBasicFormats();
+    for(auto index = 0_z; index < std::max(numExecutors, 1_z); ++index)
+    {
+        auto slot = std::make_unique<Slot>();
+        slot->executor = std::make_unique<Document::Executor>(mAudioFormatManager);
+        slot->executor->onProgress = [this, slotPtr = slot.get()](float progress)
+        {
+            auto const percent = static_cast<int>(std::round(progress * 100.0f));
+            if(slotPtr->job.has_value() && percent != slotPtr->progress)
+            {
+                slotPtr->progress = percent;
+                send({{"id", slotPtr->job->id}, {"status", "progress"}, {"progress", static_cast<double>(percent) / 100.0}});
+            }
+        };
+        slot->executor->onEnded = [this, slotPtr = slot.get()]()
+        {
+            exportJob(*slotPtr);
+        };
+        mSlots.push_back(std::move(slot));
+    }
+
+    mInput->updater = this;
+    std::thread([input = mInput]()
+                {
+                    juce::Thread::setCurrentThreadName("Server");
+                    std::string line;
+                    while(std::getline(std::cin, line))
+                    {
+                        std::lock_guard<std::mutex> lock(input->mutex);
+                        input->lines.push_back(line);
+                        if(input->updater != nullptr)
+                        {
+                            input->updater->triggerAsyncUpdate();
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(input->mutex);
+                    input->ended = true;
+                    if(input->updater != nullptr)
+                    {
+                        input->updater->triggerAsyncUpdate();
+                    }
+                })
+        .detach();
+}
+
+Application::Server::~Server()
+{
+    {
+        std::lock_guard<std::mutex> lock(mInput->mutex);
+        mInput->updater = nullptr;
+    }
+    mShouldAbort.store(true);
+    for(auto& slot : mSlots)
+    {
+        if(slot->exportProcess.valid())
+        {
+            slot->exportProcess.get();
+        }
+    }
+    cancelPendingUpdate();
+}
+
+bool Application::Server::isRunning() const
+{
+    return mIsRunning;
+}
+
+std::variant<Application::Server::Job, juce::Result> Application::Server::parseJob(nlohmann::json const& json) const
+{
+    // The keys of the job are converted to the arguments of the export command line
+    juce::StringArray arguments;
+    for(auto it = json.cbegin(); it != json.cend(); ++it)
+    {
+        auto const option = "--" + juce::String(it.key());
+        auto const& value = it.value();
+        if(it.key() == "id")
+        {
+            continue;
+        }
+        else if(value.is_boolean())
+        {
+            if(value.get<bool>())
+            {
+                arguments.add(option);
+            }
+        }
+        else if(value.is_string())
+        {
+            arguments.add(option + "=" + juce::String(value.get<std::string>()));
+        }
+        else if(value.is_number())
+        {
+            arguments.add(option + "=" + juce::String(value.dump()));
+        }
+        else
+        {
+            return juce::Result::fail("Invalid value for key: " + juce::String(it.key()));
+        }
+    }
+
+    juce::ArgumentList const args("Partiels", arguments);
+    try
+    {
+        Job job;
+        job.id = json.contains("id") ? json.at("id") : nlohmann::json();
+        std::tie(job.options, job.useGroupOverview, job.ignoreGridResults) = CommandLine::parseExportOptions(args);
+        job.options.useAutoSize = false;
+        job.outputDir = args.getFileForOption("-o|--output");
+        auto const result = job.outputDir.createDirectory();
+        if(result.failed())
+        {
+            return result;
+        }
+        if(args.containsOption("-d|--document"))
+        {
+            job.document = args.getExistingFileForOption("-d|--document");
+        }
+        else
+        {
+            job.input = args.getExistingFileForOption("-i|--input");
+            job.templateFile = args.getExistingFileForOption("-t|--template");
+            job.adaptToSampleRate = args.containsOption("--adapt");
+        }
+        return job;
+    }
+    catch(juce::ConsoleAppFailureCode const& failure)
+    {
+        return juce::Result::fail(failure.errorMessage);
+    }
+}
+
+std::variant<Document::Template*, juce::Result> Application::Server::getTemplate(juce::File const& templateFile)
+{
+    // The templates are parsed and prepared once and parsed again only if the files have been modified
+    auto const path = templateFile.getFullPathName();
+    auto const time = templateFile.getLastModificationTime();
+    auto const it = mTemplates.find(path);
+    if(it != mTemplates.cend() && std::get<0_z>(it->second) == time)
+    {
+        return std::get<1_z>(it->second).get();
+    }
+
+    Document::Accessor accessor;
+    auto const result = Document::Executor::parseTemplate(templateFile, accessor);
+    if(result.failed())
+    {
+        mTemplates.erase(path);
+        return result;
+    }
+    auto documentTemplate = std::make_unique<Document::Template>(accessor);
+    auto* templatePtr = documentTemplate.get();
+    mTemplates[path] = std::make_tuple(time, std::move(documentTemplate));
+    return templatePtr;
+}
+
+void Application::Server::startJob(Slot& slot, Job job)
+{
+    slot.job = std::move(job);
+    slot.progress = -1;
+    auto const& currentJob = *slot.job;
+    auto& executor = *slot.executor.get();
+    send({{"id", currentJob.id}, {"status", "started"}});
+
+    auto result = juce::Result::ok();
+    if(currentJob.document != juce::File{})
+    {
+        result = executor.load(currentJob.document);
+    }
+    else if(mAudioFormatManager.findFormatForFileExtension(currentJob.input.getFileExtension()) == nullptr)
+    {
+        result = juce::Result::fail(juce::translate("The audio file FLNM is not supported!").replace("FLNM", currentJob.input.getFileName()));
+    }
+    else
+    {
+        auto const documentTemplate = getTemplate(currentJob.templateFile);
+        if(documentTemplate.index() == 1_z)
+        {
+            result = std::get<1_z>(documentTemplate);
+        }
+        else
+        {
+            auto const reader = getAudioFileLayouts(mAudioFormatManager, juce::Array<juce::File>{currentJob.input}, AudioFileLayout::ChannelLayout::split);
+            result = executor.load(reader, *std::get<0_z>(documentTemplate), currentJob.adaptToSampleRate);
+        }
+    }
+    if(result.wasOk())
+    {
+        result = executor.launch();
+    }
+    if(result.failed())
+    {
+        endJob(slot, result, {});
+    }
+}
+
+void Application::Server::exportJob(Slot& slot)
+{
+    MiscWeakAssert(slot.job.has_value() && !slot.exportProcess.valid());
+    if(!slot.job.has_value() || slot.exportProcess.valid())
+    {
+        return;
+    }
+    auto const job = *slot.job;
+    // The identifiers are retrieved and the files are claimed on the message thread once the analyses have ended
+    // so the concurrent jobs that export to the same directory never use the same files
+    std::vector<std::tuple<juce::String, juce::File>> files;
+    for(auto const& identifier : slot.executor->getExportIdentifiers(job.options, job.useGroupOverview, job.ignoreGridResults))
+    {
+        auto const file = Document::Exporter::reserveFile(job.outputDir, slot.executor->getExportFileName("", identifier, job.options), mClaimedFiles);
+        slot.claimedFiles.push_back(file);
+        files.push_back({identifier, file});
+    }
+    slot.exportEnded.store(false);
+    slot.exportProcess = std::async(std::launch::async, [this, &slot, job, files]()
+                                    {
+                                        juce::Thread::setCurrentThreadName("Server");
+                                        auto result = files.empty() ? juce::Result::fail(juce::translate("No results to export")) : juce::Result::ok();
+                                        juce::Array<juce::File> exportedFiles;
+                                        for(auto const& [identifier, file] : files)
+                                        {
+                                            result = slot.executor->exportTo(file, identifier, job.options, mShouldAbort);
+                                            if(result.failed())
+                                            {
+                                                break;
+                                            }
+                                            exportedFiles.add(file);
+                                        }
+                                        exportedFiles.sort();
+                                        slot.exportEnded.store(true);
+                                        triggerAsyncUpdate();
+                                        return std::make_tuple(result, exportedFiles);
+                                    });
+}
+
+void Application::Server::endJob(Slot& slot, juce::Result const& result, juce::Array<juce::File> const& files)
+{
+    auto response = nlohmann::json::object();
+    response["id"] = slot.job.has_value() ? slot.job->id : nlohmann::json();
+    response["status"] = result.wasOk() ? "succeeded" : "failed";
+    if(result.failed())
+    {
+        response["error"] = result.getErrorMessage().toStdString();
+    }
+    auto paths = nlohmann::json::array();
+    for(auto const& file : files)
+    {
+        paths.push_back(file.getFullPathName().toStdString());
+    }
+    response["files"] = std::move(paths);
+    response["messages"] = getMessages(slot.executor->getAlertCatcher());
+    send(response);
+    slot.job.reset();
+}
+
+void Application::Server::send(nlohmann::json const& json) const
+{
+    std::cout << json.dump() << std::endl;
+}
+
+void Application::Server::handleAsyncUpdate()
+{
+    std::vector<std::string> lines;
+    auto inputEnded = false;
+    {
+        std::lock_guard<std::mutex> lock(mInput->mutex);
+        lines.swap(mInput->lines);
+        inputEnded = mInput->ended;
+    }
+
+    for(auto const& line : lines)
+    {
+        if(juce::String(line).trim().isEmpty())
+        {
+            continue;
+        }
+        auto const json = nlohmann::json::parse(line, nullptr, false);
+        if(json.is_discarded() || !json.is_object())
+        {
+            send({{"id", nullptr}, {"status", "failed"}, {"error", "Invalid job: " + line}});
+            continue;
+        }
+        auto job = parseJob(json);
+        if(job.index() == 1_z)
+        {
+            send({{"id", json.contains("id") ? json.at("id") : nlohmann::json()}, {"status", "failed"}, {"error", std::get<1_z>(job).getErrorMessage().toStdString()}});
+            continue;
+        }
+        send({{"id", std::get<0_z>(job).id}, {"status", "queued"}});
+        mPendingJobs.push_back(std::move(std::get<0_z>(job)));
+    }
+
+    for(auto& slot : mSlots)
+    {
+        if(slot->exportProcess.valid() && slot->exportEnded.load())
+        {
+            auto const exportResult = slot->exportProcess.get();
+            // The exported files exist so the claims can be released
+            for(auto const& file : slot->claimedFiles)
+            {
+                mClaimedFiles.erase(file);
+            }
+            slot->claimedFiles.clear();
+            endJob(*slot.get(), std::get<0_z>(exportResult), std::get<1_z>(exportResult));
+        }
+        while(!slot->job.has_value() && !mPendingJobs.empty())
+        {
+            auto job = std::move(mPendingJobs.front());
+            mPendingJobs.erase(mPendingJobs.begin());
+            startJob(*slot.get(), std::move(job));
+        }
+    }
+
+    auto const hasJob = std::any_of(mSlots.cbegin(), mSlots.cend(), [](auto const& slot)
+                                    {
+                                        return slot->job.has_value();
+                                    });
+    if(mIsRunning && inputEnded && mPendingJobs.empty() && !hasJob)
+    {
+        mIsRunning = false;
+        if(onEnded != nullptr)
+        {
+            onEnded();
+        }
+    }
+}
+
+ANALYSE_FILE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../Document/AnlDocumentExecutor.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Application
+{
+    //! @brief A service that analyzes audio files and exports the results on demand.
+    //! @details The jobs are received as newline-delimited JSON objects on the standard input and the progress
+    //! and the results of the jobs are sent as newline-delimited JSON objects on the standard output. The keys
+    //! of a job are the long options of the export command line (document, input, template, output, format,
+    //! etc.) and an optional identifier that is added to the messages of the job. The executors and the
+    //! templates are kept between the jobs so the plugins and the documents don't have to be reloaded.
+    //! The service ends once the standard input is closed and all the jobs have been processed.
+    class Server
+    : private juce::AsyncUpdater
+    {
+    public:
+        explicit Server(size_t numExecutors);
+        ~Server() override;
+
+        //! @brief Checks if the service is running.
+        bool isRunning() const;
+
+        //! @brief The callback that is called when the service has ended.
+        std::function<void(void)> onEnded = nullptr;
+
+    private:
+        struct Job
+        {
+            nlohmann::json id;
+            juce::File document;
+            juce::File input;
+            juce::File templateFile;
+            juce::File outputDir;
+            bool adaptToSampleRate{false};
+            Document::Exporter::Options options;
+            bool useGroupOverview{false};
+            bool ignoreGridResults{false};
+        };
+
+        struct Slot
+        {
+            std::unique_ptr<Document::Executor> executor;
+            std::optional<Job> job;
+            int progress{-1};
+            std::vector<juce::File> claimedFiles;
+            std::future<std::tuple<juce::Result, juce::Array<juce::File>>> exportProcess;
+            std::atomic<bool> exportEnded{false};
+        };
+
+        // The input is shared with the thread that reads the standard input that cannot be interrupted
+        struct Input
+        {
+            std::mutex mutex;
+            std::vector<std::string> lines;
+            bool ended{false};
+            juce::AsyncUpdater* updater{nullptr};
+        };
+
+        // juce::AsyncUpdater
+        void handleAsyncUpdate() override;
+
+        std::variant<Job, juce::Result> parseJob(nlohmann::json const& json) const;
+        std::variant<Document::Template*, juce::Result> getTemplate(juce::File const& templateFile);
+        void startJob(Slot& slot, Job job);
+        void exportJob(Slot& slot);
+        void endJob(Slot& slot, juce::Result const& result, juce::Array<juce::File> const& files);
+        void send(nlohmann::json const& json) const;
+
+        juce::AudioFormatManager mAudioFormatManager;
+        std::map<juce::String, std::tuple<juce::Time, std::unique_ptr<Document::Template>>> mTemplates;
+        std::vector<std::unique_ptr<Slot>> mSlots;
+        std::vector<Job> mPendingJobs;
+        std::shared_ptr<Input> mInput{std::make_shared<Input>()};
+        std::set<juce::File> mClaimedFiles;
+        std::atomic<bool> mShouldAbort{false};
+        bool mIsRunning{true};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Server)
+    };
+} // namespace Application
+
+ANALYSE_FILE_END
@@ -0,0 +1,340 @@
+#include "AnlDocumentBatcher.h"
+#include "AnlDocumentTools.h"
+
+ANALYSE_FILE_BEGIN
+
+Document::Batcher::Batcher(Accessor const& templateAccessor, juce::AudioFormatManager& audioFormatManager, bool adaptOnSampleRate, Template::AdaptationRule adaptationRule, Selection const& selection, Exporter::Options const& options, bool incremental, size_t memoryBudget)
+: mTemplate(templateAccessor, adaptationRule)
+, mAudioFormatManager(audioFormatManager)
+, mAdaptOnSampleRate(adaptOnSampleRate)
+, mSelection(selection)
+, mOptions(options)
+, mIncremental(incremental)
+, mMemoryBudget(memoryBudget)
+{
+    // The configuration contains everything but the audio files and the template that changes the exported results
+    juce::XmlElement xml("configuration");
+    XmlParser::toXml(xml, "options", mOptions);
+    XmlParser::toXml(xml, "adaptOnSampleRate", mAdaptOnSampleRate);
+    XmlParser::toXml(xml, "adaptationRule", adaptationRule);
+    XmlParser::toXml(xml, "useGroupOverview", mSelection.useGroupOverview);
+    XmlParser::toXml(xml, "ignoreGridResults", mSelection.ignoreGridResults);
+    mConfiguration = xml.toString(juce::XmlElement::TextFormat().singleLine().withoutHeader());
+}
+
+Document::Batcher::~Batcher()
+{
+    mShouldAbort.store(true);
+    cancelPendingUpdate();
+    for(auto& job : mJobs)
+    {
+        if(job->exportProcess.valid())
+        {
+            job->exportProcess.get();
+        }
+    }
+}
+
+void Document::Batcher::launch(std::vector<std::vector<AudioFileLayout>> const& readers, juce::File const& outputDir, size_t numJobs)
+{
+    MiscWeakAssert(!isRunning());
+    if(isRunning())
+    {
+        return;
+    }
+
+    mShouldAbort.store(false);
+    mOutputDir = outputDir;
+    mReaders = readers;
+    mNextReader = 0_z;
+    mReports.clear();
+    mReports.reserve(readers.size());
+    mJobs.clear();
+    mClaimedFiles.clear();
+    mManifest.reset();
+    if(mIncremental)
+    {
+        mManifest = std::make_unique<ExportManifest>(mOutputDir);
+        auto const result = mManifest->load();
+        if(result.failed())
+        {
+            // The manifest is rebuilt so all the results are exported again
+            MiscDebug("Batcher", result.getErrorMessage());
+        }
+    }
+    for(auto index = 0_z; index < std::clamp(numJobs, 1_z, std::max(readers.size(), 1_z)); ++index)
+    {
+        mJobs.push_back(std::make_unique<Job>());
+    }
+    for(auto& job : mJobs)
+    {
+        startJob(*job.get());
+    }
+    // Notifies the end of the processing asynchronously if no file can be processed
+    triggerAsyncUpdate();
+}
+
+void Document::Batcher::abort()
+{
+    mShouldAbort.store(true);
+    mNextReader = mReaders.size();
+    for(auto& job : mJobs)
+    {
+        // The jobs that are exporting are ended once the exporter has been aborted
+        if(job->executor != nullptr && !job->exportProcess.valid())
+        {
+            endJob(*job.get(), juce::Result::fail(juce::translate("Processing aborted")));
+        }
+    }
+    triggerAsyncUpdate();
+}
+
+bool Document::Batcher::isRunning() const
+{
+    return std::any_of(mJobs.cbegin(), mJobs.cend(), [](auto const& job)
+                       {
+                           return job->executor != nullptr;
+                       });
+}
+
+std::vector<Document::Batcher::Report> const& Document::Batcher::getReports() const
+{
+    return mReports;
+}
+
+size_t Document::Batcher::getDefaultNumJobs()
+{
+    return static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+}
+
+std::set<juce::String> Document::Batcher::getCandidateIdentifiers(Accessor const& accessor) const
+{
+    std::set<juce::String> identifiers;
+    if(mSelection.identifiers.has_value())
+    {
+        std::copy_if(mSelection.identifiers->cbegin(), mSelection.identifiers->cend(), std::inserter(identifiers, identifiers.end()), [&](auto const& identifier)
+                     {
+                         return Tools::hasTrackAcsr(accessor, identifier) || Tools::hasGroupAcsr(accessor, identifier);
+                     });
+    }
+    else if(mOptions.useImageFormat() && mSelection.useGroupOverview)
+    {
+        auto const groupIdentifiers = Tools::getEffectiveGroupIdentifiers(accessor);
+        identifiers.insert(groupIdentifiers.cbegin(), groupIdentifiers.cend());
+    }
+    else
+    {
+        auto const trackIdentifiers = Tools::getEffectiveTrackIdentifiers(accessor);
+        identifiers.insert(trackIdentifiers.cbegin(), trackIdentifiers.cend());
+    }
+    return identifiers;
+}
+
+void Document::Batcher::startJob(Job& job)
+{
+    while(!mShouldAbort.load() && mNextReader < mReaders.size())
+    {
+        job.reader = mReaders[mNextReader++];
+        job.hashes.clear();
+        job.numUpToDate = 0_z;
+        job.documentTemplate = std::addressof(mTemplate);
+        if(mManifest != nullptr && !job.reader.empty())
+        {
+            // The hashes are computed before loading the document because the analyses start once the document is loaded
+            auto const input = ExportManifest::getInput(job.reader);
+            auto const identifiers = getCandidateIdentifiers(mTemplate.getAccessor());
+            mManifest->retainEntries(input, identifiers);
+            std::set<juce::String> requiredTracks;
+            for(auto const& identifier : identifiers)
+            {
+                auto const hash = ExportManifest::getHash(mTemplate.getAccessor(), job.reader, identifier, mConfiguration);
+                if(mManifest->isUpToDate(input, identifier, hash))
+                {
+                    ++job.numUpToDate;
+                    continue;
+                }
+                job.hashes[identifier] = hash;
+                if(Tools::hasGroupAcsr(mTemplate.getAccessor(), identifier))
+                {
+                    auto const trackIdentifiers = Tools::getEffectiveTrackIdentifiers(mTemplate.getAccessor(), identifier);
+                    requiredTracks.insert(trackIdentifiers.cbegin(), trackIdentifiers.cend());
+                }
+                else
+                {
+                    requiredTracks.insert(identifier);
+                }
+            }
+            if(job.hashes.empty())
+            {
+                endJob(job, juce::Result::ok());
+                continue;
+            }
+            // The input tracks are analyzed even if their results are up-to-date because the required tracks use them
+            auto const inputTracks = Tools::getInputTrackIdentifiers(mTemplate.getAccessor(), requiredTracks);
+            requiredTracks.insert(inputTracks.cbegin(), inputTracks.cend());
+
+            // The tracks whose results are up-to-date are not analyzed, the templates are shared by the files that require the same tracks
+            auto& incrementalTemplate = mIncrementalTemplates[requiredTracks];
+            if(incrementalTemplate == nullptr)
+            {
+                incrementalTemplate = std::make_unique<Template>(mTemplate.getAccessor(), mTemplate.getAdaptationRule());
+                incrementalTemplate->retainTracks(requiredTracks);
+            }
+            job.documentTemplate = incrementalTemplate.get();
+        }
+
+        job.executor = std::make_unique<Executor>(mAudioFormatManager);
+        job.executor->setMemoryBudget(mMemoryBudget > 0_z ? std::max(mMemoryBudget / std::max(mJobs.size(), 1_z), 1_z) : 0_z);
+        job.executor->onEnded = [this, &job]()
+        {
+            exportJob(job);
+        };
+        auto result = job.reader.empty() ? juce::Result::fail(juce::translate("No audio file")) : job.executor->load(job.reader, *job.documentTemplate, mAdaptOnSampleRate);
+        if(result.wasOk())
+        {
+            result = job.executor->launch();
+        }
+        if(result.wasOk())
+        {
+            return;
+        }
+        endJob(job, result);
+    }
+}
+
+void Document::Batcher::exportJob(Job& job)
+{
+    MiscWeakAssert(!job.exportProcess.valid());
+    if(job.exportProcess.valid())
+    {
+        return;
+    }
+    job.exportEnded.store(false);
+    // The identifiers are retrieved on the message thread once the analyses have ended
+    auto identifiers = mSelection.identifiers.has_value() ? *mSelection.identifiers : job.executor->getExportIdentifiers(mOptions, mSelection.useGroupOverview, mSelection.ignoreGridResults);
+    auto const filePrefix = job.reader.front().file.getFileNameWithoutExtension() + " ";
+    if(mManifest == nullptr)
+    {
+        // The files are claimed on the message thread so the concurrent jobs whose audio files have the same name never use the same files
+        std::vector<std::tuple<juce::String, juce::File>> files;
+        for(auto const& identifier : identifiers)
+        {
+            files.push_back({identifier, Exporter::reserveFile(mOutputDir, Exporter::getFileName(job.documentTemplate->getAccessor(), filePrefix, identifier, mOptions), mClaimedFiles)});
+        }
+        job.exportProcess = std::async(std::launch::async, [this, &job, files]()
+                                       {
+                                           juce::Thread::setCurrentThreadName("Batch");
+                                           job.exportResult = files.empty() ? juce::Result::fail(juce::translate("No results to export")) : juce::Result::ok();
+                                           for(auto const& [identifier, file] : files)
+                                           {
+                                               job.exportResult = job.executor->exportTo(file, identifier, mOptions, mShouldAbort);
+                                               if(job.exportResult.failed())
+                                               {
+                                                   break;
+                                               }
+                                           }
+                                           job.exportEnded.store(true);
+                                           triggerAsyncUpdate();
+                                       });
+        return;
+    }
+
+    // The files are claimed on the message thread so the concurrent jobs never use the same files
+    auto const input = ExportManifest::getInput(job.reader);
+    auto const incompatibleIdentifiers = job.executor->getIncompatibleIdentifiers(mOptions, mSelection.ignoreGridResults);
+    std::map<juce::String, juce::File> files;
+    juce::StringArray errors;
+    for(auto const& [identifier, hash] : job.hashes)
+    {
+        if(identifiers.count(identifier) > 0_z)
+        {
+            files[identifier] = mManifest->claimFile(input, identifier, Exporter::getFileName(job.documentTemplate->getAccessor(), filePrefix, identifier, mOptions));
+        }
+        else if(incompatibleIdentifiers.count(identifier) > 0_z)
+        {
+            // The track is not compatible with the export options so nothing has to be exported
+            mManifest->setEntry(input, identifier, hash, {});
+        }
+        else
+        {
+            // The track has no results (the plugin is missing or the analysis failed) so it is not recorded and it is analyzed again by the next processing
+            auto const& accessor = job.documentTemplate->getAccessor();
+            auto const name = Tools::hasTrackAcsr(accessor, identifier) ? Tools::getTrackAcsr(accessor, identifier).getAttr<Track::AttrType::name>() : identifier;
+            errors.add(juce::translate("The results of the track NAME cannot be exported.").replace("NAME", name));
+        }
+    }
+    job.exportProcess = std::async(std::launch::async, [this, &job, input, files, errors]() mutable
+                                   {
+                                       juce::Thread::setCurrentThreadName("Batch");
+                                       // The exports of the other tracks and groups go on if an export fails
+                                       for(auto const& [identifier, file] : files)
+                                       {
+                                           auto const result = job.executor->exportTo(file, identifier, mOptions, mShouldAbort);
+                                           if(result.failed())
+                                           {
+                                               errors.add(result.getErrorMessage());
+                                               if(mShouldAbort.load())
+                                               {
+                                                   break;
+                                               }
+                                               continue;
+                                           }
+                                           mManifest->setEntry(input, identifier, job.hashes.at(identifier), file);
+                                       }
+                                       job.exportResult = errors.isEmpty() ? juce::Result::ok() : juce::Result::fail(errors.joinIntoString("\n"));
+                                       job.exportEnded.store(true);
+                                       triggerAsyncUpdate();
+                                   });
+}
+
+void Document::Batcher::endJob(Job& job, juce::Result const& result)
+{
+    Report report;
+    report.reader = job.reader;
+    report.result = result;
+    report.numUpToDate = job.numUpToDate;
+    if(job.executor != nullptr)
+    {
+        report.messages = job.executor->getAlertCatcher().getMessages();
+        report.profile = job.executor->getProfile();
+    }
+    job.executor.reset();
+    mReports.push_back(std::move(report));
+    if(onFileEnded != nullptr)
+    {
+        onFileEnded(mReports.back());
+    }
+}
+
+void Document::Batcher::handleAsyncUpdate()
+{
+    Tracer::ScopedEvent const scopedEvent("Document::Batcher::handleAsyncUpdate", "notification");
+    for(auto& job : mJobs)
+    {
+        if(job->exportProcess.valid() && job->exportEnded.load())
+        {
+            job->exportProcess.get();
+            endJob(*job.get(), job->exportResult);
+            startJob(*job.get());
+        }
+    }
+    if(!mJobs.empty() && !isRunning())
+    {
+        mJobs.clear();
+        if(mManifest != nullptr)
+        {
+            auto const result = mManifest->save();
+            if(result.failed() && !mReports.empty())
+            {
+                mReports.back().messages[std::make_tuple(AlertWindow::MessageType::warning, juce::translate("Incremental processing"))].add(result.getErrorMessage());
+            }
+            mManifest.reset();
+        }
+        if(onEnded != nullptr)
+        {
+            onEnded();
+        }
+    }
+}
+
+ANALYSE_FILE_END
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "AnlDocumentExecutor.h"
+#include "AnlDocumentExportManifest.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Document
+{
+    //! @brief Analyzes and exports a list of audio files using a template document.
+    //! @details Several files are processed concurrently, each one in its own executor so the files don't share
+    //! any document context. The batcher must be used from the message thread, the exports are performed on
+    //! background threads. Each item of the batch is the reader of a document (an audio file layout or the
+    //! layouts of the channels of an audio file). In incremental mode, an export manifest is kept in the output
+    //! directory and only the tracks and the groups whose inputs have changed are analyzed and exported.
+    class Batcher
+    : private juce::AsyncUpdater
+    {
+    public:
+        //! @brief The result of the processing of an audio file.
+        struct Report
+        {
+            std::vector<AudioFileLayout> reader;
+            juce::Result result{juce::Result::ok()};
+            std::map<AlertWindow::Catcher::entry_t, juce::StringArray> messages;
+            size_t numUpToDate{0_z};
+            nlohmann::json profile;
+        };
+
+        //! @brief The tracks and the groups to export.
+        //! @details If the identifiers are not defined, the tracks or the groups compatible with the export options are
+        //! exported once the analyses have ended.
+        struct Selection
+        {
+            std::optional<std::set<juce::String>> identifiers;
+            bool useGroupOverview{false};
+            bool ignoreGridResults{false};
+        };
+
+        //! @details The memory budget (in bytes, 0 means no limit) is shared equally between the files processed
+        //! concurrently (see Executor::setMemoryBudget). The adaptation rule defines how the block sizes and the step
+        //! sizes of the tracks are adapted to the sample rates of the audio files (see Template::AdaptationRule).
+        Batcher(Accessor const& templateAccessor, juce::AudioFormatManager& audioFormatManager, bool adaptOnSampleRate, Template::AdaptationRule adaptationRule, Selection const& selection, Exporter::Options const& options, bool incremental, size_t memoryBudget);
+        ~Batcher() override;
+
+        //! @brief Launches the processing of the audio files, the results are exported to the output directory.
+        //! @details At most numJobs files are processed at the same time.
+        void launch(std::vector<std::vector<AudioFileLayout>> const& readers, juce::File const& outputDir, size_t numJobs);
+
+        //! @brief Aborts the processing, the pending files are ignored.
+        void abort();
+
+        //! @brief Checks if the batcher is currently processing files.
+        bool isRunning() const;
+
+        //! @brief Gets the reports of the files that have been processed.
+        std::vector<Report> const& getReports() const;
+
+        //! @brief The callback that is called when the processing of a file has ended.
+        std::function<void(Report const&)> onFileEnded = nullptr;
+
+        //! @brief The callback that is called when the processing of all the files has ended.
+        std::function<void(void)> onEnded = nullptr;
+
+        //! @brief Gets the default number of files processed concurrently.
+        static size_t getDefaultNumJobs();
+
+    private:
+        struct Job
+        {
+            std::vector<AudioFileLayout> reader;
+            Template* documentTemplate{nullptr};
+            std::map<juce::String, juce::String> hashes;
+            size_t numUpToDate{0_z};
+            std::unique_ptr<Executor> executor;
+            std::future<void> exportProcess;
+            juce::Result exportResult{juce::Result::ok()};
+            std::atomic<bool> exportEnded{false};
+        };
+
+        // juce::AsyncUpdater
+        void handleAsyncUpdate() override;
+
+        std::set<juce::String> getCandidateIdentifiers(Accessor const& accessor) const;
+        void startJob(Job& job);
+        void exportJob(Job& job);
+        void endJob(Job& job, juce::Result const& result);
+
+        Template mTemplate;
+        std::map<std::set<juce::String>, std::unique_ptr<Template>> mIncrementalTemplates;
+        juce::AudioFormatManager& mAudioFormatManager;
+        bool const mAdaptOnSampleRate;
+        Selection const mSelection;
+        Exporter::Options const mOptions;
+        bool const mIncremental;
+        size_t const mMemoryBudget;
+        juce::String mConfiguration;
+        std::unique_ptr<ExportManifest> mManifest;
+        juce::File mOutputDir;
+        std::set<juce::File> mClaimedFiles;
+        std::vector<std::vector<AudioFileLayout>> mReaders;
+        size_t mNextReader{0_z};
+        std::vector<std::unique_ptr<Job>> mJobs;
+        std::vector<Report> mReports;
+        std::atomic<bool> mShouldAbort{false};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Batcher)
+    };
+} // namespace Document
+
+ANALYSE_FILE_END
@@ -9,6 +9,10 @@ Document::Director::Director(Accessor& accessor, juce::AudioFormatManager& audio
 : mAccessor(accessor)
 , mAudioFormatManager(audioFormatManager)
 , mUndoManager(undoManager)
+, mSharedAnalyzer([this]()
+                  {
+                      return std::get<0>(createAudioFormatReader(mAccessor, mAudioFormatManager));
+                  })
 {
     mAccessor.onAttrUpdated = [&](AttrType attribute, NotificationType notification)
     {
@@ -119,7 +123,7 @@ Document::Director::Director(Accessor& accessor, juce::AudioFormatManager& audio
                 }
                 auto& trackAcsr = trackAcsrs[index].get();
                 trackAcsr.setAttr<Track::AttrType::grid>(mAccessor.getAttr<AttrType::grid>(), notification);
-                auto director = std::make_unique<Track::Director>(trackAcsr, mUndoManager, mHierarchyManager, std::get<0>(createAudioFormatReader(mAccessor, mAudioFormatManager)));
+                auto director = std::make_unique<Track::Director>(trackAcsr, mUndoManager, mHierarchyManager, std::get<0>(createAudioFormatReader(mAccessor, mAudioFormatManager)), &mSharedAnalyzer);
                 director->setAlertCatcher(mAlertCatcher);
                 director->setPluginTable(mPluginTable, mPluginTableShowHideFn);
                 director->setBackupDirectory(mBackupDirectory);
@@ -328,6 +332,23 @@ Document::Director::Director(Accessor& accessor, juce::AudioFormatManager& audio
             }
             break;
             case Zoom::AttrType::visibleRange:
+            {
+                // The markers of the transport are those of the frames in memory
+                auto const visibleRange = zoomAcsr.getAttr<Zoom::AttrType::visibleRange>();
+                auto hasPagedResults = false;
+                for(auto& track : mTracks)
+                {
+                    if(track != nullptr && track->updateResultsPage(visibleRange))
+                    {
+                        hasPagedResults = true;
+                    }
+                }
+                if(hasPagedResults)
+                {
+                    updateMarkers(notification);
+                }
+            }
+            break;
             case Zoom::AttrType::anchor:
                 break;
         }
@@ -1079,6 +1100,8 @@ void Document::Director::restoreAudioFile(juce::File const& file)
 
 void Document::Director::initializeAudioReaders(NotificationType notification)
 {
+    // The pending analyses use the previous audio files
+    mSharedAnalyzer.launchPendingAnalyses();
     auto const channels = mAccessor.getAttr<AttrType::reader>();
     auto& transportAcsr = mAccessor.getAcsr<AcsrType::transport>();
     auto& zoomAcsr = mAccessor.getAcsr<AcsrType::timeZoom>();
@@ -73,6 +73,7 @@ namespace Document
         juce::AudioFormatManager& mAudioFormatManager;
         juce::UndoManager& mUndoManager;
         Accessor mSavedState;
+        Track::SharedAnalyzer mSharedAnalyzer;
 
         std::vector<std::unique_ptr<Group::Director>> mGroups;
         std::vector<std::unique_ptr<Track::Director>> mTracks;
@@ -1,18 +1,153 @@
 #include "AnlDocumentExecutor.h"
+#include "../Track/AnlTrackLoader.h"
 #include "../Track/AnlTrackTools.h"
+#include "../Track/Result/AnlTrackResultBinary.h"
 #include "AnlDocumentFileBased.h"
 
 ANALYSE_FILE_BEGIN
 
+namespace
+{
+    // The data are shared by the copies of the results so the results of the track are released in place without
+    // notifying the change of the results (that would restart the analyses of the dependent tracks). The number of
+    // channels is preserved so the results can be restored in place.
+    bool releaseResults(Track::Results const& results)
+    {
+        auto data = results;
+        auto const access = data.getWriteAccess();
+        if(!static_cast<bool>(access))
+        {
+            return false;
+        }
+        auto const release = [](auto channels)
+        {
+            if(channels != nullptr)
+            {
+                using channels_t = typename decltype(channels)::element_type;
+                *channels = channels_t(channels->size());
+            }
+        };
+        release(data.getMarkers());
+        release(data.getPoints());
+        release(data.getColumns());
+        return true;
+    }
+
+    bool writeResults(Track::Results const& results, juce::File const& file)
+    {
+        auto const access = results.getReadAccess();
+        if(!static_cast<bool>(access) || results.isEmpty())
+        {
+            return false;
+        }
+        std::atomic<bool> const shouldAbort{false};
+        std::ofstream stream(file.getFullPathName().toStdString(), std::ios::out | std::ios::binary);
+        auto const written = Track::Result::Binary::write(stream, results, {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort);
+        stream.close();
+        return written && !stream.fail();
+    }
+
+    bool restoreResults(Track::Results const& results, Track::Results& loadedResults)
+    {
+        auto data = results;
+        auto const access = data.getWriteAccess();
+        auto const loadedAccess = loadedResults.getWriteAccess();
+        if(!static_cast<bool>(access) || !static_cast<bool>(loadedAccess))
+        {
+            return false;
+        }
+        auto const restore = [](auto channels, auto loadedChannels)
+        {
+            if(channels == nullptr || loadedChannels == nullptr)
+            {
+                return false;
+            }
+            std::swap(*channels, *loadedChannels);
+            return true;
+        };
+        return restore(data.getMarkers(), loadedResults.getMarkers()) || restore(data.getPoints(), loadedResults.getPoints()) || restore(data.getColumns(), loadedResults.getColumns());
+    }
+} // namespace
+
 Document::Executor::Executor()
+: Executor(std::make_unique<juce::AudioFormatManager>())
 {
+}
+
+Document::Executor::Executor(std::unique_ptr<juce::AudioFormatManager> audioFormatManager)
+: Executor(*audioFormatManager.get())
+{
+    mOwnedAudioFormatManager = std::move(audioFormatManager);
     MiscDebug("Executor", "Register audio formats...");
     mAudioFormatManager.registerBasicFormats();
 }
 
+Document::Executor::Executor(juce::AudioFormatManager& audioFormatManager)
+: mAudioFormatManager(audioFormatManager)
+{
+    mListener.onAccessorInserted = [this](Accessor const& acsr, AcsrType type, size_t index)
+    {
+        switch(type)
+        {
+            case AcsrType::tracks:
+            {
+                auto listener = std::make_unique<Track::Accessor::SmartListener>(typeid(*this).name(), mAccessor.getAcsr<AcsrType::tracks>(index), [this]([[maybe_unused]] Track::Accessor const& trackAcsr, Track::AttrType trackAttribute)
+                                                                                 {
+                                                                                     // The end of the processing is checked asynchronously because the
+                                                                                     // directors update the results and the graphics after the state
+                                                                                     if(trackAttribute == Track::AttrType::processing && mIsRunning.load())
+                                                                                     {
+                                                                                         triggerAsyncUpdate();
+                                                                                     }
+                                                                                 });
+                mTrackListeners.emplace(mTrackListeners.begin() + static_cast<long>(index), std::move(listener));
+                MiscWeakAssert(mTrackListeners.size() <= acsr.getNumAcsrs<AcsrType::tracks>());
+            }
+            break;
+            case AcsrType::groups:
+            case AcsrType::timeZoom:
+            case AcsrType::transport:
+                break;
+        }
+    };
+
+    mListener.onAccessorErased = [this]([[maybe_unused]] Accessor const& acsr, AcsrType type, size_t index)
+    {
+        switch(type)
+        {
+            case AcsrType::tracks:
+            {
+                mTrackListeners.erase(mTrackListeners.begin() + static_cast<long>(index));
+                MiscWeakAssert(mTrackListeners.size() == acsr.getNumAcsrs<AcsrType::tracks>());
+                if(mIsRunning.load())
+                {
+                    triggerAsyncUpdate();
+                }
+            }
+            break;
+            case AcsrType::groups:
+            case AcsrType::timeZoom:
+            case AcsrType::transport:
+                break;
+        }
+    };
+
+    mAccessor.addListener(mListener, NotificationType::synchronous);
+}
+
+Document::Executor::~Executor()
+{
+    mIsRunning.store(false);
+    cancelPendingUpdate();
+    mAccessor.removeListener(mListener);
+    mTrackListeners.clear();
+    clearSpilledResults();
+}
+
 juce::Result Document::Executor::load(juce::File const& documentFile)
 {
     MiscDebug("Executor", "Loading document file...");
+    mAlertCatcher.clearMessages();
     auto fileResult = Document::FileBased::parse(documentFile);
     if(fileResult.index() == 1_z)
     {
@@ -40,6 +175,7 @@ juce::Result Document::Executor::load(juce::File const& audioFile, juce::File co
     }
 
     MiscDebug("Executor", "Reset document...");
+    mAlertCatcher.clearMessages();
     mAccessor.copyFrom(Accessor(), NotificationType::synchronous);
 
     MiscDebug("Executor", "Loading audio file...");
@@ -79,6 +215,66 @@ juce::Result Document::Executor::load(juce::File const& audioFile, juce::File co
     return juce::Result::ok();
 }
 
+juce::Result Document::Executor::load(std::vector<AudioFileLayout> const& audioFileLayouts, Accessor const& templateAccessor, bool adaptOnSampleRate)
+{
+    Template documentTemplate(templateAccessor);
+    return load(audioFileLayouts, documentTemplate, adaptOnSampleRate);
+}
+
+juce::Result Document::Executor::load(std::vector<AudioFileLayout> const& audioFileLayouts, Template& documentTemplate, bool adaptOnSampleRate)
+{
+    MiscDebug("Executor", "Reset document...");
+    mAlertCatcher.clearMessages();
+    mDirector.setAlertCatcher(&mAlertCatcher);
+    mAccessor.copyFrom(Accessor(), NotificationType::synchronous);
+
+    MiscDebug("Executor", "Loading audio file...");
+    mAccessor.setAttr<AttrType::reader>(audioFileLayouts, NotificationType::synchronous);
+
+    MiscDebug("Executor", "Loading template document...");
+    documentTemplate.applyTo(mAccessor, adaptOnSampleRate);
+
+    MiscDebug("Executor", "Sanitize document...");
+    [[maybe_unused]] auto const references = mDirector.sanitize(NotificationType::synchronous);
+
+    MiscDebug("Executor", "Reset time range...");
+    mAccessor.getAcsr<AcsrType::timeZoom>().setAttr<Zoom::AttrType::visibleRange>(Zoom::Range{0.0, std::numeric_limits<double>::max()}, NotificationType::synchronous);
+    return juce::Result::ok();
+}
+
+juce::Result Document::Executor::parseTemplate(juce::File const& templateFile, Accessor& templateAccessor)
+{
+    MiscDebug("Executor", "Parsing template file...");
+    auto fileResult = Document::FileBased::parse(templateFile);
+    if(fileResult.index() == 1_z)
+    {
+        return std::get<1>(fileResult);
+    }
+    auto xml = std::move(std::get<0>(fileResult));
+
+    // Adjust the path in the XML to match the new template file location
+    XmlParser::replaceAllAttributeValues(*xml.get(), FileBased::getPathReplacement(*xml.get()), juce::File::addTrailingSeparator(templateFile.getParentDirectory().getFullPathName()));
+
+    templateAccessor.copyFrom(Accessor(), NotificationType::synchronous);
+    templateAccessor.fromXml(*xml.get(), {"document"}, NotificationType::synchronous);
+    for(auto const& acsr : templateAccessor.getAcsrs<AcsrType::tracks>())
+    {
+        auto trackFileInfo = acsr.get().getAttr<Track::AttrType::file>();
+        if(trackFileInfo.commit.isNotEmpty())
+        {
+            trackFileInfo.commit.clear();
+            acsr.get().setAttr<Track::AttrType::file>(trackFileInfo, NotificationType::synchronous);
+        }
+    }
+    return juce::Result::ok();
+}
+
+void Document::Executor::setMemoryBudget(size_t budget)
+{
+    MiscWeakAssert(!isRunning());
+    mMemoryBudget = budget;
+}
+
 juce::Result Document::Executor::launch()
 {
     MiscDebug("Executor", "Check for warnings...");
@@ -94,8 +290,13 @@ juce::Result Document::Executor::launch()
         return juce::Result::fail(juce::translate("Error: The track TRACKNAME contains the error type 'ERRORTYPE'").replace("TRACKNAME", trackName).replace("ERRORTYPE", warningType));
     }
 
-    timerCallback();
-    startTimer(20);
+    {
+        std::lock_guard<std::mutex> lock(mProfileMutex);
+        mGroupExportDurations.clear();
+    }
+    clearSpilledResults();
+    mIsRunning.store(true);
+    triggerAsyncUpdate();
     return juce::Result::ok();
 }
 
@@ -120,7 +321,6 @@ juce::Result Document::Executor::saveTo(juce::File const& outputFile)
 
 juce::Result Document::Executor::exportTo(juce::File const& outputDir, juce::String const& filePrefix, Document::Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults)
 {
-    MiscDebug("Executor", "Exporting results...");
     MiscWeakAssert(!isRunning());
     if(isRunning())
     {
@@ -128,13 +328,12 @@ juce::Result Document::Executor::exportTo(juce::File const& outputDir, juce::Str
         return juce::Result::fail(juce::translate("Cannot export while running analysis or file parsing"));
     }
     std::atomic<bool> shouldAbort{false};
+    return exportTo(outputDir, filePrefix, getExportIdentifiers(options, useGroupOverview, ignoreGridResults), options, shouldAbort);
+}
+
+std::set<juce::String> Document::Executor::getExportIdentifiers(Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults) const
+{
     std::set<juce::String> identifiers;
-    juce::MessageManager::Lock lock;
-    if(!lock.tryEnter())
-    {
-        MiscDebug("Executor", "Invalid threaded access");
-        return juce::Result::fail(juce::translate("Invalid threaded access"));
-    }
     if(options.useImageFormat() && useGroupOverview)
     {
         for(auto const& identifier : Tools::getEffectiveGroupIdentifiers(mAccessor))
@@ -158,36 +357,380 @@ juce::Result Document::Executor::exportTo(juce::File const& outputDir, juce::Str
             }
         }
     }
-    lock.exit();
+    return identifiers;
+}
+
+std::set<juce::String> Document::Executor::getIncompatibleIdentifiers(Exporter::Options const& options, bool ignoreGridResults) const
+{
+    std::set<juce::String> identifiers;
+    for(auto const& identifier : Tools::getEffectiveTrackIdentifiers(mAccessor))
+    {
+        auto const frameType = Track::Tools::getFrameType(Tools::getTrackAcsr(mAccessor, identifier));
+        if(frameType.has_value())
+        {
+            auto const trackIgnored = frameType.value() == Track::FrameType::vector && ignoreGridResults;
+            if(!options.isCompatible(frameType.value()) || trackIgnored)
+            {
+                identifiers.insert(identifier);
+            }
+        }
+    }
+    return identifiers;
+}
+
+juce::String Document::Executor::getExportFileName(juce::String const& filePrefix, juce::String const& identifier, Exporter::Options const& options) const
+{
+    return Exporter::getFileName(mAccessor, filePrefix, identifier, options);
+}
+
+juce::Result Document::Executor::exportTo(juce::File const& outputDir, juce::String const& filePrefix, std::set<juce::String> const& identifiers, Exporter::Options const& options, std::atomic<bool> const& shouldAbort)
+{
+    MiscDebug("Executor", "Exporting results...");
+    MiscWeakAssert(!isRunning());
+    if(isRunning())
+    {
+        MiscDebug("Executor", "Cannot export while running analysis or file parsing");
+        return juce::Result::fail(juce::translate("Cannot export while running analysis or file parsing"));
+    }
     if(identifiers.empty())
     {
         MiscDebug("Executor", "No results to export");
         return juce::Result::fail(juce::translate("No results to export"));
     }
-    return Exporter::exportTo(mAccessor, outputDir, {}, {}, filePrefix, identifiers, options, shouldAbort);
+    auto const durationFn = [this](juce::String const& identifier, double duration)
+    {
+        addExportDuration(identifier, duration);
+    };
+    // The spilled results of a track or a group are read back in memory during its export
+    auto const performFn = [this](juce::String const& identifier, std::function<juce::Result(void)> const& exportFn)
+    {
+        return performWithResults(identifier, exportFn);
+    };
+    // The document is not modified once the analysis has ended so the message manager doesn't need to be locked
+    return Exporter::exportTo(mAccessor, outputDir, {}, {}, filePrefix, identifiers, options, false, shouldAbort, durationFn, performFn);
+}
+
+juce::Result Document::Executor::exportTo(juce::File const& file, juce::String const& identifier, Exporter::Options const& options, std::atomic<bool> const& shouldAbort)
+{
+    MiscDebug("Executor", "Exporting results...");
+    MiscWeakAssert(!isRunning());
+    if(isRunning())
+    {
+        MiscDebug("Executor", "Cannot export while running analysis or file parsing");
+        return juce::Result::fail(juce::translate("Cannot export while running analysis or file parsing"));
+    }
+    auto const startTime = juce::Time::getHighResolutionTicks();
+    auto const result = performWithResults(identifier, [&]()
+                                           {
+                                               return Exporter::exportTo(mAccessor, file, {}, {}, "", identifier, options, false, shouldAbort);
+                                           });
+    addExportDuration(identifier, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime));
+    return result;
+}
+
+nlohmann::json Document::Executor::getProfile() const
+{
+    auto tracks = nlohmann::json::array();
+    for(auto const& identifier : Tools::getEffectiveTrackIdentifiers(mAccessor))
+    {
+        auto const& trackAcsr = Tools::getTrackAcsr(mAccessor, identifier);
+        auto track = Track::Profiler::toJson(mDirector.getTrackDirector(identifier).getProfiler().getSummary());
+        track["identifier"] = identifier.toStdString();
+        track["name"] = trackAcsr.getAttr<Track::AttrType::name>().toStdString();
+        tracks.push_back(std::move(track));
+    }
+    auto groups = nlohmann::json::array();
+    std::lock_guard<std::mutex> lock(mProfileMutex);
+    for(auto const& [identifier, duration] : mGroupExportDurations)
+    {
+        if(Tools::hasGroupAcsr(mAccessor, identifier))
+        {
+            auto group = nlohmann::json::object();
+            group["identifier"] = identifier.toStdString();
+            group["name"] = Tools::getGroupAcsr(mAccessor, identifier).getAttr<Group::AttrType::name>().toStdString();
+            group["durations"] = {{Track::Profiler::getStageName(Track::Profiler::Stage::exporting).toStdString(), duration}};
+            groups.push_back(std::move(group));
+        }
+    }
+    auto json = nlohmann::json::object();
+    json["tracks"] = std::move(tracks);
+    json["groups"] = std::move(groups);
+    return json;
+}
+
+void Document::Executor::addExportDuration(juce::String const& identifier, double duration)
+{
+    // The document is not modified once the analysis has ended so the directors can be accessed from any thread
+    if(Tools::hasTrackAcsr(mAccessor, identifier))
+    {
+        mDirector.getTrackDirector(identifier).getProfiler().addDuration(Track::Profiler::Stage::exporting, duration);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mProfileMutex);
+    mGroupExportDurations[identifier] += duration;
+}
+
+bool Document::Executor::spillResults()
+{
+    // The worker notifies the executor once the results have been spilled
+    if(mSpillProcess.valid())
+    {
+        if(mSpillProcess.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready)
+        {
+            return true;
+        }
+        mSpillProcess.get();
+    }
+    if(mMemoryBudget == 0_z)
+    {
+        return false;
+    }
+
+    // The results of the tracks used as inputs by the tracks that are analyzing or not yet analyzed must stay in memory
+    auto const trackAcsrs = mAccessor.getAcsrs<AcsrType::tracks>();
+    std::set<juce::String> requiredTracks;
+    for(auto const& trackAcsr : trackAcsrs)
+    {
+        auto const& results = trackAcsr.get().getAttr<Track::AttrType::results>();
+        auto const access = results.getReadAccess();
+        if(std::get<0>(trackAcsr.get().getAttr<Track::AttrType::processing>()) || !static_cast<bool>(access) || results.isEmpty())
+        {
+            for(auto const& input : trackAcsr.get().getAttr<Track::AttrType::inputs>())
+            {
+                requiredTracks.insert(input.second);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mSpillMutex);
+    auto residentSize = 0_z;
+    std::vector<std::tuple<size_t, juce::String>> candidates;
+    for(auto const& trackAcsr : trackAcsrs)
+    {
+        auto const identifier = trackAcsr.get().getAttr<Track::AttrType::identifier>();
+        auto const& processing = trackAcsr.get().getAttr<Track::AttrType::processing>();
+        if(mSpilledFiles.count(identifier) > 0_z || mUnspilledTracks.count(identifier) > 0_z || std::get<0>(processing) || std::get<2>(processing))
+        {
+            continue;
+        }
+        // The paged results only keep the frames around the visible range in memory
+        if(trackAcsr.get().getAttr<Track::AttrType::results>().isPaged())
+        {
+            continue;
+        }
+        // The results are not modified once the analysis and the rendering have ended so their size is only computed once
+        auto it = mResidentSizes.find(identifier);
+        if(it == mResidentSizes.end())
+        {
+            auto const& results = trackAcsr.get().getAttr<Track::AttrType::results>();
+            auto const access = results.getReadAccess();
+            if(!static_cast<bool>(access) || results.isEmpty())
+            {
+                continue;
+            }
+            it = mResidentSizes.emplace(identifier, Track::Profiler::getMemorySize(results)).first;
+        }
+        residentSize += it->second;
+        if(requiredTracks.count(identifier) == 0_z)
+        {
+            candidates.push_back({it->second, identifier});
+        }
+    }
+    if(residentSize <= mMemoryBudget || candidates.empty())
+    {
+        return false;
+    }
+
+    if(mSpillDirectory == juce::File{})
+    {
+        mSpillDirectory = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory).getNonexistentChildFile("PartielsResults", "");
+    }
+    auto const directoryResult = mSpillDirectory.createDirectory();
+    if(directoryResult.failed())
+    {
+        MiscDebug("Executor", directoryResult.getErrorMessage());
+        return false;
+    }
+
+    // The largest results are spilled first to write as few files as possible
+    struct Spill
+    {
+        juce::String identifier;
+        juce::String name;
+        size_t size;
+        Track::Results results; // Shares the data of the results of the track
+        juce::File file;
+    };
+    std::vector<Spill> spills;
+    std::sort(candidates.begin(), candidates.end(), std::greater<>());
+    for(auto const& [size, identifier] : candidates)
+    {
+        if(residentSize <= mMemoryBudget)
+        {
+            break;
+        }
+        auto const& trackAcsr = Tools::getTrackAcsr(mAccessor, identifier);
+        spills.push_back({identifier, trackAcsr.getAttr<Track::AttrType::name>(), size, trackAcsr.getAttr<Track::AttrType::results>(), mSpillDirectory.getNonexistentChildFile(identifier, ".dat")});
+        residentSize -= size;
+    }
+
+    // The results are written and released by a worker so the message thread is not blocked by the writing of
+    // the files. The analyses of the tracks whose results are spilled have ended so the results are not modified.
+    mSpillProcess = std::async(std::launch::async, [this, spills = std::move(spills)]()
+                               {
+                                   juce::Thread::setCurrentThreadName("Document::Executor::Spill");
+                                   Tracer::ScopedEvent const scopedEvent("Document::Executor::spillResults", "export");
+                                   for(auto const& spill : spills)
+                                   {
+                                       auto const spilled = writeResults(spill.results, spill.file) && releaseResults(spill.results);
+                                       if(spilled)
+                                       {
+                                           MiscDebug("Executor", "Results of " + spill.name + " spilled (" + juce::File::descriptionOfSizeInBytes(static_cast<juce::int64>(spill.size)) + ")");
+                                       }
+                                       else
+                                       {
+                                           MiscDebug("Executor", "Cannot spill the results of " + spill.name);
+                                           spill.file.deleteFile();
+                                       }
+                                       std::lock_guard<std::mutex> spillLock(mSpillMutex);
+                                       if(spilled)
+                                       {
+                                           mSpilledFiles[spill.identifier] = spill.file;
+                                       }
+                                       else
+                                       {
+                                           mUnspilledTracks.insert(spill.identifier);
+                                       }
+                                   }
+                                   triggerAsyncUpdate();
+                               });
+    return true;
 }
 
-void Document::Executor::timerCallback()
+void Document::Executor::clearSpilledResults()
+{
+    if(mSpillProcess.valid())
+    {
+        mSpillProcess.get();
+    }
+    std::lock_guard<std::mutex> lock(mSpillMutex);
+    mSpilledFiles.clear();
+    mUnspilledTracks.clear();
+    mResidentSizes.clear();
+    if(mSpillDirectory != juce::File{})
+    {
+        mSpillDirectory.deleteRecursively();
+        mSpillDirectory = juce::File{};
+    }
+}
+
+juce::Result Document::Executor::performWithResults(juce::String const& identifier, std::function<juce::Result(void)> const& fn)
+{
+    std::unique_lock<std::mutex> lock(mSpillMutex);
+    if(mSpilledFiles.empty())
+    {
+        lock.unlock();
+        return fn();
+    }
+
+    auto const trackIdentifiers = Tools::hasGroupAcsr(mAccessor, identifier) ? Tools::getEffectiveTrackIdentifiers(mAccessor, identifier) : std::vector<juce::String>{identifier};
+    std::vector<juce::String> restoredTracks;
+    auto const releaseRestoredTracks = [&]()
+    {
+        for(auto const& trackIdentifier : restoredTracks)
+        {
+            [[maybe_unused]] auto const released = releaseResults(Tools::getTrackAcsr(mAccessor, trackIdentifier).getAttr<Track::AttrType::results>());
+            MiscWeakAssert(released);
+        }
+    };
+
+    for(auto const& trackIdentifier : trackIdentifiers)
+    {
+        auto const it = mSpilledFiles.find(trackIdentifier);
+        if(it == mSpilledFiles.cend())
+        {
+            continue;
+        }
+        auto const& trackAcsr = Tools::getTrackAcsr(mAccessor, trackIdentifier);
+        std::atomic<bool> const shouldAbort{false};
+        std::atomic<float> advancement{0.0f};
+        auto loadedResults = Track::Loader::loadFromBinary(Track::FileDescription(it->second), shouldAbort, advancement);
+        if(loadedResults.index() == 1_z || !restoreResults(trackAcsr.getAttr<Track::AttrType::results>(), std::get<0_z>(loadedResults)))
+        {
+            releaseRestoredTracks();
+            return juce::Result::fail(juce::translate("The results of the track TRACKNAME cannot be read from the temporary file FLNM!").replace("TRACKNAME", trackAcsr.getAttr<Track::AttrType::name>()).replace("FLNM", it->second.getFullPathName()));
+        }
+        restoredTracks.push_back(trackIdentifier);
+    }
+
+    auto const result = fn();
+    releaseRestoredTracks();
+    return result;
+}
+
+bool Document::Executor::hasProcessingTrack() const
 {
-    MiscDebug("Executor", "Waiting for results...");
     auto const trackAcsrs = mAccessor.getAcsrs<Document::AcsrType::tracks>();
-    if(std::none_of(trackAcsrs.cbegin(), trackAcsrs.cend(), [&](auto const& trackAcsr)
-                    {
-                        auto const& processing = trackAcsr.get().template getAttr<Track::AttrType::processing>();
-                        return std::get<0>(processing) || std::get<2>(processing);
-                    }))
+    return std::any_of(trackAcsrs.cbegin(), trackAcsrs.cend(), [&](auto const& trackAcsr)
+                       {
+                           auto const& processing = trackAcsr.get().template getAttr<Track::AttrType::processing>();
+                           return std::get<0>(processing) || std::get<2>(processing);
+                       });
+}
+
+float Document::Executor::getProgress() const
+{
+    auto const trackAcsrs = mAccessor.getAcsrs<Document::AcsrType::tracks>();
+    if(trackAcsrs.empty())
     {
-        stopTimer();
-        if(onEnded != nullptr)
+        return 1.0f;
+    }
+    auto const progress = std::accumulate(trackAcsrs.cbegin(), trackAcsrs.cend(), 0.0f, [](float value, auto const& trackAcsr)
+                                          {
+                                              auto const& processing = trackAcsr.get().template getAttr<Track::AttrType::processing>();
+                                              return value + (std::get<0>(processing) ? std::get<1>(processing) : 1.0f);
+                                          });
+    return std::clamp(progress / static_cast<float>(trackAcsrs.size()), 0.0f, 1.0f);
+}
+
+void Document::Executor::handleAsyncUpdate()
+{
+    Tracer::ScopedEvent const scopedEvent("Document::Executor::handleAsyncUpdate", "notification");
+    if(!mIsRunning.load())
+    {
+        return;
+    }
+    auto const isSpilling = spillResults();
+    if(hasProcessingTrack())
+    {
+        if(onProgress != nullptr)
         {
-            onEnded();
+            onProgress(getProgress());
         }
+        return;
+    }
+    // The end of the analysis is notified once the results have been spilled so the exports never access the
+    // results while they are released
+    if(isSpilling)
+    {
+        return;
+    }
+    MiscDebug("Executor", "Analysis ended...");
+    mIsRunning.store(false);
+    if(onEnded != nullptr)
+    {
+        onEnded();
     }
 }
 
 bool Document::Executor::isRunning() const
 {
-    return isTimerRunning();
+    return mIsRunning.load();
+}
+
+AlertWindow::Catcher const& Document::Executor::getAlertCatcher() const
+{
+    return mAlertCatcher;
 }
 
 ANALYSE_FILE_END
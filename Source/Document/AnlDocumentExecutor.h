@@ -2,17 +2,25 @@
 
 #include "AnlDocumentDirector.h"
 #include "AnlDocumentExporter.h"
+#include "AnlDocumentTemplate.h"
 
 ANALYSE_FILE_BEGIN
 
 namespace Document
 {
+    //! @brief Loads, analyzes and exports a document without user interface.
+    //! @details The executor listens to the processing state of the tracks and notifies the end of the analysis
+    //! as soon as the analyses, the loadings and the renderings of all the tracks have ended. Once the analysis
+    //! has ended, the document is no longer modified so the results can be exported from any thread.
     class Executor
-    : private juce::Timer
+    : private juce::AsyncUpdater
     {
     public:
         Executor();
-        ~Executor() override = default;
+
+        //! @brief Creates an executor that uses an audio format manager shared with other executors.
+        explicit Executor(juce::AudioFormatManager& audioFormatManager);
+        ~Executor() override;
 
         //! @brief Loads a document from a file.
         juce::Result load(juce::File const& documentFile);
@@ -20,6 +28,24 @@ namespace Document
         //! @brief Loads a document from an audio file and a template file.
         juce::Result load(juce::File const& audioFile, juce::File const& templateFile, bool adaptOnSampleRate);
 
+        //! @brief Loads a document from audio file layouts and a template document.
+        juce::Result load(std::vector<AudioFileLayout> const& audioFileLayouts, Accessor const& templateAccessor, bool adaptOnSampleRate);
+
+        //! @brief Loads a document from audio file layouts and a template that can be used to load several documents.
+        //! @details The template is prepared once for each sample rate so the documents are loaded without parsing
+        //! or adapting the template again.
+        juce::Result load(std::vector<AudioFileLayout> const& audioFileLayouts, Template& documentTemplate, bool adaptOnSampleRate);
+
+        //! @brief Parses a template file to a template document that can be used to load several documents.
+        static juce::Result parseTemplate(juce::File const& templateFile, Accessor& templateAccessor);
+
+        //! @brief Sets the maximum size in bytes of the results kept in memory (0 means no limit).
+        //! @details When the results of the tracks exceed the budget, the results of the tracks whose analyses have
+        //! ended and that are not used as inputs by the tracks still analyzing are written to temporary binary files
+        //! by a worker thread and released. These results are read back from the files one track or one group at a
+        //! time when they are exported. The budget must be set before launching the analysis.
+        void setMemoryBudget(size_t budget);
+
         //! @brief Runs the analysis.
         juce::Result launch();
 
@@ -29,21 +55,75 @@ namespace Document
         //! @brief Exports the results to a file.
         juce::Result exportTo(juce::File const& outputDir, juce::String const& filePrefix, Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults);
 
+        //! @brief Gets the identifiers of the tracks or the groups compatible with the export options.
+        std::set<juce::String> getExportIdentifiers(Exporter::Options const& options, bool useGroupOverview, bool ignoreGridResults) const;
+
+        //! @brief Gets the identifiers of the tracks whose results are known to be incompatible with the export options.
+        //! @details The frame types of these tracks are defined but the export options don't support them (or the
+        //! grid results are ignored). The tracks whose frame types are undefined (a missing plugin or a failed analysis
+        //! for example) are not part of them.
+        std::set<juce::String> getIncompatibleIdentifiers(Exporter::Options const& options, bool ignoreGridResults) const;
+
+        //! @brief Gets the name of the file used to export the results of a track or a group to a directory.
+        juce::String getExportFileName(juce::String const& filePrefix, juce::String const& identifier, Exporter::Options const& options) const;
+
+        //! @brief Exports the results of the tracks or the groups to a file.
+        //! @details This method can be called from any thread once the analysis has ended.
+        juce::Result exportTo(juce::File const& outputDir, juce::String const& filePrefix, std::set<juce::String> const& identifiers, Exporter::Options const& options, std::atomic<bool> const& shouldAbort);
+
+        //! @brief Exports the results of a track or a group to a file.
+        //! @details This method can be called from any thread once the analysis has ended.
+        juce::Result exportTo(juce::File const& file, juce::String const& identifier, Exporter::Options const& options, std::atomic<bool> const& shouldAbort);
+
+        //! @brief Gets the durations of the stages and the peak memory of the results of the tracks and the durations of the exports of the groups.
+        nlohmann::json getProfile() const;
+
+        //! @brief Gets the alert messages generated while loading and analyzing the document.
+        AlertWindow::Catcher const& getAlertCatcher() const;
+
         //! @brief Checks if the executor is currently running.
         bool isRunning() const;
 
+        //! @brief Gets the progress of the analyses of the tracks (between 0 and 1).
+        float getProgress() const;
+
+        //! @brief The callback that is called when the progress of the analyses has changed.
+        std::function<void(float)> onProgress = nullptr;
+
         //! @brief The callback that is called when the analysis has ended.
         std::function<void(void)> onEnded = nullptr;
 
     private:
-        // juce::Timer
-        void timerCallback() override;
+        explicit Executor(std::unique_ptr<juce::AudioFormatManager> audioFormatManager);
+
+        // juce::AsyncUpdater
+        void handleAsyncUpdate() override;
+
+        bool hasProcessingTrack() const;
+        void addExportDuration(juce::String const& identifier, double duration);
+
+        bool spillResults();
+        void clearSpilledResults();
+        juce::Result performWithResults(juce::String const& identifier, std::function<juce::Result(void)> const& fn);
 
-        juce::AudioFormatManager mAudioFormatManager;
+        std::unique_ptr<juce::AudioFormatManager> mOwnedAudioFormatManager;
+        juce::AudioFormatManager& mAudioFormatManager;
         juce::UndoManager mUndoManager;
         AlertWindow::Catcher mAlertCatcher;
         Accessor mAccessor;
         Director mDirector{mAccessor, mAudioFormatManager, mUndoManager};
+        Accessor::Listener mListener{typeid(*this).name()};
+        std::vector<std::unique_ptr<Track::Accessor::SmartListener>> mTrackListeners;
+        std::atomic<bool> mIsRunning{false};
+        mutable std::mutex mProfileMutex;
+        std::map<juce::String, double> mGroupExportDurations;
+        size_t mMemoryBudget{0_z};
+        std::map<juce::String, size_t> mResidentSizes;
+        std::mutex mSpillMutex;
+        juce::File mSpillDirectory;
+        std::map<juce::String, juce::File> mSpilledFiles;
+        std::set<juce::String> mUnspilledTracks;
+        std::future<void> mSpillProcess;
     };
 } // namespace Document
 
@@ -0,0 +1,210 @@
+#include "AnlDocumentExportManifest.h"
+#include "AnlDocumentTools.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    juce::String toString(std::unique_ptr<juce::XmlElement> const& xml)
+    {
+        return xml != nullptr ? xml->toString(juce::XmlElement::TextFormat().singleLine().withoutHeader()) : juce::String{};
+    }
+} // namespace
+
+Document::ExportManifest::ExportManifest(juce::File const& directory)
+: mFile(directory.getChildFile(fileName))
+{
+}
+
+juce::Result Document::ExportManifest::load()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    if(!mFile.existsAsFile())
+    {
+        return juce::Result::ok();
+    }
+
+    nlohmann::json container;
+    try
+    {
+        container = nlohmann::json::parse(mFile.loadFileAsString().toStdString());
+    }
+    catch(nlohmann::json::parse_error& e)
+    {
+        return juce::Result::fail(juce::translate(e.what()));
+    }
+    if(!container.is_object() || !container.contains("inputs") || !container.at("inputs").is_object())
+    {
+        return juce::Result::fail(juce::translate("The export manifest file FLNM cannot be parsed!").replace("FLNM", mFile.getFullPathName()));
+    }
+    for(auto const& [input, identifiers] : container.at("inputs").items())
+    {
+        if(!identifiers.is_object())
+        {
+            continue;
+        }
+        auto& entries = mEntries[juce::String(input)];
+        for(auto const& [identifier, value] : identifiers.items())
+        {
+            Entry entry;
+            entry.hash = juce::String(value.value("hash", std::string{}));
+            auto const file = juce::String(value.value("file", std::string{}));
+            entry.file = file.isEmpty() ? juce::File{} : mFile.getSiblingFile(file);
+            entries[juce::String(identifier)] = entry;
+        }
+    }
+    return juce::Result::ok();
+}
+
+juce::Result Document::ExportManifest::save() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto inputs = nlohmann::json::object();
+    for(auto const& [input, entries] : mEntries)
+    {
+        auto identifiers = nlohmann::json::object();
+        for(auto const& [identifier, entry] : entries)
+        {
+            auto value = nlohmann::json::object();
+            value["hash"] = entry.hash.toStdString();
+            value["file"] = entry.file == juce::File{} ? std::string{} : entry.file.getRelativePathFrom(mFile.getParentDirectory()).toStdString();
+            identifiers[identifier.toStdString()] = std::move(value);
+        }
+        inputs[input.toStdString()] = std::move(identifiers);
+    }
+    nlohmann::json container;
+    container["version"] = 1;
+    container["inputs"] = std::move(inputs);
+    if(!mFile.replaceWithText(container.dump(4)))
+    {
+        return juce::Result::fail(juce::translate("The export manifest file FLNM cannot be written!").replace("FLNM", mFile.getFullPathName()));
+    }
+    return juce::Result::ok();
+}
+
+juce::String Document::ExportManifest::getInput(std::vector<AudioFileLayout> const& reader)
+{
+    if(reader.empty())
+    {
+        return {};
+    }
+    auto input = reader.front().file.getFullPathName();
+    if(reader.size() == 1_z)
+    {
+        input << "#" << juce::String(reader.front().channel);
+    }
+    return input;
+}
+
+juce::String Document::ExportManifest::getHash(Accessor const& templateAccessor, std::vector<AudioFileLayout> const& reader, juce::String const& identifier, juce::String const& configuration)
+{
+    auto text = configuration;
+    for(auto const& layout : reader)
+    {
+        text << layout.file.getFullPathName() << ":" << juce::String(layout.channel) << ":" << juce::String(layout.file.getSize()) << ":" << juce::String(layout.file.getLastModificationTime().toMilliseconds()) << ";";
+    }
+    std::set<juce::String> trackIdentifiers;
+    if(Tools::hasTrackAcsr(templateAccessor, identifier))
+    {
+        // The name of the group is used by the name of the exported file
+        auto const& groupAcsr = Tools::getGroupAcsrForTrack(templateAccessor, identifier);
+        text << groupAcsr.getAttr<Group::AttrType::name>();
+        text << toString(Tools::getTrackAcsr(templateAccessor, identifier).toXml("track"));
+        trackIdentifiers.insert(identifier);
+    }
+    else if(Tools::hasGroupAcsr(templateAccessor, identifier))
+    {
+        text << toString(Tools::getGroupAcsr(templateAccessor, identifier).toXml("group"));
+        for(auto const& trackIdentifier : Tools::getEffectiveTrackIdentifiers(templateAccessor, identifier))
+        {
+            text << toString(Tools::getTrackAcsr(templateAccessor, trackIdentifier).toXml("track"));
+            trackIdentifiers.insert(trackIdentifier);
+        }
+    }
+    // The results depend on the states of the input tracks
+    for(auto const& inputIdentifier : Tools::getInputTrackIdentifiers(templateAccessor, trackIdentifiers))
+    {
+        text << toString(Tools::getTrackAcsr(templateAccessor, inputIdentifier).toXml("input"));
+    }
+    return juce::String::toHexString(text.hashCode64());
+}
+
+bool Document::ExportManifest::isUpToDate(juce::String const& input, juce::String const& identifier, juce::String const& hash) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const inputIt = mEntries.find(input);
+    if(inputIt == mEntries.cend())
+    {
+        return false;
+    }
+    auto const it = inputIt->second.find(identifier);
+    if(it == inputIt->second.cend())
+    {
+        return false;
+    }
+    return it->second.hash == hash && (it->second.file == juce::File{} || it->second.file.existsAsFile());
+}
+
+juce::File Document::ExportManifest::claimFile(juce::String const& input, juce::String const& identifier, juce::String const& fileName)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const isClaimed = [&](juce::File const& file)
+    {
+        for(auto const& [otherInput, entries] : mEntries)
+        {
+            for(auto const& [otherIdentifier, entry] : entries)
+            {
+                if(entry.file == file && (otherInput != input || otherIdentifier != identifier))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    auto& entry = mEntries[input][identifier];
+    // The previous file of the entry is replaced but the other files of the directory are preserved
+    auto const previousFile = entry.file;
+    auto const isUsed = [&](juce::File const& file)
+    {
+        return isClaimed(file) || (file != previousFile && file.exists());
+    };
+
+    auto file = mFile.getSiblingFile(fileName);
+    auto const name = file.getFileNameWithoutExtension();
+    auto const extension = file.getFileExtension();
+    for(auto index = 2; isUsed(file); ++index)
+    {
+        file = mFile.getSiblingFile(name + " (" + juce::String(index) + ")" + extension);
+    }
+    entry.file = file;
+    // The entry is invalidated until the export is recorded
+    entry.hash.clear();
+    return file;
+}
+
+void Document::ExportManifest::setEntry(juce::String const& input, juce::String const& identifier, juce::String const& hash, juce::File const& file)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto& entry = mEntries[input][identifier];
+    entry.hash = hash;
+    entry.file = file;
+}
+
+void Document::ExportManifest::retainEntries(juce::String const& input, std::set<juce::String> const& identifiers)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const it = mEntries.find(input);
+    if(it == mEntries.end())
+    {
+        return;
+    }
+    for(auto entryIt = it->second.begin(); entryIt != it->second.end();)
+    {
+        entryIt = identifiers.count(entryIt->first) > 0_z ? std::next(entryIt) : it->second.erase(entryIt);
+    }
+}
+
+ANALYSE_FILE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "AnlDocumentModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Document
+{
+    //! @brief The manifest of the results exported incrementally to a directory.
+    //! @details The manifest is stored in the output directory and associates the hash of the inputs of each track
+    //! or group exported for an audio file (the audio files, the track or the group of the template, the tracks they
+    //! use as inputs and the export configuration) to the exported file, so the tracks and the groups whose inputs
+    //! have not changed are neither analyzed nor exported again. Like a build system, the audio files are identified by their paths, sizes and
+    //! modification times rather than by their content. The manifest can be accessed from several threads.
+    class ExportManifest
+    {
+    public:
+        explicit ExportManifest(juce::File const& directory);
+        ~ExportManifest() = default;
+
+        //! @brief Loads the manifest from the directory if it exists.
+        juce::Result load();
+
+        //! @brief Saves the manifest to the directory.
+        juce::Result save() const;
+
+        //! @brief Gets the key of the entries of an audio file.
+        //! @details The channel is part of the key of a single layout so the channels of an audio file processed separately don't share their entries.
+        static juce::String getInput(std::vector<AudioFileLayout> const& reader);
+
+        //! @brief Gets the hash of the inputs of a track or a group of a template document for an audio file.
+        static juce::String getHash(Accessor const& templateAccessor, std::vector<AudioFileLayout> const& reader, juce::String const& identifier, juce::String const& configuration);
+
+        //! @brief Checks if the results of a track or a group exported for an audio file are up-to-date.
+        bool isUpToDate(juce::String const& input, juce::String const& identifier, juce::String const& hash) const;
+
+        //! @brief Gets the file to use to export the results of a track or a group for an audio file.
+        //! @details The file previously exported for the track or the group is replaced, another name is used if the
+        //! file is already used by another track or group or if the file exists and has not been exported for the
+        //! track or the group.
+        juce::File claimFile(juce::String const& input, juce::String const& identifier, juce::String const& fileName);
+
+        //! @brief Records the export of the results of a track or a group for an audio file.
+        //! @details The file is empty if nothing has been exported (an incompatible track for example).
+        void setEntry(juce::String const& input, juce::String const& identifier, juce::String const& hash, juce::File const& file);
+
+        //! @brief Removes the entries of an audio file whose tracks or groups are not in the set.
+        void retainEntries(juce::String const& input, std::set<juce::String> const& identifiers);
+
+        static auto constexpr fileName = ".partiels-manifest.json";
+
+    private:
+        struct Entry
+        {
+            juce::String hash;
+            juce::File file;
+        };
+
+        juce::File const mFile;
+        mutable std::mutex mMutex;
+        std::map<juce::String, std::map<juce::String, Entry>> mEntries;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ExportManifest)
+    };
+} // namespace Document
+
+ANALYSE_FILE_END
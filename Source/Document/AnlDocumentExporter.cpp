@@ -60,6 +60,10 @@ Document::Exporter::Options::Format Document::Exporter::Options::fromFileDescrip
             return Format::max;
         case Track::FileDescription::Format::sdif:
             return Format::sdif;
+        case Track::FileDescription::Format::npy:
+            return Format::npy;
+        case Track::FileDescription::Format::npz:
+            return Format::npz;
     }
     return Format::csv;
 }
@@ -183,6 +187,10 @@ bool Document::Exporter::Options::isCompatible(Track::FrameType frameType) const
             return true;
         case Format::sdif:
             return true;
+        case Format::npy:
+            return frameType != Track::FrameType::label;
+        case Format::npz:
+            return frameType != Track::FrameType::label;
     }
     return false;
 }
@@ -280,7 +288,7 @@ Document::Exporter::Panel::Panel(Accessor& accessor, bool showTimeRange, bool sh
                       {
                           setTimeRange(getTimeRange().withLength(time), true, juce::NotificationType::sendNotificationSync);
                       })
-, mPropertyFormat(juce::translate("Format"), juce::translate("Select the export format"), "", {"JPEG", "PNG", "CSV", "LAB", "JSON", "CUE", "REAPER", "PUREDATA (text)", "MAX (coll)", "SDIF"}, [this](size_t index)
+, mPropertyFormat(juce::translate("Format"), juce::translate("Select the export format"), "", {"JPEG", "PNG", "CSV", "LAB", "JSON", "CUE", "REAPER", "PUREDATA (text)", "MAX (coll)", "SDIF", "NPY", "NPZ"}, [this](size_t index)
                   {
                       auto options = mOptions;
                       options.format = magic_enum::enum_value<Options::Format>(index);
@@ -769,6 +777,13 @@ void Document::Exporter::Panel::setSelectedIdentifiers(std::set<juce::String> co
                                       });
     mPropertyFormat.entry.setItemEnabled(mPropertyFormat.entry.getItemId(static_cast<int>(Options::Format::cue)), hasLabel);
     mPropertyFormat.entry.setItemEnabled(mPropertyFormat.entry.getItemId(static_cast<int>(Options::Format::reaper)), hasLabel);
+    auto const hasValue = std::any_of(tracks.cbegin(), tracks.cend(), [](auto const& trackAcsr)
+                                      {
+                                          auto const frameType = Track::Tools::getFrameType(trackAcsr.get());
+                                          return frameType.has_value() && frameType.value() != Track::FrameType::label;
+                                      });
+    mPropertyFormat.entry.setItemEnabled(mPropertyFormat.entry.getItemId(static_cast<int>(Options::Format::npy)), hasValue);
+    mPropertyFormat.entry.setItemEnabled(mPropertyFormat.entry.getItemId(static_cast<int>(Options::Format::npz)), hasValue);
     sanitizeProperties(false);
 
     if(notification == juce::NotificationType::dontSendNotification)
@@ -1215,17 +1230,252 @@ void Document::Exporter::Panel::handleCommandMessage(int commandId)
     }
 }
 
-juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File const directory, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, std::set<juce::String> const& identifiers, Options const& options, std::atomic<bool> const& shouldAbort)
+namespace
 {
+    std::tuple<int, int, int, int> getImageSizes(juce::String const& identifier, Document::Exporter::Options const& options)
+    {
+        if(options.useAutoSize)
+        {
+            auto const autoBounds = Document::Exporter::getPlotBounds(identifier);
+            auto const outsideBorder = Track::Renderer::getOutsideGridBorder(options.outsideGridJustification);
+            auto const bounds = outsideBorder.addedTo(autoBounds);
+            auto const scaledBounds = juce::Desktop::getInstance().getDisplays().logicalToPhysical(bounds);
+            return std::make_tuple(bounds.getWidth(), bounds.getHeight(), scaledBounds.getWidth(), scaledBounds.getHeight());
+        }
+        return std::make_tuple(options.imageWidth, options.imageHeight, static_cast<int>(std::round(static_cast<double>(options.imageWidth) * static_cast<double>(options.imagePpi) / 72.0)), static_cast<int>(std::round(static_cast<double>(options.imageHeight) * static_cast<double>(options.imagePpi) / 72.0)));
+    }
+
+    // The paged results of a track only contain the frames around the visible range of the document, so the
+    // frames of the exported time range are read from the file in a copy of the track that is used for the export.
+    std::unique_ptr<Track::Accessor> copyPagedTrack(Track::Accessor const& trackAcsr)
+    {
+        if(!trackAcsr.getAttr<Track::AttrType::results>().isPaged())
+        {
+            return nullptr;
+        }
+        auto copy = std::make_unique<Track::Accessor>();
+        copy->copyFrom(trackAcsr, NotificationType::synchronous);
+        return copy;
+    }
+
+    juce::Result loadPagedTrack(Track::Accessor& trackAcsr, juce::Range<double> const& timeRange, std::atomic<bool> const& shouldAbort)
+    {
+        auto const range = timeRange.isEmpty() ? Zoom::Range{-1.0, std::numeric_limits<double>::max()} : timeRange;
+        auto const results = trackAcsr.getAttr<Track::AttrType::results>().loadFrames(range, shouldAbort);
+        if(auto const* error = std::get_if<juce::String>(&results))
+        {
+            return juce::Result::fail(juce::translate("The results of the track TRACKNAME cannot be read: REASON").replace("TRACKNAME", trackAcsr.getAttr<Track::AttrType::name>()).replace("REASON", *error));
+        }
+        trackAcsr.setAttr<Track::AttrType::results>(std::get<Track::Results>(results), NotificationType::synchronous);
+        return juce::Result::ok();
+    }
+
+    // Renders and encodes the images of several tracks and groups using a worker per core. Everything
+    // that depends on the message thread (file names, plot sizes, zoom states) is resolved beforehand
+    // and each worker holds at most one image at a time to bound the memory usage.
+    juce::Result exportImagesConcurrently(Document::Accessor const& accessor, juce::File const& directory, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const& filePrefix, std::set<juce::String> const& identifiers, Document::Exporter::Options const& options, bool lockMessageManager, std::atomic<bool> const& shouldAbort, Document::Exporter::DurationFn const& durationFn, Document::Exporter::PerformFn const& performFn)
+    {
+        if(!options.isValid())
+        {
+            MiscDebug("Exporter", "Invalid options");
+            return juce::Result::fail(juce::translate("Invalid options"));
+        }
+        if(accessor.getNumAcsrs<Document::AcsrType::tracks>() == 0_z)
+        {
+            MiscDebug("Exporter", "Empty project");
+            return juce::Result::fail(juce::translate("Empty project"));
+        }
+
+        juce::MessageManager::Lock lock;
+        if(lockMessageManager && !lock.tryEnter())
+        {
+            MiscDebug("Exporter", "threaded access");
+            return juce::Result::fail(juce::translate("Invalid threaded access"));
+        }
+
+        struct Item
+        {
+            juce::String identifier;
+            Track::Accessor const* trackAcsr = nullptr;
+            std::unique_ptr<Track::Accessor> pagedTrackAcsr;
+            Group::Accessor const* groupAcsr = nullptr;
+            std::unique_ptr<Zoom::Accessor> timeZoomAcsr;
+            juce::File file;
+            std::tuple<int, int, int, int> sizes;
+        };
+
+        // The files don't exist yet so the names already attributed must be excluded
+        // to obtain the same names as a sequential export.
+        std::set<juce::File> reservedFiles;
+
+        std::vector<Item> items;
+        items.reserve(identifiers.size());
+        for(auto const& identifier : identifiers)
+        {
+            Item item;
+            item.identifier = identifier;
+            if(Document::Tools::hasTrackAcsr(accessor, identifier))
+            {
+                item.trackAcsr = std::addressof(Document::Tools::getTrackAcsr(accessor, identifier));
+                item.pagedTrackAcsr = copyPagedTrack(*item.trackAcsr);
+            }
+            else if(Document::Tools::hasGroupAcsr(accessor, identifier))
+            {
+                item.groupAcsr = std::addressof(Document::Tools::getGroupAcsr(accessor, identifier));
+            }
+            else
+            {
+                MiscDebug("Exporter", "Invalid identifier");
+                return juce::Result::fail(juce::translate("Invalid identifier"));
+            }
+            item.file = Document::Exporter::reserveFile(directory, Document::Exporter::getFileName(accessor, filePrefix, identifier, options), reservedFiles);
+            item.sizes = getImageSizes(identifier, options);
+            item.timeZoomAcsr = std::make_unique<Zoom::Accessor>();
+            item.timeZoomAcsr->copyFrom(accessor.getAcsr<Document::AcsrType::timeZoom>(), NotificationType::synchronous);
+            if(!timeRange.isEmpty())
+            {
+                item.timeZoomAcsr->setAttr<Zoom::AttrType::visibleRange>(timeRange, NotificationType::synchronous);
+            }
+            items.push_back(std::move(item));
+        }
+        lock.exit();
+
+        std::vector<juce::Result> results(items.size(), juce::Result::ok());
+        std::atomic<size_t> nextItem{0_z};
+        std::atomic<bool> hasFailed{false};
+        auto const exportItems = [&]()
+        {
+            for(auto index = nextItem.fetch_add(1_z); index < items.size() && !shouldAbort.load() && !hasFailed.load(); index = nextItem.fetch_add(1_z))
+            {
+                auto const& item = items[index];
+                auto const exportItem = [&]()
+                {
+                    auto const [width, height, scaledWidth, scaledHeight] = item.sizes;
+                    Tracer::ScopedEvent const scopedEvent("Document::Exporter::exportImage", "export");
+                    auto const startTime = juce::Time::getHighResolutionTicks();
+                    if(item.pagedTrackAcsr != nullptr)
+                    {
+                        auto const loadResult = loadPagedTrack(*item.pagedTrackAcsr, item.timeZoomAcsr->getAttr<Zoom::AttrType::visibleRange>(), shouldAbort);
+                        if(loadResult.failed())
+                        {
+                            return loadResult;
+                        }
+                    }
+                    auto const* trackAcsr = item.pagedTrackAcsr != nullptr ? item.pagedTrackAcsr.get() : item.trackAcsr;
+                    auto const result = trackAcsr != nullptr ? Track::Exporter::toImage(*trackAcsr, *item.timeZoomAcsr, channels, item.file, width, height, scaledWidth, scaledHeight, options.outsideGridJustification, shouldAbort) : Group::Exporter::toImage(*item.groupAcsr, *item.timeZoomAcsr, channels, item.file, width, height, scaledWidth, scaledHeight, options.outsideGridJustification, shouldAbort);
+                    if(durationFn != nullptr)
+                    {
+                        durationFn(item.identifier, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime));
+                    }
+                    return result;
+                };
+                results[index] = performFn != nullptr ? performFn(item.identifier, exportItem) : exportItem();
+                if(results[index].failed())
+                {
+                    hasFailed.store(true);
+                }
+            }
+        };
+
+        auto const numThreads = std::min(items.size(), static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+        std::vector<std::future<void>> workers;
+        for(auto thread = 1_z; thread < numThreads; ++thread)
+        {
+            workers.push_back(std::async(std::launch::async, exportItems));
+        }
+        exportItems();
+        for(auto& worker : workers)
+        {
+            worker.wait();
+        }
+
+        auto const it = std::find_if(results.cbegin(), results.cend(), [](auto const& result)
+                                     {
+                                         return result.failed();
+                                     });
+        if(it != results.cend())
+        {
+            return *it;
+        }
+        if(shouldAbort.load())
+        {
+            MiscDebug("Exporter", "Aborted");
+            return juce::Result::fail(juce::translate("The export has been aborted."));
+        }
+        return juce::Result::ok();
+    }
+
+    juce::String getFileNameWithoutExtension(juce::String const& groupName, juce::String const& trackName, juce::String const& filePrefix)
+    {
+        auto const legalGroupName = juce::File::createLegalFileName(groupName).replace(" ", "_");
+        auto const legalTrackName = juce::File::createLegalFileName(trackName).replace(" ", "_");
+        if(!legalTrackName.isEmpty())
+        {
+            return legalGroupName + "_" + filePrefix + legalTrackName;
+        }
+        return filePrefix + legalGroupName;
+    }
+} // namespace
+
+juce::String Document::Exporter::getFileName(Accessor const& accessor, juce::String const& filePrefix, juce::String const& identifier, Options const& options)
+{
+    if(Tools::hasTrackAcsr(accessor, identifier))
+    {
+        auto const& trackAcsr = Tools::getTrackAcsr(accessor, identifier);
+        auto const& groupAcsr = Tools::getGroupAcsrForTrack(accessor, identifier);
+        return getFileNameWithoutExtension(groupAcsr.getAttr<Group::AttrType::name>(), trackAcsr.getAttr<Track::AttrType::name>(), filePrefix) + "." + options.getFormatExtension();
+    }
+    if(Tools::hasGroupAcsr(accessor, identifier))
+    {
+        auto const& groupAcsr = Tools::getGroupAcsr(accessor, identifier);
+        return getFileNameWithoutExtension(groupAcsr.getAttr<Group::AttrType::name>(), {}, filePrefix) + "." + options.getFormatExtension();
+    }
+    return {};
+}
+
+juce::File Document::Exporter::reserveFile(juce::File const& directory, juce::String const& fileName, std::set<juce::File>& reservedFiles)
+{
+    if(fileName.isEmpty())
+    {
+        return {};
+    }
+    auto const name = directory.getChildFile(fileName).getFileNameWithoutExtension();
+    auto const extension = directory.getChildFile(fileName).getFileExtension();
+    auto file = directory.getNonexistentChildFile(name, extension);
+    for(auto index = 2; reservedFiles.count(file) > 0_z; ++index)
+    {
+        file = directory.getNonexistentChildFile(name + " (" + juce::String(index) + ")", extension);
+    }
+    reservedFiles.insert(file);
+    return file;
+}
+
+juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File const directory, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, std::set<juce::String> const& identifiers, Options const& options, bool lockMessageManager, std::atomic<bool> const& shouldAbort, DurationFn const& durationFn, PerformFn const& performFn)
+{
+    Tracer::ScopedEvent const scopedEvent("Document::Exporter::exportTo", "export");
     MiscWeakAssert(identifiers.size() > 0_z);
     if(identifiers.empty())
     {
         MiscDebug("Exporter", "No identifiers provided");
         return juce::Result::fail(juce::translate("No identifiers provided"));
     }
+    if(options.useImageFormat() && identifiers.size() > 1_z && directory.isDirectory())
+    {
+        return exportImagesConcurrently(accessor, directory, timeRange, channels, filePrefix, identifiers, options, lockMessageManager, shouldAbort, durationFn, performFn);
+    }
     for(auto const& identifier : identifiers)
     {
-        auto const result = exportTo(accessor, directory, timeRange, channels, filePrefix, identifier, options, shouldAbort);
+        auto const exportIdentifier = [&]()
+        {
+            auto const startTime = juce::Time::getHighResolutionTicks();
+            auto const result = exportTo(accessor, directory, timeRange, channels, filePrefix, identifier, options, lockMessageManager, shouldAbort);
+            if(durationFn != nullptr)
+            {
+                durationFn(identifier, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime));
+            }
+            return result;
+        };
+        auto const result = performFn != nullptr ? performFn(identifier, exportIdentifier) : exportIdentifier();
         if(result.failed())
         {
             return result;
@@ -1234,8 +1484,9 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
     return juce::Result::ok();
 }
 
-juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File const file, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, juce::String const& identifier, Options const& options, std::atomic<bool> const& shouldAbort)
+juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File const file, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, juce::String const& identifier, Options const& options, bool lockMessageManager, std::atomic<bool> const& shouldAbort)
 {
+    Tracer::ScopedEvent const scopedEvent("Document::Exporter::exportFile", "export");
     if(file == juce::File())
     {
         MiscDebug("Exporter", "Invalid file");
@@ -1253,7 +1504,7 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
     }
 
     juce::MessageManager::Lock lock;
-    if(!lock.tryEnter())
+    if(lockMessageManager && !lock.tryEnter())
     {
         MiscDebug("Exporter", "threaded access");
         return juce::Result::fail(juce::translate("Invalid threaded access"));
@@ -1265,33 +1516,14 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
         {
             return file.getSiblingFile(filePrefix + file.getFileName());
         }
-        auto const legalGroupName = juce::File::createLegalFileName(groupName).replace(" ", "_");
-        auto const legalTrackName = juce::File::createLegalFileName(trackName).replace(" ", "_");
-        if(!legalTrackName.isEmpty())
-        {
-            return file.getNonexistentChildFile(legalGroupName + "_" + filePrefix + legalTrackName, "." + options.getFormatExtension());
-        }
-        return file.getNonexistentChildFile(filePrefix + legalGroupName, "." + options.getFormatExtension());
+        return file.getNonexistentChildFile(getFileNameWithoutExtension(groupName, trackName, filePrefix), "." + options.getFormatExtension());
     };
 
     if(options.useImageFormat())
     {
-        auto const getSizes = [&]()
-        {
-            if(options.useAutoSize)
-            {
-                auto const autoBounds = getPlotBounds(identifier);
-                auto const outsideBorder = Track::Renderer::getOutsideGridBorder(options.outsideGridJustification);
-                auto const bounds = outsideBorder.addedTo(autoBounds);
-                auto const scaledBounds = juce::Desktop::getInstance().getDisplays().logicalToPhysical(bounds);
-                return std::make_tuple(bounds.getWidth(), bounds.getHeight(), scaledBounds.getWidth(), scaledBounds.getHeight());
-            }
-            return std::make_tuple(options.imageWidth, options.imageHeight, static_cast<int>(std::round(static_cast<double>(options.imageWidth) * static_cast<double>(options.imagePpi) / 72.0)), static_cast<int>(std::round(static_cast<double>(options.imageHeight) * static_cast<double>(options.imagePpi) / 72.0)));
-        };
-
         if(Tools::hasTrackAcsr(accessor, identifier))
         {
-            auto const sizes = getSizes();
+            auto const sizes = getImageSizes(identifier, options);
             auto& trackAcsr = Tools::getTrackAcsr(accessor, identifier);
             Zoom::Accessor timeZoomAcsr;
             timeZoomAcsr.copyFrom(accessor.getAcsr<AcsrType::timeZoom>(), NotificationType::synchronous);
@@ -1301,13 +1533,22 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
             }
             auto const& groupAcsr = Tools::getGroupAcsrForTrack(accessor, identifier);
             auto const fileUsed = getEffectiveFile(groupAcsr.getAttr<Group::AttrType::name>(), trackAcsr.getAttr<Track::AttrType::name>());
+            auto const pagedTrackAcsr = copyPagedTrack(trackAcsr);
             lock.exit();
 
-            return Track::Exporter::toImage(trackAcsr, timeZoomAcsr, channels, fileUsed, std::get<0>(sizes), std::get<1>(sizes), std::get<2>(sizes), std::get<3>(sizes), options.outsideGridJustification, shouldAbort);
+            if(pagedTrackAcsr != nullptr)
+            {
+                auto const loadResult = loadPagedTrack(*pagedTrackAcsr, timeZoomAcsr.getAttr<Zoom::AttrType::visibleRange>(), shouldAbort);
+                if(loadResult.failed())
+                {
+                    return loadResult;
+                }
+            }
+            return Track::Exporter::toImage(pagedTrackAcsr != nullptr ? *pagedTrackAcsr : trackAcsr, timeZoomAcsr, channels, fileUsed, std::get<0>(sizes), std::get<1>(sizes), std::get<2>(sizes), std::get<3>(sizes), options.outsideGridJustification, shouldAbort);
         }
         else if(Tools::hasGroupAcsr(accessor, identifier))
         {
-            auto const sizes = getSizes();
+            auto const sizes = getImageSizes(identifier, options);
             auto& groupAcsr = Tools::getGroupAcsr(accessor, identifier);
             Zoom::Accessor timeZoomAcsr;
             timeZoomAcsr.copyFrom(accessor.getAcsr<AcsrType::timeZoom>(), NotificationType::synchronous);
@@ -1346,8 +1587,18 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
         }
         auto const& groupAcsr = Tools::getGroupAcsrForTrack(accessor, identifier);
         auto const fileUsed = getEffectiveFile(groupAcsr.getAttr<Group::AttrType::name>(), trackAcsr.getAttr<Track::AttrType::name>());
+        auto const pagedTrackAcsr = copyPagedTrack(trackAcsr);
         lock.exit();
 
+        if(pagedTrackAcsr != nullptr)
+        {
+            auto const loadResult = loadPagedTrack(*pagedTrackAcsr, timeRange, shouldAbort);
+            if(loadResult.failed())
+            {
+                return loadResult;
+            }
+        }
+        auto const& exportTrackAcsr = pagedTrackAcsr != nullptr ? *pagedTrackAcsr : trackAcsr;
         switch(options.format)
         {
             case Options::Format::jpeg:
@@ -1357,26 +1608,30 @@ juce::Result Document::Exporter::exportTo(Accessor const& accessor, juce::File c
                 MiscDebug("Exporter", "Unsupported format");
                 return juce::Result::fail(juce::translate("Unsupported format"));
             case Options::Format::csv:
-                return Track::Exporter::toCsv(trackAcsr, timeRange, channels, fileUsed, options.csvHeaderType, options.getSeparatorChar(), false, options.applyExtraThresholds, "\n", options.disableLabelEscaping, false, shouldAbort);
+                return Track::Exporter::toCsv(exportTrackAcsr, timeRange, channels, fileUsed, options.csvHeaderType, options.getSeparatorChar(), false, options.applyExtraThresholds, "\n", options.disableLabelEscaping, false, shouldAbort);
             case Options::Format::lab:
-                return Track::Exporter::toCsv(trackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, options.getLabSeparatorChar(), true, options.applyExtraThresholds, "\n", options.disableLabelEscaping, false, shouldAbort);
+                return Track::Exporter::toCsv(exportTrackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, options.getLabSeparatorChar(), true, options.applyExtraThresholds, "\n", options.disableLabelEscaping, false, shouldAbort);
             case Options::Format::puredata:
-                return Track::Exporter::toCsv(trackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, ' ', false, options.applyExtraThresholds, ";", true, false, shouldAbort);
+                return Track::Exporter::toCsv(exportTrackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, ' ', false, options.applyExtraThresholds, ";", true, false, shouldAbort);
             case Options::Format::max:
-                return Track::Exporter::toCsv(trackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, ' ', false, options.applyExtraThresholds, ";\n", false, true, shouldAbort);
+                return Track::Exporter::toCsv(exportTrackAcsr, timeRange, channels, fileUsed, Track::Exporter::CsvHeaderType::none, ' ', false, options.applyExtraThresholds, ";\n", false, true, shouldAbort);
             case Options::Format::json:
-                return Track::Exporter::toJson(trackAcsr, timeRange, channels, fileUsed, options.includeDescription, options.applyExtraThresholds, shouldAbort);
+                return Track::Exporter::toJson(exportTrackAcsr, timeRange, channels, fileUsed, options.includeDescription, options.applyExtraThresholds, shouldAbort);
             case Options::Format::cue:
-                return Track::Exporter::toCue(trackAcsr, timeRange, channels, fileUsed, options.applyExtraThresholds, shouldAbort);
+                return Track::Exporter::toCue(exportTrackAcsr, timeRange, channels, fileUsed, options.applyExtraThresholds, shouldAbort);
             case Options::Format::reaper:
-                return Track::Exporter::toReaper(trackAcsr, timeRange, channels, fileUsed, options.reaperType == Options::ReaperType::marker, options.applyExtraThresholds, shouldAbort);
+                return Track::Exporter::toReaper(exportTrackAcsr, timeRange, channels, fileUsed, options.reaperType == Options::ReaperType::marker, options.applyExtraThresholds, shouldAbort);
             case Options::Format::sdif:
             {
                 auto const frameId = SdifConverter::getSignature(options.sdifFrameSignature);
                 auto const matrixId = SdifConverter::getSignature(options.sdifMatrixSignature);
                 auto const columnName = options.sdifColumnName.isEmpty() ? std::optional<juce::String>{} : options.sdifColumnName;
-                return Track::Exporter::toSdif(trackAcsr, timeRange, fileUsed, frameId, matrixId, columnName, shouldAbort);
+                return Track::Exporter::toSdif(exportTrackAcsr, timeRange, fileUsed, frameId, matrixId, columnName, shouldAbort);
             }
+            case Options::Format::npy:
+                return Track::Exporter::toNpy(exportTrackAcsr, timeRange, channels, fileUsed, options.applyExtraThresholds, shouldAbort);
+            case Options::Format::npz:
+                return Track::Exporter::toNpz(exportTrackAcsr, timeRange, channels, fileUsed, options.applyExtraThresholds, shouldAbort);
         }
         MiscDebug("Exporter", "Unsupported format");
         return juce::Result::fail(juce::translate("Unsupported format"));
@@ -1552,7 +1807,7 @@ juce::Result Document::Exporter::consolidateAudioFiles(Accessor& accessor, juce:
     return result;
 }
 
-juce::Result Document::Exporter::consolidateTrackFiles(Accessor& accessor, juce::File directory)
+juce::Result Document::Exporter::consolidateTrackFiles(Accessor& accessor, juce::File directory, bool compact)
 {
     directory = directory.getChildFile("Track");
     auto trackAcsrs = accessor.getAcsrs<AcsrType::tracks>();
@@ -1561,7 +1816,7 @@ juce::Result Document::Exporter::consolidateTrackFiles(Accessor& accessor, juce:
         auto trackFileInfo = trackAcsr.get().getAttr<Track::AttrType::file>();
         if(trackFileInfo.commit.isNotEmpty())
         {
-            auto const trackResult = Track::Exporter::consolidateInDirectory(trackAcsr.get(), directory);
+            auto const trackResult = Track::Exporter::consolidateInDirectory(trackAcsr.get(), directory, compact);
             if(trackResult.failed())
             {
                 return trackResult;
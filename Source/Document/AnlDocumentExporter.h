@@ -34,6 +34,8 @@ namespace Document
                 , puredata
                 , max
                 , sdif
+                , npy
+                , npz
             };
             
             enum class TimePreset
@@ -160,14 +162,34 @@ namespace Document
             LayoutNotifier mDocumentLayoutNotifier;
         };
 
-        juce::Result exportTo(Accessor const& accessor, juce::File const directory, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, juce::String const& identifier, Options const& options, std::atomic<bool> const& shouldAbort);
+        //! @brief Gets the name of the file used to export the results of a track or a group to a directory.
+        //! @details The exports to a directory use another name if the file already exists.
+        juce::String getFileName(Accessor const& accessor, juce::String const& filePrefix, juce::String const& identifier, Options const& options);
 
-        juce::Result exportTo(Accessor const& accessor, juce::File const file, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, std::set<juce::String> const& identifiers, Options const& options, std::atomic<bool> const& shouldAbort);
+        //! @brief Gets a file of a directory that doesn't exist and that hasn't been reserved yet and reserves it.
+        //! @details The concurrent exports that reserve their files beforehand never use the same files.
+        juce::File reserveFile(juce::File const& directory, juce::String const& fileName, std::set<juce::File>& reservedFiles);
+
+        //! @brief Exports the results of a track or a group.
+        //! @details If lockMessageManager is false, the caller must guarantee that the accessor is not modified during
+        //! the export (for example, a document of an executor whose analysis has ended).
+        juce::Result exportTo(Accessor const& accessor, juce::File const directory, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, juce::String const& identifier, Options const& options, bool lockMessageManager, std::atomic<bool> const& shouldAbort);
+
+        //! @brief The function called with the duration of the export of each track or group (in seconds).
+        //! @details The function can be called concurrently from several threads.
+        using DurationFn = std::function<void(juce::String const& identifier, double duration)>;
+
+        //! @brief The function called to perform the export of each track or group.
+        //! @details The function must call the export function and return its result, it can be used to make the
+        //! results available during the export. The function can be called concurrently from several threads.
+        using PerformFn = std::function<juce::Result(juce::String const& identifier, std::function<juce::Result(void)> const& exportFn)>;
+
+        juce::Result exportTo(Accessor const& accessor, juce::File const file, juce::Range<double> const& timeRange, std::set<size_t> const& channels, juce::String const filePrefix, std::set<juce::String> const& identifiers, Options const& options, bool lockMessageManager, std::atomic<bool> const& shouldAbort, DurationFn const& durationFn = nullptr, PerformFn const& performFn = nullptr);
 
         juce::Result clearUnusedAudioFiles(Accessor const& accessor, juce::File directory);
         juce::Result clearUnusedTrackFiles(Accessor const& accessor, juce::File directory);
         juce::Result consolidateAudioFiles(Accessor& accessor, juce::File directory);
-        juce::Result consolidateTrackFiles(Accessor& accessor, juce::File directory);
+        juce::Result consolidateTrackFiles(Accessor& accessor, juce::File directory, bool compact);
     } // namespace Exporter
 } // namespace Document
 
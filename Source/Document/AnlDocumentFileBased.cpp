@@ -158,7 +158,7 @@ juce::File Document::FileBased::getConsolidateDirectory(juce::File const& file)
 juce::Result Document::FileBased::saveDocument(juce::File const& file)
 {
     mDirector.startAction();
-    auto const trackResult = Exporter::consolidateTrackFiles(mAccessor, getConsolidateDirectory(file));
+    auto const trackResult = Exporter::consolidateTrackFiles(mAccessor, getConsolidateDirectory(file), mUseCompactConsolidation);
     if(trackResult.failed())
     {
         mDirector.endAction(ActionState::abort);
@@ -181,6 +181,11 @@ juce::Result Document::FileBased::saveDocument(juce::File const& file)
     return saveResult;
 }
 
+void Document::FileBased::setUseCompactConsolidation(bool state)
+{
+    mUseCompactConsolidation = state;
+}
+
 juce::Result Document::FileBased::consolidate()
 {
     auto file = getFile();
@@ -224,7 +229,7 @@ juce::Result Document::FileBased::consolidate()
             trackAcsr.get().setAttr<Track::AttrType::file>(trackFileInfo, NotificationType::synchronous);
         }
     }
-    auto const trackResult = Exporter::consolidateTrackFiles(mAccessor, directory);
+    auto const trackResult = Exporter::consolidateTrackFiles(mAccessor, directory, mUseCompactConsolidation);
     if(trackResult.failed())
     {
         mDirector.endAction(ActionState::abort);
@@ -18,6 +18,10 @@ namespace Document
         Accessor const& getDefaultAccessor();
 
         juce::Result consolidate();
+
+        //! @brief Sets if the results of the tracks are consolidated with the compact binary format.
+        //! @details The files already consolidated are kept as they are.
+        void setUseCompactConsolidation(bool state);
         juce::Result loadTemplate(juce::File const& file, bool adaptOnSampleRate);
         juce::Result loadBackup(juce::File const& file);
         juce::Result saveBackup(juce::File const& file);
@@ -58,6 +62,7 @@ namespace Document
         std::vector<std::reference_wrapper<Group::Accessor>> mGroupAccessors;
 
         juce::File mLastFile;
+        bool mUseCompactConsolidation{false};
         Accessor mSavedStateAccessor;
         Accessor const mDefaultDdocument;
     };
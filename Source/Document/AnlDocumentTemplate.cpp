@@ -0,0 +1,164 @@
+#include "AnlDocumentTemplate.h"
+#include "../Plugin/AnlPluginListScanner.h"
+
+ANALYSE_FILE_BEGIN
+
+Document::Template::Template(Accessor const& accessor, AdaptationRule adaptationRule)
+: mAdaptationRule(adaptationRule)
+{
+    mAccessor.copyFrom(accessor, NotificationType::synchronous);
+}
+
+Document::Accessor const& Document::Template::getAccessor() const
+{
+    return mAccessor;
+}
+
+Document::Template::AdaptationRule Document::Template::getAdaptationRule() const
+{
+    return mAdaptationRule;
+}
+
+void Document::Template::retainTracks(std::set<juce::String> const& identifiers)
+{
+    for(auto groupAcsr : mAccessor.getAcsrs<AcsrType::groups>())
+    {
+        auto const groupLayout = copy_with_erased_if(groupAcsr.get().getAttr<Group::AttrType::layout>(), [&](auto const& identifier)
+                                                     {
+                                                         return identifiers.count(identifier) == 0_z;
+                                                     });
+        groupAcsr.get().setAttr<Group::AttrType::layout>(groupLayout, NotificationType::synchronous);
+    }
+    auto const trackAcsrs = mAccessor.getAcsrs<AcsrType::tracks>();
+    for(auto index = trackAcsrs.size(); index > 0_z; --index)
+    {
+        if(identifiers.count(trackAcsrs[index - 1_z].get().getAttr<Track::AttrType::identifier>()) == 0_z)
+        {
+            mAccessor.eraseAcsr<AcsrType::tracks>(index - 1_z, NotificationType::synchronous);
+        }
+    }
+    mPreparedAccessors.clear();
+}
+
+void Document::Template::applyTo(Accessor& accessor, bool adaptOnSampleRate)
+{
+    auto& preparedAcsr = getPreparedAccessor(accessor.getAttr<AttrType::samplerate>(), adaptOnSampleRate);
+    // The reader is set before copying the document so the audio files are not changed by the copy
+    preparedAcsr.setAttr<AttrType::reader>(accessor.getAttr<AttrType::reader>(), NotificationType::synchronous);
+    accessor.copyFrom(preparedAcsr, NotificationType::synchronous);
+}
+
+Document::Accessor& Document::Template::getPreparedAccessor(double sampleRate, bool adaptOnSampleRate)
+{
+    auto const templateSampleRate = mAccessor.getAttr<AttrType::samplerate>();
+    auto const shouldAdapt = adaptOnSampleRate && templateSampleRate > 0.0;
+    auto it = mPreparedAccessors.find({sampleRate, shouldAdapt});
+    if(it != mPreparedAccessors.end())
+    {
+        return *it->second.get();
+    }
+
+    MiscDebug("Template", "Prepare template document for " + juce::String(sampleRate) + "Hz...");
+    auto preparedAcsr = std::make_unique<Accessor>();
+    preparedAcsr->copyFrom(mAccessor, NotificationType::synchronous);
+    for(auto trackAcsr : preparedAcsr->getAcsrs<AcsrType::tracks>())
+    {
+        auto trackChannelsLayout = trackAcsr.get().getAttr<Track::AttrType::channelsLayout>();
+        std::fill(trackChannelsLayout.begin(), trackChannelsLayout.end(), true);
+        trackAcsr.get().setAttr<Track::AttrType::channelsLayout>(trackChannelsLayout, NotificationType::synchronous);
+
+        if(shouldAdapt)
+        {
+            auto const ratio = sampleRate / templateSampleRate;
+            auto const adaptAllSizes = mAdaptationRule == AdaptationRule::allSizes;
+            auto state = trackAcsr.get().getAttr<Track::AttrType::state>();
+            if(adaptAllSizes || trackAcsr.get().getAttr<Track::AttrType::description>().defaultState.blockSize == 0_z)
+            {
+                state.blockSize = static_cast<size_t>(std::round(static_cast<double>(state.blockSize) * ratio));
+            }
+            if(adaptAllSizes || trackAcsr.get().getAttr<Track::AttrType::description>().defaultState.stepSize != 0_z)
+            {
+                state.stepSize = static_cast<size_t>(std::round(static_cast<double>(state.stepSize) * ratio));
+            }
+            trackAcsr.get().setAttr<Track::AttrType::state>(state, NotificationType::synchronous);
+        }
+
+        // The descriptions that are not saved in the template are loaded once (after the adaptation that only depends on
+        // the saved descriptions) instead of being loaded by the directors of the tracks of each document
+        auto const& key = trackAcsr.get().getAttr<Track::AttrType::key>();
+        if(trackAcsr.get().getAttr<Track::AttrType::description>() == Plugin::Description{} && key != Plugin::Key{})
+        {
+            try
+            {
+                trackAcsr.get().setAttr<Track::AttrType::description>(PluginList::Scanner::loadDescription(key, sampleRate), NotificationType::synchronous);
+            }
+            catch(...)
+            {
+                // The director of the track reports the error
+            }
+        }
+    }
+    it = mPreparedAccessors.emplace(std::make_tuple(sampleRate, shouldAdapt), std::move(preparedAcsr)).first;
+    return *it->second.get();
+}
+
+class DocumentTemplateUnitTest
+: public juce::UnitTest
+{
+public:
+    DocumentTemplateUnitTest()
+    : juce::UnitTest("Document", "Template")
+    {
+    }
+
+    ~DocumentTemplateUnitTest() override = default;
+
+    void runTest() override
+    {
+        // The description of the track doesn't impose the block size but imposes the step size
+        Document::Accessor templateAcsr;
+        templateAcsr.setAttr<Document::AttrType::samplerate>(44100.0, NotificationType::synchronous);
+        expect(templateAcsr.insertAcsr<Document::AcsrType::tracks>(0_z, NotificationType::synchronous));
+        auto& trackAcsr = templateAcsr.getAcsr<Document::AcsrType::tracks>(0_z);
+        Plugin::State state;
+        state.blockSize = 1024_z;
+        state.stepSize = 512_z;
+        trackAcsr.setAttr<Track::AttrType::state>(state, NotificationType::synchronous);
+
+        auto const getAppliedState = [&](Document::Template::AdaptationRule rule, bool adaptOnSampleRate)
+        {
+            Document::Template documentTemplate(templateAcsr, rule);
+            Document::Accessor accessor;
+            accessor.setAttr<Document::AttrType::samplerate>(88200.0, NotificationType::synchronous);
+            documentTemplate.applyTo(accessor, adaptOnSampleRate);
+            auto const trackAcsrs = accessor.getAcsrs<Document::AcsrType::tracks>();
+            expectEquals(trackAcsrs.size(), 1_z);
+            return trackAcsrs.empty() ? Plugin::State{} : trackAcsrs.front().get().getAttr<Track::AttrType::state>();
+        };
+
+        beginTest("adapt unconstrained sizes");
+        {
+            auto const appliedState = getAppliedState(Document::Template::AdaptationRule::unconstrainedSizes, true);
+            expectEquals(appliedState.blockSize, 2048_z);
+            expectEquals(appliedState.stepSize, 512_z);
+        }
+
+        beginTest("adapt all sizes");
+        {
+            auto const appliedState = getAppliedState(Document::Template::AdaptationRule::allSizes, true);
+            expectEquals(appliedState.blockSize, 2048_z);
+            expectEquals(appliedState.stepSize, 1024_z);
+        }
+
+        beginTest("no adaptation");
+        {
+            auto const appliedState = getAppliedState(Document::Template::AdaptationRule::allSizes, false);
+            expectEquals(appliedState.blockSize, 1024_z);
+            expectEquals(appliedState.stepSize, 512_z);
+        }
+    }
+};
+
+static DocumentTemplateUnitTest documentTemplateUnitTest;
+
+ANALYSE_FILE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "AnlDocumentModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Document
+{
+    //! @brief A template document prepared once and applied to the documents of several audio files.
+    //! @details The template document is prepared for each sample rate the first time it is used: the plugin
+    //! descriptions that are not saved in the template are loaded, the channels of the tracks are enabled and the
+    //! block sizes and the step sizes are adapted to the sample rate if necessary (using the adaptation rule). The
+    //! prepared documents are kept so applying the template to a new audio file layout with a known sample rate only
+    //! copies the prepared document. The template must be used from the message thread.
+    class Template
+    {
+    public:
+        //! @brief The rule used to adapt the block sizes and the step sizes to the sample rate.
+        enum class AdaptationRule
+        {
+            unconstrainedSizes, //!< Only the sizes that are not imposed by the plugins are adapted (as when loading a template file)
+            allSizes //!< The sizes of all the tracks are adapted (as the batch processing of the application)
+        };
+
+        explicit Template(Accessor const& accessor, AdaptationRule adaptationRule = AdaptationRule::unconstrainedSizes);
+        ~Template() = default;
+
+        //! @brief Gets the template document.
+        Accessor const& getAccessor() const;
+
+        //! @brief Gets the rule used to adapt the block sizes and the step sizes to the sample rate.
+        AdaptationRule getAdaptationRule() const;
+
+        //! @brief Removes the tracks that are not in the set from the template document and from its groups.
+        void retainTracks(std::set<juce::String> const& identifiers);
+
+        //! @brief Copies the template document prepared for the sample rate of the audio files of a document.
+        //! @details The audio files must be loaded in the document beforehand.
+        void applyTo(Accessor& accessor, bool adaptOnSampleRate);
+
+    private:
+        Accessor& getPreparedAccessor(double sampleRate, bool adaptOnSampleRate);
+
+        Accessor mAccessor;
+        AdaptationRule const mAdaptationRule;
+        std::map<std::tuple<double, bool>, std::unique_ptr<Accessor>> mPreparedAccessors;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Template)
+    };
+} // namespace Document
+
+ANALYSE_FILE_END
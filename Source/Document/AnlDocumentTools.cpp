@@ -68,6 +68,30 @@ std::vector<juce::String> Document::Tools::getEffectiveTrackIdentifiers(Accessor
                                });
 }
 
+std::set<juce::String> Document::Tools::getInputTrackIdentifiers(Accessor const& accessor, std::set<juce::String> const& trackIdentifiers)
+{
+    std::set<juce::String> inputIdentifiers;
+    std::vector<juce::String> pendingIdentifiers(trackIdentifiers.cbegin(), trackIdentifiers.cend());
+    while(!pendingIdentifiers.empty())
+    {
+        auto const identifier = pendingIdentifiers.back();
+        pendingIdentifiers.pop_back();
+        if(!hasTrackAcsr(accessor, identifier))
+        {
+            continue;
+        }
+        for(auto const& input : getTrackAcsr(accessor, identifier).getAttr<Track::AttrType::inputs>())
+        {
+            // The identifiers already visited are ignored so the cyclic dependencies don't loop
+            if(input.second.isNotEmpty() && hasTrackAcsr(accessor, input.second) && inputIdentifiers.insert(input.second).second)
+            {
+                pendingIdentifiers.push_back(input.second);
+            }
+        }
+    }
+    return inputIdentifiers;
+}
+
 Track::Accessor const& Document::Tools::getTrackAcsr(Accessor const& accessor, juce::String const& identifier)
 {
     auto const trackAcsrs = accessor.getAcsrs<AcsrType::tracks>();
@@ -25,6 +25,8 @@ namespace Document
         std::vector<juce::String> getEffectiveGroupIdentifiers(Accessor const& accessor);
         std::vector<juce::String> getEffectiveTrackIdentifiers(Accessor const& accessor);
         std::vector<juce::String> getEffectiveTrackIdentifiers(Accessor const& accessor, juce::String const& groupIdentifier);
+        //! @brief Gets the tracks used as inputs by the tracks, directly or through other input tracks.
+        std::set<juce::String> getInputTrackIdentifiers(Accessor const& accessor, std::set<juce::String> const& trackIdentifiers);
 
         Track::Accessor const& getTrackAcsr(Accessor const& accessor, juce::String const& identifier);
         Group::Accessor const& getGroupAcsr(Accessor const& accessor, juce::String const& identifier);
@@ -1,54 +1,57 @@
 #include "AnlGroupExporter.h"
+#include "../Track/AnlTrackExporter.h"
 #include "../Track/AnlTrackRenderer.h"
 #include "AnlGroupPlot.h"
 
 ANALYSE_FILE_BEGIN
 
-juce::Image Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, int width, int height, int scaledWidth, int scaledHeight, Zoom::Grid::Justification outsideGridOptions)
+namespace
 {
-    juce::Image image(juce::Image::PixelFormat::ARGB, scaledWidth, scaledHeight, true);
-    juce::Graphics g(image);
-    g.setImageResamplingQuality(juce::Graphics::ResamplingQuality::highResamplingQuality);
-    auto const scaleWidth = static_cast<float>(scaledWidth) / static_cast<float>(width);
-    auto const scaleHeight = static_cast<float>(scaledHeight) / static_cast<float>(height);
-    g.addTransform(juce::AffineTransform::scale(scaleWidth, scaleHeight));
-    g.fillAll(accessor.getAttr<AttrType::colour>());
-    auto const bounds = juce::Rectangle<int>(0, 0, width, height);
-    auto const& laf = juce::Desktop::getInstance().getDefaultLookAndFeel();
-
-    auto const referenceTrackAcsr = Tools::getReferenceTrackAcsr(accessor);
-    auto const& layout = accessor.getAttr<AttrType::layout>();
-    for(auto it = layout.crbegin(); it != layout.crend(); ++it)
+    void paintImage(Group::Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, juce::Graphics& g, int width, int height, Zoom::Grid::Justification outsideGridOptions)
     {
-        auto const trackAcsr = Tools::getTrackAcsr(accessor, *it);
-        if(trackAcsr.has_value() && trackAcsr.value().get().getAttr<Track::AttrType::showInGroup>())
+        g.fillAll(accessor.getAttr<Group::AttrType::colour>());
+        auto const bounds = juce::Rectangle<int>(0, 0, width, height);
+        auto const& laf = juce::Desktop::getInstance().getDefaultLookAndFeel();
+
+        auto const referenceTrackAcsr = Group::Tools::getReferenceTrackAcsr(accessor);
+        auto const& layout = accessor.getAttr<Group::AttrType::layout>();
+        for(auto it = layout.crbegin(); it != layout.crend(); ++it)
         {
-            auto const channelLayout = trackAcsr.value().get().getAttr<Track::AttrType::channelsLayout>();
-            auto channelVisibility = channels.empty() ? channelLayout : std::vector<bool>(channelLayout.size(), false);
-            for(auto const& channel : channels)
+            auto const trackAcsr = Group::Tools::getTrackAcsr(accessor, *it);
+            if(trackAcsr.has_value() && trackAcsr.value().get().getAttr<Track::AttrType::showInGroup>())
             {
-                if(channel < channelVisibility.size())
+                auto const channelLayout = trackAcsr.value().get().getAttr<Track::AttrType::channelsLayout>();
+                auto channelVisibility = channels.empty() ? channelLayout : std::vector<bool>(channelLayout.size(), false);
+                for(auto const& channel : channels)
                 {
-                    channelVisibility[channel] = true;
+                    if(channel < channelVisibility.size())
+                    {
+                        channelVisibility[channel] = true;
+                    }
                 }
+                auto const isSelected = referenceTrackAcsr.has_value() && std::addressof(trackAcsr.value().get()) == std::addressof(referenceTrackAcsr.value().get());
+                auto const colour = isSelected ? laf.findColour(Decorator::ColourIds::normalBorderColourId) : juce::Colours::transparentBlack;
+                Track::Renderer::paint(trackAcsr.value().get(), timeZoomAccessor, g, bounds, channelVisibility, colour, outsideGridOptions);
             }
-            auto const isSelected = referenceTrackAcsr.has_value() && std::addressof(trackAcsr.value().get()) == std::addressof(referenceTrackAcsr.value().get());
-            auto const colour = isSelected ? laf.findColour(Decorator::ColourIds::normalBorderColourId) : juce::Colours::transparentBlack;
-            Track::Renderer::paint(trackAcsr.value().get(), timeZoomAccessor, g, bounds, channelVisibility, colour, outsideGridOptions);
         }
     }
+} // namespace
+
+juce::Image Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, int width, int height, int scaledWidth, int scaledHeight, Zoom::Grid::Justification outsideGridOptions)
+{
+    juce::Image image(juce::Image::PixelFormat::ARGB, scaledWidth, scaledHeight, true);
+    juce::Graphics g(image);
+    g.setImageResamplingQuality(juce::Graphics::ResamplingQuality::highResamplingQuality);
+    auto const scaleWidth = static_cast<float>(scaledWidth) / static_cast<float>(width);
+    auto const scaleHeight = static_cast<float>(scaledHeight) / static_cast<float>(height);
+    g.addTransform(juce::AffineTransform::scale(scaleWidth, scaleHeight));
+    paintImage(accessor, timeZoomAccessor, channels, g, width, height, outsideGridOptions);
     return image;
 }
 
 juce::Result Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, juce::File const& file, int width, int height, int scaledWidth, int scaledHeight, Zoom::Grid::Justification outsideGridOptions, std::atomic<bool> const& shouldAbort)
 {
-    juce::MessageManager::Lock lock;
-    if(!lock.tryEnter())
-    {
-        return juce::Result::fail(juce::translate("Invalid threaded access"));
-    }
     auto const name = accessor.getAttr<AttrType::name>();
-    lock.exit();
 
     if(width <= 0 || height <= 0)
     {
@@ -56,18 +59,8 @@ juce::Result Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
     }
     juce::TemporaryFile temp(file);
 
-    auto* imageFormat = juce::ImageFileFormat::findImageFormatForFileExtension(temp.getFile());
-    auto const xDensity = std::round(static_cast<double>(scaledWidth) / static_cast<double>(width) * 72.0);
-    auto const yDensity = std::round(static_cast<double>(scaledHeight) / static_cast<double>(height) * 72.0);
-    if(auto* pngFormat = dynamic_cast<juce::PNGImageFormat*>(imageFormat))
-    {
-        pngFormat->setDensity(static_cast<juce::uint32>(xDensity), static_cast<juce::uint32>(yDensity));
-    }
-    else if(auto* jpegFormat = dynamic_cast<juce::JPEGImageFormat*>(imageFormat))
-    {
-        jpegFormat->setDensity(static_cast<juce::uint16>(xDensity), static_cast<juce::uint16>(yDensity));
-    }
-    else
+    auto imageFormat = Track::Exporter::createImageFormat(temp.getFile(), width, height, scaledWidth, scaledHeight);
+    if(imageFormat == nullptr)
     {
         return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the format of the file FLNAME is not supported.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
     }
@@ -77,23 +70,42 @@ juce::Result Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
         return juce::Result::fail(juce::translate("The export of the group ANLNAME to the file FLNAME has been aborted.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
     }
 
-    auto const image = toImage(accessor, timeZoomAccessor, channels, width, height, scaledWidth, scaledHeight, outsideGridOptions);
-    if(image.isValid())
+    // The PNG images are rendered by strips and streamed to the file so large images don't need to be
+    // allocated entirely in memory
+    if(dynamic_cast<juce::PNGImageFormat*>(imageFormat.get()) != nullptr)
     {
         juce::FileOutputStream stream(temp.getFile());
         if(!stream.openedOk())
         {
             return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the output stream of the file FLNAME cannot be opened.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
         }
-
-        if(!imageFormat->writeImageToStream(image, stream))
+        auto const paintFn = [&](juce::Graphics& g)
+        {
+            paintImage(accessor, timeZoomAccessor, channels, g, width, height, outsideGridOptions);
+        };
+        if(!PngStripWriter::write(stream, width, height, scaledWidth, scaledHeight, paintFn, shouldAbort) && !shouldAbort)
         {
-            return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the output stream of the file FLNAME cannot be written.").replace("ANLNAME", accessor.getAttr<AttrType::name>().replace("FLNAME", file.getFullPathName())));
+            return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the output stream of the file FLNAME cannot be written.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
         }
     }
     else
     {
-        return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the image cannot be created.").replace("ANLNAME", name));
+        auto const image = toImage(accessor, timeZoomAccessor, channels, width, height, scaledWidth, scaledHeight, outsideGridOptions);
+        if(!image.isValid())
+        {
+            return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the image cannot be created.").replace("ANLNAME", name));
+        }
+
+        juce::FileOutputStream stream(temp.getFile());
+        if(!stream.openedOk())
+        {
+            return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the output stream of the file FLNAME cannot be opened.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
+        }
+
+        if(!imageFormat->writeImageToStream(image, stream))
+        {
+            return juce::Result::fail(juce::translate("The group ANLNAME can not be exported as image because the output stream of the file FLNAME cannot be written.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
+        }
     }
 
     if(shouldAbort)
@@ -103,7 +115,7 @@ juce::Result Group::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
 
     if(!temp.overwriteTargetFileWithTemporary())
     {
-        return juce::Result::fail(juce::translate("The group ANLNAME can not be written to the file FLNAME. Ensure you have the right access to this file.").replace("ANLNAME", accessor.getAttr<AttrType::name>()).replace("FLNAME", file.getFullPathName()));
+        return juce::Result::fail(juce::translate("The group ANLNAME can not be written to the file FLNAME. Ensure you have the right access to this file.").replace("ANLNAME", name).replace("FLNAME", file.getFullPathName()));
     }
     return juce::Result::ok();
 }
@@ -4,15 +4,11 @@
 
 ANALYSE_FILE_BEGIN
 
-Group::Plot::Plot(Accessor& accessor, Zoom::Accessor& timeZoomAcsr)
-: mAccessor(accessor)
-, mTimeZoomAccessor(timeZoomAcsr)
-, mLayoutNotifier(accessor, [this]()
-                  {
-                      updateContent();
-                  })
+Group::Plot::Layer::Layer(Plot& plot, Track::Accessor& trackAccessor)
+: mPlot(plot)
+, mAccessor(trackAccessor)
 {
-    mTrackListener.onAttrChanged = [this]([[maybe_unused]] Track::Accessor const& acsr, Track::AttrType attribute)
+    mListener.onAttrChanged = [this]([[maybe_unused]] Track::Accessor const& acsr, Track::AttrType attribute)
     {
         switch(attribute)
         {
@@ -36,13 +32,17 @@ Group::Plot::Plot(Accessor& accessor, Zoom::Accessor& timeZoomAcsr)
             case Track::AttrType::oscIdentifier:
             case Track::AttrType::sendViaOsc:
                 break;
+            case Track::AttrType::showInGroup:
+            {
+                setVisible(mAccessor.getAttr<Track::AttrType::showInGroup>());
+            }
+            break;
             case Track::AttrType::grid:
             case Track::AttrType::results:
             case Track::AttrType::edit:
             case Track::AttrType::graphics:
             case Track::AttrType::graphicsSettings:
             case Track::AttrType::channelsLayout:
-            case Track::AttrType::showInGroup:
             case Track::AttrType::extraThresholds:
             case Track::AttrType::zoomLogScale:
             case Track::AttrType::sampleRate:
@@ -74,6 +74,43 @@ Group::Plot::Plot(Accessor& accessor, Zoom::Accessor& timeZoomAcsr)
         repaint();
     };
 
+    setInterceptsMouseClicks(false, false);
+    setCachedComponentImage(new LowResCachedComponentImage(*this));
+    setVisible(mAccessor.getAttr<Track::AttrType::showInGroup>());
+    mAccessor.addListener(mListener, NotificationType::synchronous);
+    mAccessor.getAcsr<Track::AcsrType::valueZoom>().addListener(mZoomListener, NotificationType::synchronous);
+    mAccessor.getAcsr<Track::AcsrType::valueZoom>().getAcsr<Zoom::AcsrType::grid>().addListener(mGridListener, NotificationType::synchronous);
+    mAccessor.getAcsr<Track::AcsrType::binZoom>().addListener(mZoomListener, NotificationType::synchronous);
+    mAccessor.getAcsr<Track::AcsrType::binZoom>().getAcsr<Zoom::AcsrType::grid>().addListener(mGridListener, NotificationType::synchronous);
+    mPlot.mTimeZoomAccessor.addListener(mZoomListener, NotificationType::synchronous);
+}
+
+Group::Plot::Layer::~Layer()
+{
+    mPlot.mTimeZoomAccessor.removeListener(mZoomListener);
+    mAccessor.getAcsr<Track::AcsrType::binZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
+    mAccessor.getAcsr<Track::AcsrType::binZoom>().removeListener(mZoomListener);
+    mAccessor.getAcsr<Track::AcsrType::valueZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
+    mAccessor.getAcsr<Track::AcsrType::valueZoom>().removeListener(mZoomListener);
+    mAccessor.removeListener(mListener);
+}
+
+void Group::Plot::Layer::paint(juce::Graphics& g)
+{
+    auto const referenceTrackAcsr = Tools::getReferenceTrackAcsr(mPlot.mAccessor);
+    auto const isSelected = referenceTrackAcsr.has_value() && std::addressof(mAccessor) == std::addressof(referenceTrackAcsr.value().get());
+    auto const colour = isSelected ? findColour(Decorator::ColourIds::normalBorderColourId) : juce::Colours::transparentBlack;
+    Track::Renderer::paint(mAccessor, mPlot.mTimeZoomAccessor, g, getLocalBounds(), mAccessor.getAttr<Track::AttrType::channelsLayout>(), colour, Zoom::Grid::Justification::none);
+}
+
+Group::Plot::Plot(Accessor& accessor, Zoom::Accessor& timeZoomAcsr)
+: mAccessor(accessor)
+, mTimeZoomAccessor(timeZoomAcsr)
+, mLayoutNotifier(accessor, [this]()
+                  {
+                      updateContent();
+                  })
+{
     mListener.onAttrChanged = [this]([[maybe_unused]] Accessor const& acsr, AttrType attribute)
     {
         switch(attribute)
@@ -89,72 +126,61 @@ Group::Plot::Plot(Accessor& accessor, Zoom::Accessor& timeZoomAcsr)
                 break;
             case AttrType::referenceid:
             {
-                repaint();
+                for(auto const& layer : mLayers.getContents())
+                {
+                    layer.second->repaint();
+                }
             }
             break;
         }
     };
 
     setInterceptsMouseClicks(false, false);
-    setCachedComponentImage(new LowResCachedComponentImage(*this));
     setSize(100, 80);
-    mTimeZoomAccessor.addListener(mZoomListener, NotificationType::synchronous);
     mAccessor.addListener(mListener, NotificationType::synchronous);
 }
 
 Group::Plot::~Plot()
 {
     mAccessor.removeListener(mListener);
-    mTimeZoomAccessor.removeListener(mZoomListener);
-    for(auto& trackAcsr : mTrackAccessors.getContents())
-    {
-        trackAcsr.second.get().getAcsr<Track::AcsrType::binZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
-        trackAcsr.second.get().getAcsr<Track::AcsrType::binZoom>().removeListener(mZoomListener);
-        trackAcsr.second.get().getAcsr<Track::AcsrType::valueZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
-        trackAcsr.second.get().getAcsr<Track::AcsrType::valueZoom>().removeListener(mZoomListener);
-        trackAcsr.second.get().removeListener(mTrackListener);
-    }
 }
 
-void Group::Plot::paint(juce::Graphics& g)
+void Group::Plot::resized()
 {
     auto const bounds = getLocalBounds();
-    auto const& layout = mAccessor.getAttr<AttrType::layout>();
-    auto const referenceTrackAcsr = Tools::getReferenceTrackAcsr(mAccessor);
-    for(auto it = layout.crbegin(); it != layout.crend(); ++it)
+    for(auto const& layer : mLayers.getContents())
     {
-        auto const trackAcsr = Tools::getTrackAcsr(mAccessor, *it);
-        if(trackAcsr.has_value() && trackAcsr.value().get().getAttr<Track::AttrType::showInGroup>())
-        {
-            auto const isSelected = referenceTrackAcsr.has_value() && std::addressof(trackAcsr.value().get()) == std::addressof(referenceTrackAcsr.value().get());
-            auto const colour = isSelected ? findColour(Decorator::ColourIds::normalBorderColourId) : juce::Colours::transparentBlack;
-            Track::Renderer::paint(trackAcsr.value().get(), mTimeZoomAccessor, g, bounds, trackAcsr.value().get().getAttr<Track::AttrType::channelsLayout>(), colour, Zoom::Grid::Justification::none);
-        }
+        layer.second->setBounds(bounds);
     }
 }
 
 void Group::Plot::updateContent()
 {
-    mTrackAccessors.updateContents(
+    mLayers.updateContents(
         mAccessor,
         [this](Track::Accessor& trackAccessor)
         {
-            trackAccessor.addListener(mTrackListener, NotificationType::synchronous);
-            trackAccessor.getAcsr<Track::AcsrType::valueZoom>().addListener(mZoomListener, NotificationType::synchronous);
-            trackAccessor.getAcsr<Track::AcsrType::valueZoom>().getAcsr<Zoom::AcsrType::grid>().addListener(mGridListener, NotificationType::synchronous);
-            trackAccessor.getAcsr<Track::AcsrType::binZoom>().addListener(mZoomListener, NotificationType::synchronous);
-            trackAccessor.getAcsr<Track::AcsrType::binZoom>().getAcsr<Zoom::AcsrType::grid>().addListener(mGridListener, NotificationType::synchronous);
-            return std::ref(trackAccessor);
+            auto layer = std::make_unique<Layer>(*this, trackAccessor);
+            addChildComponent(layer.get());
+            return layer;
         },
-        [this](std::reference_wrapper<Track::Accessor>& content)
+        [this](std::unique_ptr<Layer>& layer)
         {
-            content.get().getAcsr<Track::AcsrType::binZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
-            content.get().getAcsr<Track::AcsrType::binZoom>().removeListener(mZoomListener);
-            content.get().getAcsr<Track::AcsrType::valueZoom>().getAcsr<Zoom::AcsrType::grid>().removeListener(mGridListener);
-            content.get().getAcsr<Track::AcsrType::valueZoom>().removeListener(mZoomListener);
-            content.get().removeListener(mTrackListener);
+            removeChildComponent(layer.get());
         });
-    repaint();
+
+    // The first track of the layout is painted on top of the others
+    auto const& contents = mLayers.getContents();
+    auto const& layout = mAccessor.getAttr<AttrType::layout>();
+    for(auto it = layout.crbegin(); it != layout.crend(); ++it)
+    {
+        auto const layerIt = contents.find(*it);
+        if(layerIt != contents.cend())
+        {
+            layerIt->second->toFront(false);
+        }
+    }
+    resized();
 }
 
 ANALYSE_FILE_END
@@ -15,18 +15,35 @@ namespace Group
         ~Plot() override;
 
         // juce::Component
-        void paint(juce::Graphics& g) override;
+        void resized() override;
 
     private:
+        // Each track is rendered in its own cached layer so that a change
+        // of a track only invalidates the image of this track
+        class Layer
+        : public juce::Component
+        {
+        public:
+            Layer(Plot& plot, Track::Accessor& trackAccessor);
+            ~Layer() override;
+
+            // juce::Component
+            void paint(juce::Graphics& g) override;
+
+        private:
+            Plot& mPlot;
+            Track::Accessor& mAccessor;
+            Track::Accessor::Listener mListener{typeid(*this).name()};
+            Zoom::Accessor::Listener mZoomListener{typeid(*this).name()};
+            Zoom::Grid::Accessor::Listener mGridListener{typeid(*this).name()};
+        };
+
         void updateContent();
 
         Accessor& mAccessor;
         Accessor::Listener mListener{typeid(*this).name()};
         Zoom::Accessor& mTimeZoomAccessor;
-        Zoom::Accessor::Listener mZoomListener{typeid(*this).name()};
-        Zoom::Grid::Accessor::Listener mGridListener{typeid(*this).name()};
-        Track::Accessor::Listener mTrackListener{typeid(*this).name()};
-        TrackMap<std::reference_wrapper<Track::Accessor>> mTrackAccessors;
+        TrackMap<std::unique_ptr<Layer>> mLayers;
         LayoutNotifier mLayoutNotifier;
     };
 } // namespace Group
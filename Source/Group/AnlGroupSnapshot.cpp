@@ -76,7 +76,7 @@ Group::Snapshot::Snapshot(Accessor& accessor, Transport::Accessor& transportAcsr
         {
             case Transport::AttrType::startPlayhead:
             {
-                if(!acsr.getAttr<Transport::AttrType::playback>())
+                if(!acsr.getAttr<Transport::AttrType::playback>() && getContentState(acsr.getAttr<Transport::AttrType::startPlayhead>()) != mPaintedState)
                 {
                     repaint();
                 }
@@ -84,7 +84,7 @@ Group::Snapshot::Snapshot(Accessor& accessor, Transport::Accessor& transportAcsr
             break;
             case Transport::AttrType::runningPlayhead:
             {
-                if(acsr.getAttr<Transport::AttrType::playback>())
+                if(acsr.getAttr<Transport::AttrType::playback>() && getContentState(acsr.getAttr<Transport::AttrType::runningPlayhead>()) != mPaintedState)
                 {
                     repaint();
                 }
@@ -169,6 +169,22 @@ void Group::Snapshot::paint(juce::Graphics& g)
             Track::Snapshot::paint(trackAcsr.value().get(), mTimeZoomAccessor, time, g, bounds, colour);
         }
     }
+    mPaintedState = getContentState(time);
+}
+
+Track::Snapshot::ContentState Group::Snapshot::getContentState(double time) const
+{
+    Track::Snapshot::ContentState state;
+    auto const& layout = mAccessor.getAttr<AttrType::layout>();
+    for(auto const& identifier : layout)
+    {
+        auto const trackAcsr = Tools::getTrackAcsr(mAccessor, identifier);
+        if(trackAcsr.has_value() && trackAcsr.value().get().getAttr<Track::AttrType::showInGroup>())
+        {
+            Track::Snapshot::appendContentState(trackAcsr.value().get(), mTimeZoomAccessor, time, state);
+        }
+    }
+    return state;
 }
 
 void Group::Snapshot::updateContent()
@@ -44,6 +44,7 @@ namespace Group
 
     private:
         void updateContent();
+        Track::Snapshot::ContentState getContentState(double time) const;
 
         Accessor& mAccessor;
         Accessor::Listener mListener{typeid(*this).name()};
@@ -55,6 +56,7 @@ namespace Group
         Track::Accessor::Listener mTrackListener{typeid(*this).name()};
         TrackMap<std::reference_wrapper<Track::Accessor>> mTrackAccessors;
         LayoutNotifier mLayoutNotifier;
+        Track::Snapshot::ContentState mPaintedState;
     };
 } // namespace Group
 
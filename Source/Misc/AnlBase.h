@@ -137,6 +137,7 @@ enum ApplicationCommandIDs : int
     , helpAutoUpdate
     , helpCheckForUpdate
     , helpOpenKeyMappings
+    , helpOpenProfile
 };
 // clang-format on
 
@@ -6,5 +6,7 @@
 #include "AnlHideablePanel.h"
 #include "AnlLoadingIcon.h"
 #include "AnlMouseScroller.h"
+#include "AnlPngStripWriter.h"
 #include "AnlResizerBar.h"
 #include "AnlSdifConverter.h"
+#include "AnlTracer.h"
@@ -0,0 +1,233 @@
+#include "AnlPngStripWriter.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    static constexpr size_t maxStripSize = 8_z * 1024_z * 1024_z;
+    static constexpr size_t minCompressedChunkSize = 64_z * 1024_z;
+
+    std::array<uint32_t, 256> const& getCrcTable()
+    {
+        static auto const table = []()
+        {
+            std::array<uint32_t, 256> values;
+            for(auto index = 0_z; index < values.size(); ++index)
+            {
+                auto value = static_cast<uint32_t>(index);
+                for(auto bit = 0; bit < 8; ++bit)
+                {
+                    value = (value & 1u) != 0u ? 0xedb88320u ^ (value >> 1) : value >> 1;
+                }
+                values[index] = value;
+            }
+            return values;
+        }();
+        return table;
+    }
+
+    uint32_t updateCrc(uint32_t crc, void const* data, size_t size)
+    {
+        auto const& table = getCrcTable();
+        auto const* bytes = static_cast<uint8_t const*>(data);
+        for(auto index = 0_z; index < size; ++index)
+        {
+            crc = table[(crc ^ bytes[index]) & 0xffu] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    void writeBigEndian(uint8_t* data, uint32_t value)
+    {
+        data[0] = static_cast<uint8_t>(value >> 24);
+        data[1] = static_cast<uint8_t>(value >> 16);
+        data[2] = static_cast<uint8_t>(value >> 8);
+        data[3] = static_cast<uint8_t>(value);
+    }
+} // namespace
+
+PngStripWriter::Encoder::Encoder(juce::OutputStream& stream, int width, int height, double xDensity, double yDensity)
+: mStream(stream)
+, mWidth(width)
+, mHeight(height)
+, mRow(static_cast<size_t>(std::max(width, 0)) * 4_z + 1_z, uint8_t(0))
+, mPreviousRow(mRow.size(), uint8_t(0))
+, mCompressor(std::make_unique<juce::GZIPCompressorOutputStream>(mCompressedData))
+{
+    static constexpr uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    mFailed = width <= 0 || height <= 0 || !mStream.write(signature, sizeof(signature));
+
+    // Width, height, 8 bits per sample, RGBA, deflate, adaptive filtering, no interlace
+    uint8_t header[13] = {0};
+    writeBigEndian(header, static_cast<uint32_t>(width));
+    writeBigEndian(header + 4, static_cast<uint32_t>(height));
+    header[8] = 8;
+    header[9] = 6;
+    mFailed = mFailed || !writeChunk("IHDR", header, sizeof(header));
+
+    // The densities are in pixels per inch and the physical dimensions are in pixels per meter
+    uint8_t physical[9] = {0};
+    writeBigEndian(physical, static_cast<uint32_t>(std::round(xDensity / 0.0254)));
+    writeBigEndian(physical + 4, static_cast<uint32_t>(std::round(yDensity / 0.0254)));
+    physical[8] = 1;
+    mFailed = mFailed || !writeChunk("pHYs", physical, sizeof(physical));
+}
+
+bool PngStripWriter::Encoder::writeChunk(char const* type, void const* data, size_t size)
+{
+    uint8_t length[4];
+    writeBigEndian(length, static_cast<uint32_t>(size));
+    auto crc = updateCrc(0xffffffffu, type, 4_z);
+    crc = updateCrc(crc, data, size);
+    uint8_t checksum[4];
+    writeBigEndian(checksum, crc ^ 0xffffffffu);
+    return mStream.write(length, 4_z) && mStream.write(type, 4_z) && (size == 0_z || mStream.write(data, size)) && mStream.write(checksum, 4_z);
+}
+
+bool PngStripWriter::Encoder::writeCompressedData()
+{
+    if(mCompressedData.getDataSize() == 0_z)
+    {
+        return true;
+    }
+    auto const result = writeChunk("IDAT", mCompressedData.getData(), mCompressedData.getDataSize());
+    mCompressedData.reset();
+    return result;
+}
+
+bool PngStripWriter::Encoder::writeRows(juce::Image const& image, int numRows)
+{
+    if(mFailed || mCompressor == nullptr || image.getWidth() < mWidth || image.getHeight() < numRows || mNumRows + numRows > mHeight)
+    {
+        mFailed = true;
+        return false;
+    }
+
+    juce::Image::BitmapData const bitmap(image, 0, 0, mWidth, numRows);
+    for(auto y = 0; y < numRows; ++y)
+    {
+        // The Up filter stores the difference with the previous row, that is very efficient on the
+        // vertical bands of the time-based plots
+        mRow[0_z] = 2;
+        auto* pixels = mRow.data() + 1;
+        for(auto x = 0; x < mWidth; ++x)
+        {
+            auto pixel = *reinterpret_cast<juce::PixelARGB const*>(bitmap.getPixelPointer(x, y));
+            pixel.unpremultiply();
+            pixels[0] = pixel.getRed();
+            pixels[1] = pixel.getGreen();
+            pixels[2] = pixel.getBlue();
+            pixels[3] = pixel.getAlpha();
+            pixels += 4;
+        }
+        for(auto index = 1_z; index < mRow.size(); ++index)
+        {
+            auto const value = mRow[index];
+            mRow[index] = static_cast<uint8_t>(value - mPreviousRow[index]);
+            mPreviousRow[index] = value;
+        }
+        if(!mCompressor->write(mRow.data(), mRow.size()))
+        {
+            mFailed = true;
+            return false;
+        }
+    }
+    mNumRows += numRows;
+
+    if(mCompressedData.getDataSize() >= minCompressedChunkSize)
+    {
+        mFailed = !writeCompressedData();
+    }
+    return !mFailed;
+}
+
+bool PngStripWriter::Encoder::finish()
+{
+    if(mFailed || mCompressor == nullptr || mNumRows != mHeight)
+    {
+        return false;
+    }
+    // The compressor can only be flushed once at the end of the data
+    mCompressor->flush();
+    mCompressor.reset();
+    mFailed = !writeCompressedData() || !writeChunk("IEND", nullptr, 0_z);
+    mStream.flush();
+    return !mFailed;
+}
+
+juce::Point<double> PngStripWriter::getDensity(int width, int height, int scaledWidth, int scaledHeight)
+{
+    auto const xDensity = std::round(static_cast<double>(scaledWidth) / static_cast<double>(width) * 72.0);
+    auto const yDensity = std::round(static_cast<double>(scaledHeight) / static_cast<double>(height) * 72.0);
+    return {xDensity, yDensity};
+}
+
+bool PngStripWriter::write(juce::OutputStream& stream, int width, int height, int scaledWidth, int scaledHeight, PaintFn paintFn, std::atomic<bool> const& shouldAbort)
+{
+    if(width <= 0 || height <= 0 || scaledWidth <= 0 || scaledHeight <= 0 || paintFn == nullptr)
+    {
+        return false;
+    }
+
+    auto const density = getDensity(width, height, scaledWidth, scaledHeight);
+    Encoder encoder(stream, scaledWidth, scaledHeight, density.x, density.y);
+
+    auto const rowSize = static_cast<size_t>(scaledWidth) * 4_z;
+    auto const stripHeight = static_cast<int>(std::clamp(maxStripSize / rowSize, 1_z, static_cast<size_t>(scaledHeight)));
+    auto const numStrips = static_cast<size_t>((scaledHeight + stripHeight - 1) / stripHeight);
+    auto const numThreads = std::min(numStrips, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+
+    // Each thread owns a strip image that is reused for all the batches
+    std::vector<juce::Image> strips;
+    strips.reserve(numThreads);
+    for(auto index = 0_z; index < numThreads; ++index)
+    {
+        strips.emplace_back(juce::Image::PixelFormat::ARGB, scaledWidth, stripHeight, false);
+    }
+
+    auto const scaleWidth = static_cast<float>(scaledWidth) / static_cast<float>(width);
+    auto const scaleHeight = static_cast<float>(scaledHeight) / static_cast<float>(height);
+    auto const paintStrip = [&](size_t stripIndex, juce::Image& strip)
+    {
+        strip.clear(strip.getBounds());
+        juce::Graphics g(strip);
+        g.setImageResamplingQuality(juce::Graphics::ResamplingQuality::highResamplingQuality);
+        auto const offset = static_cast<float>(stripIndex * static_cast<size_t>(stripHeight));
+        g.addTransform(juce::AffineTransform::scale(scaleWidth, scaleHeight).translated(0.0f, -offset));
+        paintFn(g);
+    };
+
+    for(auto batchStart = 0_z; batchStart < numStrips; batchStart += numThreads)
+    {
+        if(shouldAbort)
+        {
+            return false;
+        }
+        auto const batchSize = std::min(numThreads, numStrips - batchStart);
+        std::vector<std::future<void>> workers;
+        for(auto index = 1_z; index < batchSize; ++index)
+        {
+            workers.push_back(std::async(std::launch::async, [&, index]()
+                                         {
+                                             paintStrip(batchStart + index, strips[index]);
+                                         }));
+        }
+        paintStrip(batchStart, strips[0_z]);
+        for(auto& worker : workers)
+        {
+            worker.get();
+        }
+
+        for(auto index = 0_z; index < batchSize; ++index)
+        {
+            auto const stripStart = static_cast<int>((batchStart + index) * static_cast<size_t>(stripHeight));
+            if(!encoder.writeRows(strips[index], std::min(stripHeight, scaledHeight - stripStart)))
+            {
+                return false;
+            }
+        }
+    }
+    return !shouldAbort && encoder.finish();
+}
+
+ANALYSE_FILE_END
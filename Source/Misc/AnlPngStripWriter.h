@@ -0,0 +1,50 @@
+#pragma once
+
+#include "AnlBase.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace PngStripWriter
+{
+    // Encodes a PNG image (8-bit RGBA) progressively, the rows are filtered and compressed as soon as they
+    // are written and the compressed data are written to the stream in IDAT chunks.
+    class Encoder
+    {
+    public:
+        Encoder(juce::OutputStream& stream, int width, int height, double xDensity, double yDensity);
+        ~Encoder() = default;
+
+        bool writeRows(juce::Image const& image, int numRows);
+        bool finish();
+
+    private:
+        bool writeChunk(char const* type, void const* data, size_t size);
+        bool writeCompressedData();
+
+        juce::OutputStream& mStream;
+        int const mWidth;
+        int const mHeight;
+        int mNumRows{0};
+        std::vector<uint8_t> mRow;
+        std::vector<uint8_t> mPreviousRow;
+        juce::MemoryOutputStream mCompressedData;
+        std::unique_ptr<juce::GZIPCompressorOutputStream> mCompressor;
+        bool mFailed{false};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Encoder)
+    };
+
+    // Gets the horizontal and vertical densities (in dots per inch) of an image of width x height points rendered
+    // with scaledWidth x scaledHeight pixels (72 dpi without scaling), used by all the image exports.
+    juce::Point<double> getDensity(int width, int height, int scaledWidth, int scaledHeight);
+
+    using PaintFn = std::function<void(juce::Graphics& g)>;
+
+    // Renders an image of scaledWidth x scaledHeight pixels by horizontal strips that are painted concurrently
+    // in reusable images and streamed to the PNG encoder, so the memory used is bounded by the size of the
+    // strips rather than by the size of the image. The paint function is called concurrently with a graphics
+    // context whose transform maps the bounds (0, 0, width, height) to the image.
+    bool write(juce::OutputStream& stream, int width, int height, int scaledWidth, int scaledHeight, PaintFn paintFn, std::atomic<bool> const& shouldAbort);
+} // namespace PngStripWriter
+
+ANALYSE_FILE_END
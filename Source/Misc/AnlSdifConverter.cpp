@@ -46,6 +46,7 @@ juce::Result SdifConverter::read(juce::File const& file, FrameCallbackFn frameCa
         FrameCallbackFn frameCallbackFn;
         MatrixCallbackFn matrixCallbackFn;
         DataCallbackFn dataCallbackFn;
+        Matrix matrix;
     };
 
     CallbackFns callbackFns;
@@ -135,45 +136,55 @@ juce::Result SdifConverter::read(juce::File const& file, FrameCallbackFn frameCa
             return 1;
         }
 
-        auto const frameSignature = static_cast<uint32_t>(SdifFCurrFrameSignature(f));
-        auto const frameIndex = static_cast<size_t>(SdifFCurrID(f));
-        auto const time = static_cast<double>(SdifFCurrTime(f));
-        auto const matrixSignature = static_cast<uint32_t>(SdifFCurrMatrixSignature(f));
-        auto const numRows = static_cast<size_t>(SdifFCurrNbRow(f));
-        auto const numColumns = static_cast<size_t>(SdifFCurrNbCol(f));
-        auto const dataType = SdifFCurrDataType(f);
-
         auto* matrixData = SdifFCurrMatrixData(f);
         if(matrixData == nullptr)
         {
             return 1;
         }
-        if(dataType == SdifDataTypeET::eChar)
+
+        auto& matrix = cFns->matrix;
+        matrix.frameSignature = static_cast<uint32_t>(SdifFCurrFrameSignature(f));
+        matrix.frameIndex = static_cast<size_t>(SdifFCurrID(f));
+        matrix.matrixSignature = static_cast<uint32_t>(SdifFCurrMatrixSignature(f));
+        matrix.time = static_cast<double>(SdifFCurrTime(f));
+        matrix.numRows = static_cast<size_t>(SdifFCurrNbRow(f));
+        auto const numColumns = static_cast<size_t>(SdifFCurrNbCol(f));
+        auto const dataType = SdifFCurrDataType(f);
+        matrix.isText = dataType == SdifDataTypeET::eChar;
+        if(matrix.isText)
         {
-            std::vector<std::string> labels;
-            for(auto rowIndex = 0_z; rowIndex < numRows; ++rowIndex)
+            matrix.numColumns = 1_z;
+            matrix.values.clear();
+            matrix.labels.resize(matrix.numRows);
+            for(auto rowIndex = 0_z; rowIndex < matrix.numRows; ++rowIndex)
             {
-                std::string label;
-                for(SdifUInt4 col = 0; col < static_cast<SdifUInt4>(numColumns); col++)
-                {
-                    label += matrixData->Data.Char[col];
-                }
-                labels.push_back(label);
+                matrix.labels[rowIndex].assign(matrixData->Data.Char + rowIndex * numColumns, numColumns);
             }
-            return cFns->dataCallbackFn(frameSignature, frameIndex, matrixSignature, time, numRows, 1, {std::move(labels)}) ? 1 : 0;
+            return cFns->dataCallbackFn(matrix) ? 1 : 0;
+        }
+
+        matrix.numColumns = numColumns;
+        matrix.labels.clear();
+        auto const numValues = matrix.numRows * numColumns;
+        matrix.values.resize(numValues);
+        if(dataType == SdifDataTypeET::eFloat8)
+        {
+            std::copy_n(matrixData->Data.Float8, numValues, matrix.values.data());
+        }
+        else if(dataType == SdifDataTypeET::eFloat4)
+        {
+            std::copy_n(matrixData->Data.Float4, numValues, matrix.values.data());
         }
-        std::vector<std::vector<double>> results;
-        for(SdifUInt4 rowIndex = 1; rowIndex <= static_cast<SdifUInt4>(numRows); ++rowIndex)
+        else
         {
-            std::vector<double> rowValues;
-            rowValues.reserve(numColumns);
-            for(SdifUInt4 columnIndex = 1; columnIndex <= static_cast<SdifUInt4>(numColumns); columnIndex++)
+            for(auto index = 0_z; index < numValues; ++index)
             {
-                rowValues.push_back(SdifMatrixDataGetValue(matrixData, rowIndex, columnIndex));
+                auto const rowIndex = static_cast<SdifUInt4>(index / numColumns + 1_z);
+                auto const columnIndex = static_cast<SdifUInt4>(index % numColumns + 1_z);
+                matrix.values[index] = SdifMatrixDataGetValue(matrixData, rowIndex, columnIndex);
             }
-            results.push_back(std::move(rowValues));
         }
-        return cFns->dataCallbackFn(frameSignature, frameIndex, matrixSignature, time, numRows, numColumns, {std::move(results)}) ? 1 : 0;
+        return cFns->dataCallbackFn(matrix) ? 1 : 0;
     };
 
     if(SdifReadFile(filepath, nullptr, iFrameCallback, iMatrixCallback, iDataCallback, nullptr, &callbackFns) == 0)
@@ -185,55 +196,62 @@ juce::Result SdifConverter::read(juce::File const& file, FrameCallbackFn frameCa
     return juce::Result::ok();
 }
 
-juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> const& timeRange, uint32_t frameId, uint32_t matrixId, std::optional<juce::String> columnName, std::variant<Markers, Points, Columns> const& data, std::function<bool(void)> shouldContinue)
+double const* SdifConverter::Matrix::getRow(size_t row) const noexcept
 {
-    class SdifScopedFile
-    {
-    public:
-        SdifScopedFile(juce::File const& f, bool readOnly)
-        {
-            SdifGenInit(nullptr);
-            SdifSetExitFunc([]()
-                            {
-                            });
-            auto print = [](SdifErrorTagET tag, SdifErrorLevelET level, char* message, SdifFileT*, SdifErrorT* error, char*, int)
-            {
-                std::cout << std::string(magic_enum::enum_name(tag).substr()) << " ";
-                std::cout << "(" << std::string(magic_enum::enum_name(level).substr()) << ")";
-                std::cout << ": " << message << " ";
-                if(error != nullptr && error->UserMess != nullptr)
-                {
-                    std::cout << " - " << error->UserMess;
-                }
-                std::cout << "\n";
-            };
-            SdifSetWarningFunc(print);
-            SdifSetErrorFunc(print);
-            file = SdifFOpen(f.getFullPathName().toRawUTF8(), readOnly ? eReadFile : eWriteFile);
-        }
+    return values.data() + row * numColumns;
+}
 
-        ~SdifScopedFile()
+class SdifConverter::Writer::Impl
+{
+public:
+    Impl(juce::File const& f, uint32_t fId, uint32_t mId)
+    : frameId(fId)
+    , matrixId(mId)
+    {
+        SdifGenInit(nullptr);
+        SdifSetExitFunc([]()
+                        {
+                        });
+        // The messages are written to the error output so they never mix with the responses of the service
+        auto print = [](SdifErrorTagET tag, SdifErrorLevelET level, char* message, SdifFileT*, SdifErrorT* error, char*, int)
         {
-            if(file != nullptr)
+            std::cerr << std::string(magic_enum::enum_name(tag).substr()) << " ";
+            std::cerr << "(" << std::string(magic_enum::enum_name(level).substr()) << ")";
+            std::cerr << ": " << message << " ";
+            if(error != nullptr && error->UserMess != nullptr)
             {
-                SdifFClose(file);
+                std::cerr << " - " << error->UserMess;
             }
-            SdifGenKill();
-        }
-
-        SdifFileT* file = nullptr;
-    };
+            std::cerr << "\n";
+        };
+        SdifSetWarningFunc(print);
+        SdifSetErrorFunc(print);
+        file = SdifFOpen(f.getFullPathName().toRawUTF8(), eWriteFile);
+    }
 
-    SdifScopedFile scopedFile(file, false);
-    if(scopedFile.file == nullptr)
+    ~Impl()
     {
-        return juce::Result::fail("Can't open input file");
+        if(file != nullptr)
+        {
+            SdifFClose(file);
+        }
+        SdifGenKill();
     }
-    auto* sfile = scopedFile.file;
 
-    if(!shouldContinue())
+    SdifFileT* file = nullptr;
+    uint32_t const frameId;
+    uint32_t const matrixId;
+    std::vector<SdifFloat8> buffer;
+};
+
+SdifConverter::Writer::Writer(juce::File const& file, uint32_t frameId, uint32_t matrixId, std::vector<juce::String> const& columnNames)
+: mImpl(std::make_unique<Impl>(file, frameId, matrixId))
+{
+    auto* sfile = mImpl->file;
+    if(sfile == nullptr)
     {
-        return juce::Result::fail("Aborted");
+        mStatus = juce::Result::fail("Can't open input file");
+        return;
     }
 
     if(SdifGetMatrixType(gSdifPredefinedTypes->MatrixTypesTable, matrixId) == nullptr)
@@ -241,34 +259,20 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
         auto* newMatrixType = SdifCreateMatrixType(matrixId, nullptr);
         if(newMatrixType == nullptr)
         {
-            return juce::Result::fail(juce::translate("Can't create new matrix type"));
-        }
-        if(columnName.has_value())
-        {
-            SdifMatrixTypeInsertTailColumnDef(newMatrixType, columnName->getCharPointer());
+            mStatus = juce::Result::fail(juce::translate("Can't create new matrix type"));
+            return;
         }
-        if(data.index() == 0_z)
-        {
-            SdifMatrixTypeInsertTailColumnDef(newMatrixType, "label");
-        }
-        else if(data.index() == 1_z)
-        {
-            SdifMatrixTypeInsertTailColumnDef(newMatrixType, "value");
-        }
-        else if(data.index() == 2_z)
-        {
-            SdifMatrixTypeInsertTailColumnDef(newMatrixType, "values");
-        }
-        else
+        for(auto const& columnName : columnNames)
         {
-            return juce::Result::fail("Unsupported format");
+            SdifMatrixTypeInsertTailColumnDef(newMatrixType, columnName.getCharPointer());
         }
         SdifPutMatrixType(sfile->MatrixTypesTable, newMatrixType);
     }
 
     if(SdifTestMatrixType(sfile, matrixId) == nullptr)
     {
-        return juce::Result::fail("Matrix type undefined");
+        mStatus = juce::Result::fail("Matrix type undefined");
+        return;
     }
 
     if(SdifGetFrameType(gSdifPredefinedTypes->FrameTypesTable, frameId) == nullptr)
@@ -276,7 +280,8 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
         auto* newFrameType = SdifCreateFrameType(frameId, nullptr);
         if(newFrameType == nullptr)
         {
-            return juce::Result::fail(juce::translate("Can't create new frame type"));
+            mStatus = juce::Result::fail(juce::translate("Can't create new frame type"));
+            return;
         }
         SdifPutFrameType(sfile->FrameTypesTable, newFrameType);
         char name[] = "MAT0";
@@ -285,11 +290,100 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
 
     if(SdifTestFrameType(sfile, frameId) == nullptr)
     {
-        return juce::Result::fail("Frame type undefined");
+        mStatus = juce::Result::fail("Frame type undefined");
+        return;
     }
 
     SdifFWriteGeneralHeader(sfile);
     SdifFWriteAllASCIIChunks(sfile);
+}
+
+SdifConverter::Writer::~Writer() = default;
+
+juce::Result SdifConverter::Writer::getStatus() const
+{
+    return mStatus;
+}
+
+void SdifConverter::Writer::writeEmptyFrame(size_t channel, double time)
+{
+    if(mStatus.failed())
+    {
+        return;
+    }
+    auto* sfile = mImpl->file;
+    SdifFSetCurrFrameHeader(sfile, mImpl->frameId, static_cast<SdifUInt4>(SdifSizeOfFrameHeader()), 0, static_cast<SdifUInt4>(channel), static_cast<SdifFloat8>(time));
+    SdifFWriteFrameHeader(sfile);
+}
+
+void SdifConverter::Writer::writeLabel(size_t channel, double time, std::string_view label)
+{
+    if(mStatus.failed())
+    {
+        return;
+    }
+    // The data are only read by the library
+    auto* data = const_cast<char*>(label.data());
+    SdifFWriteFrameAndOneMatrix(mImpl->file, mImpl->frameId, static_cast<SdifUInt4>(channel), static_cast<SdifFloat8>(time), mImpl->matrixId, SdifDataTypeET::eChar, static_cast<SdifUInt4>(1), static_cast<SdifUInt4>(label.size()), reinterpret_cast<void*>(data));
+}
+
+void SdifConverter::Writer::writeValues(size_t channel, double time, double const* values, size_t numValues)
+{
+    if(mStatus.failed())
+    {
+        return;
+    }
+    // The data are only read by the library
+    auto* data = const_cast<double*>(values);
+    SdifFWriteFrameAndOneMatrix(mImpl->file, mImpl->frameId, static_cast<SdifUInt4>(channel), static_cast<SdifFloat8>(time), mImpl->matrixId, SdifDataTypeET::eFloat8, static_cast<SdifUInt4>(numValues), static_cast<SdifUInt4>(1), reinterpret_cast<void*>(data));
+}
+
+void SdifConverter::Writer::writeValues(size_t channel, double time, float const* values, size_t numValues)
+{
+    if(mStatus.failed())
+    {
+        return;
+    }
+    auto& buffer = mImpl->buffer;
+    buffer.resize(numValues);
+    std::copy_n(values, numValues, buffer.data());
+    writeValues(channel, time, buffer.data(), buffer.size());
+}
+
+juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> const& timeRange, uint32_t frameId, uint32_t matrixId, std::optional<juce::String> columnName, std::variant<Markers, Points, Columns> const& data, std::function<bool(void)> shouldContinue)
+{
+    std::vector<juce::String> columnNames;
+    if(columnName.has_value())
+    {
+        columnNames.push_back(*columnName);
+    }
+    if(data.index() == 0_z)
+    {
+        columnNames.push_back("label");
+    }
+    else if(data.index() == 1_z)
+    {
+        columnNames.push_back("value");
+    }
+    else if(data.index() == 2_z)
+    {
+        columnNames.push_back("values");
+    }
+    else
+    {
+        return juce::Result::fail("Unsupported format");
+    }
+
+    if(!shouldContinue())
+    {
+        return juce::Result::fail("Aborted");
+    }
+
+    Writer writer(file, frameId, matrixId, columnNames);
+    if(writer.getStatus().failed())
+    {
+        return writer.getStatus();
+    }
 
     if(!shouldContinue())
     {
@@ -307,11 +401,7 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
                 auto const time = std::get<0>(frameData);
                 if(timeRange.isEmpty() || timeRange.contains(time))
                 {
-                    auto const label = std::get<2>(frameData);
-                    std::vector<SdifChar> text;
-                    text.resize(label.length());
-                    std::copy_n(label.c_str(), text.size(), text.data());
-                    SdifFWriteFrameAndOneMatrix(sfile, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eChar, static_cast<SdifUInt4>(1), static_cast<SdifUInt4>(text.size()), reinterpret_cast<void*>(text.data()));
+                    writer.writeLabel(channelIndex, time, std::get<2>(frameData));
                 }
                 if(!shouldContinue())
                 {
@@ -333,13 +423,12 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
                 {
                     if(std::get<2>(frameData).has_value())
                     {
-                        auto value = static_cast<SdifFloat8>(*std::get<2>(frameData));
-                        SdifFWriteFrameAndOneMatrix(sfile, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eFloat8, static_cast<SdifUInt4>(1), static_cast<SdifUInt4>(1), reinterpret_cast<void*>(&value));
+                        auto const value = static_cast<double>(*std::get<2>(frameData));
+                        writer.writeValues(channelIndex, time, &value, 1_z);
                     }
                     else
                     {
-                        SdifFSetCurrFrameHeader(sfile, frameId, static_cast<SdifUInt4>(SdifSizeOfFrameHeader()), 0, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time));
-                        SdifFWriteFrameHeader(sfile);
+                        writer.writeEmptyFrame(channelIndex, time);
                     }
                 }
                 if(!shouldContinue())
@@ -360,13 +449,8 @@ juce::Result SdifConverter::write(juce::File const& file, juce::Range<double> co
                 auto const time = std::get<0>(frameData);
                 if(timeRange.isEmpty() || timeRange.contains(time))
                 {
-                    std::vector<SdifFloat8> values;
-                    values.resize(std::get<2>(frameData).size());
-                    for(size_t binIndex = 0_z; binIndex < std::get<2>(frameData).size(); ++binIndex)
-                    {
-                        values[binIndex] = std::get<2>(frameData).at(binIndex);
-                    }
-                    SdifFWriteFrameAndOneMatrix(sfile, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eFloat8, static_cast<SdifUInt4>(values.size()), static_cast<SdifUInt4>(1), reinterpret_cast<void*>(values.data()));
+                    auto const& values = std::get<2>(frameData);
+                    writer.writeValues(channelIndex, time, values.data(), values.size());
                 }
             }
 
@@ -415,65 +499,63 @@ juce::Result SdifConverter::toJson(juce::File const& inputFile, juce::File const
             juce::ignoreUnused(frameSignature, frameIndex, numRows, numColumns, names);
             return result.wasOk() && matrixSignature == matrixId;
         },
-        [&](uint32_t frameSignature, size_t frameIndex, uint32_t matrixSignature, double time, size_t numRows, size_t numColumns, std::variant<std::vector<std::string>, std::vector<std::vector<double>>> data)
+        [&](Matrix const& matrix)
         {
-            juce::ignoreUnused(frameSignature, matrixSignature);
             if(result.failed())
             {
                 return false;
             }
-            if(data.index() == 0_z && column.has_value() && *column != 0_z)
+            if(matrix.isText && column.has_value() && *column != 0_z)
             {
                 result = juce::Result::fail("Column index cannot be specified with text data type");
                 return false;
             }
-            if(numRows != 1_z && !row.has_value() && numColumns != 1_z && !column.has_value())
+            if(matrix.numRows != 1_z && !row.has_value() && matrix.numColumns != 1_z && !column.has_value())
             {
                 result = juce::Result::fail("Can't convert all rows and all columns (either one row or one column must be selected)");
                 return false;
             }
 
-            auto const* labels = std::get_if<0_z>(&data);
-            auto const* values = std::get_if<1_z>(&data);
-
             nlohmann::json vjson;
-            vjson["time"] = time;
+            vjson["time"] = matrix.time;
 
-            if(row.has_value() || numRows == 1_z)
+            if(row.has_value() || matrix.numRows == 1_z)
             {
                 auto const rowIndex = row.has_value() ? *row : 0_z;
-                if(labels != nullptr && labels->size() > rowIndex)
+                if(matrix.isText && matrix.labels.size() > rowIndex)
                 {
-                    vjson["label"] = labels->at(rowIndex);
+                    vjson["label"] = matrix.labels.at(rowIndex);
                 }
-                else if(values != nullptr && values->size() > rowIndex)
+                else if(!matrix.isText && matrix.numRows > rowIndex)
                 {
-                    if(column.has_value() || numColumns == 1)
+                    auto const* rowValues = matrix.getRow(rowIndex);
+                    if(column.has_value() || matrix.numColumns == 1)
                     {
                         auto const columnIndex = column.has_value() ? *column : 0_z;
-                        if(values->at(rowIndex).size() > columnIndex)
+                        if(matrix.numColumns > columnIndex)
                         {
-                            vjson["value"] = values->at(rowIndex).at(columnIndex);
+                            vjson["value"] = rowValues[columnIndex];
                         }
                     }
                     else
                     {
-                        vjson["values"] = values->at(rowIndex);
+                        vjson["values"] = std::vector<double>(rowValues, rowValues + matrix.numColumns);
                     }
                 }
             }
-            else if(values != nullptr)
+            else if(!matrix.isText)
             {
                 auto const columnIndex = column.has_value() ? *column : 0_z;
-                for(auto rowIndex = 0_z; rowIndex < values->size(); ++rowIndex)
+                if(columnIndex < matrix.numColumns && matrix.numRows > 0_z)
                 {
-                    if(columnIndex < values->at(rowIndex).size())
+                    auto& values = vjson["values"];
+                    for(auto rowIndex = 0_z; rowIndex < matrix.numRows; ++rowIndex)
                     {
-                        vjson["values"].push_back(values->at(rowIndex).at(columnIndex));
+                        values.push_back(matrix.getRow(rowIndex)[columnIndex]);
                     }
                 }
             }
-            json[frameIndex].push_back(std::move(vjson));
+            json[matrix.frameIndex].push_back(std::move(vjson));
             return true;
         });
 
@@ -537,104 +619,34 @@ juce::Result SdifConverter::fromJson(juce::File const& inputFile, juce::File con
     auto const& json = container.count("results") ? container.at("results") : container;
 
     {
-        class SdifScopedFile
-        {
-        public:
-            SdifScopedFile(juce::File const& f, bool readOnly)
-            {
-                SdifGenInit(nullptr);
-                SdifSetExitFunc([]()
-                                {
-                                });
-                auto print = [](SdifErrorTagET tag, SdifErrorLevelET level, char* message, SdifFileT*, SdifErrorT* error, char*, int)
-                {
-                    std::cout << std::string(magic_enum::enum_name(tag).substr()) << " ";
-                    std::cout << "(" << std::string(magic_enum::enum_name(level).substr()) << ")";
-                    std::cout << ": " << message << " ";
-                    if(error != nullptr && error->UserMess != nullptr)
-                    {
-                        std::cout << " - " << error->UserMess;
-                    }
-                    std::cout << "\n";
-                };
-                SdifSetWarningFunc(print);
-                SdifSetErrorFunc(print);
-                file = SdifFOpen(f.getFullPathName().toRawUTF8(), readOnly ? eReadFile : eWriteFile);
-            }
-
-            ~SdifScopedFile()
-            {
-                if(file != nullptr)
-                {
-                    SdifFClose(file);
-                }
-                SdifGenKill();
-            }
-
-            SdifFileT* file = nullptr;
-        };
-
-        SdifScopedFile scopedFile(temp.getFile(), false);
-        if(scopedFile.file == nullptr)
+        std::vector<juce::String> columnNames;
+        if(columnName.has_value())
         {
-            return juce::Result::fail("Can't open input file");
+            columnNames.push_back(*columnName);
         }
-        auto* file = scopedFile.file;
-
-        if(SdifGetMatrixType(gSdifPredefinedTypes->MatrixTypesTable, matrixId) == nullptr)
+        else if(!json.empty() && !json[0_z].empty())
         {
-            auto* newMatrixType = SdifCreateMatrixType(matrixId, nullptr);
-            if(newMatrixType == nullptr)
+            if(json[0_z][0_z].count("label"))
             {
-                return juce::Result::fail(juce::translate("Can't create new matrix type"));
+                columnNames.push_back("label");
             }
-            if(columnName.has_value())
+            else if(json[0_z][0_z].count("value"))
             {
-                SdifMatrixTypeInsertTailColumnDef(newMatrixType, columnName->getCharPointer());
+                columnNames.push_back("value");
             }
-            else if(!json.empty() && !json[0_z].empty())
+            else
             {
-                if(json[0_z][0_z].count("label"))
-                {
-                    SdifMatrixTypeInsertTailColumnDef(newMatrixType, "label");
-                }
-                else if(json[0_z][0_z].count("value"))
-                {
-                    SdifMatrixTypeInsertTailColumnDef(newMatrixType, "value");
-                }
-                else
-                {
-                    SdifMatrixTypeInsertTailColumnDef(newMatrixType, "values");
-                }
+                columnNames.push_back("values");
             }
-            SdifPutMatrixType(file->MatrixTypesTable, newMatrixType);
         }
 
-        if(SdifTestMatrixType(file, matrixId) == nullptr)
+        Writer writer(temp.getFile(), frameId, matrixId, columnNames);
+        if(writer.getStatus().failed())
         {
-            return juce::Result::fail("Matrix type undefined");
+            return writer.getStatus();
         }
 
-        if(SdifGetFrameType(gSdifPredefinedTypes->FrameTypesTable, frameId) == nullptr)
-        {
-            auto* newFrameType = SdifCreateFrameType(frameId, nullptr);
-            if(newFrameType == nullptr)
-            {
-                return juce::Result::fail(juce::translate("Can't create new frame type"));
-            }
-            SdifPutFrameType(file->FrameTypesTable, newFrameType);
-            char name[] = "MAT0";
-            newFrameType = SdifFrameTypePutComponent(newFrameType, matrixId, name);
-        }
-
-        if(SdifTestFrameType(file, frameId) == nullptr)
-        {
-            return juce::Result::fail("Frame type undefined");
-        }
-
-        SdifFWriteGeneralHeader(file);
-        SdifFWriteAllASCIIChunks(file);
-
+        std::vector<double> values;
         for(size_t channelIndex = 0_z; channelIndex < json.size(); ++channelIndex)
         {
             auto const& channelData = json[channelIndex];
@@ -648,32 +660,27 @@ juce::Result SdifConverter::fromJson(juce::File const& inputFile, juce::File con
                 auto const labelIt = frameData.find("label");
                 if(labelIt != frameData.cend())
                 {
-                    std::string label = labelIt.value();
-                    std::vector<SdifChar> data;
-                    data.resize(label.length());
-                    std::copy_n(label.c_str(), data.size(), data.data());
-                    SdifFWriteFrameAndOneMatrix(file, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eChar, static_cast<SdifUInt4>(1), static_cast<SdifUInt4>(data.size()), reinterpret_cast<void*>(data.data()));
+                    writer.writeLabel(channelIndex, time, labelIt->get_ref<std::string const&>());
                 }
                 else
                 {
                     auto const valueIt = frameData.find("value");
                     if(valueIt != frameData.cend())
                     {
-                        SdifFloat8 value = valueIt.value();
-                        SdifFWriteFrameAndOneMatrix(file, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eFloat8, static_cast<SdifUInt4>(1), static_cast<SdifUInt4>(1), reinterpret_cast<void*>(&value));
+                        double const value = valueIt.value();
+                        writer.writeValues(channelIndex, time, &value, 1_z);
                     }
                     else
                     {
                         auto const valuesIt = frameData.find("values");
                         if(valuesIt != frameData.cend())
                         {
-                            std::vector<SdifFloat8> values;
                             values.resize(valuesIt->size());
                             for(size_t binIndex = 0_z; binIndex < valuesIt->size(); ++binIndex)
                             {
                                 values[binIndex] = valuesIt->at(binIndex);
                             }
-                            SdifFWriteFrameAndOneMatrix(file, frameId, static_cast<SdifUInt4>(channelIndex), static_cast<SdifFloat8>(time), matrixId, SdifDataTypeET::eFloat8, static_cast<SdifUInt4>(values.size()), static_cast<SdifUInt4>(1), reinterpret_cast<void*>(values.data()));
+                            writer.writeValues(channelIndex, time, values.data(), values.size());
                         }
                     }
                 }
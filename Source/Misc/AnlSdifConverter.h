@@ -21,13 +21,54 @@ namespace SdifConverter
     uint32_t getSignature(juce::String const& name);
     juce::String getString(uint32_t signature);
 
+    // The data of a matrix, the numeric values are stored contiguously row by row (numRows * numColumns)
+    // and the text data are stored with one label per row (numColumns is 1). The buffers are reused from
+    // one matrix to the next so the data are only valid during the data callback.
+    struct Matrix
+    {
+        uint32_t frameSignature{0u};
+        size_t frameIndex{0_z};
+        uint32_t matrixSignature{0u};
+        double time{0.0};
+        size_t numRows{0_z};
+        size_t numColumns{0_z};
+        bool isText{false};
+        std::vector<double> values;
+        std::vector<std::string> labels;
+
+        double const* getRow(size_t row) const noexcept;
+    };
+
     // Return true to read the content, otherwise the content is ignored
     using FrameCallbackFn = std::function<bool(uint32_t frameSignature, size_t frameIndex, double time, size_t numMarix)>;
     using MatrixCallbackFn = std::function<bool(uint32_t frameSignature, size_t frameIndex, uint32_t matrixSignature, size_t numRows, size_t numColumns, std::vector<std::string> columnNames)>;
-    using DataCallbackFn = std::function<bool(uint32_t frameSignature, size_t frameIndex, uint32_t matrixSignature, double time, size_t numRows, size_t numColumns, std::variant<std::vector<std::string>, std::vector<std::vector<double>>> data)>;
+    using DataCallbackFn = std::function<bool(Matrix const& matrix)>;
 
     juce::Result read(juce::File const& file, FrameCallbackFn frameCallbackFn, MatrixCallbackFn matrixCallbackFn, DataCallbackFn dataCallbackFn);
 
+    // Writes frames of one matrix in a new file, the values and the labels are written directly from the
+    // storage of the caller, only the 32-bit float values are converted using a buffer that is reused.
+    class Writer
+    {
+    public:
+        Writer(juce::File const& file, uint32_t frameId, uint32_t matrixId, std::vector<juce::String> const& columnNames);
+        ~Writer();
+
+        juce::Result getStatus() const;
+
+        void writeEmptyFrame(size_t channel, double time);
+        void writeLabel(size_t channel, double time, std::string_view label);
+        void writeValues(size_t channel, double time, double const* values, size_t numValues);
+        void writeValues(size_t channel, double time, float const* values, size_t numValues);
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> mImpl;
+        juce::Result mStatus{juce::Result::ok()};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Writer)
+    };
+
     using Markers = std::vector<std::vector<std::tuple<double, double, std::string, std::vector<float>>>>;
     using Points = std::vector<std::vector<std::tuple<double, double, std::optional<float>, std::vector<float>>>>;
     using Columns = std::vector<std::vector<std::tuple<double, double, std::vector<float>, std::vector<float>>>>;
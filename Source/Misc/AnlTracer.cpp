@@ -0,0 +1,248 @@
+#include "AnlTracer.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Tracer
+{
+    struct Event
+    {
+        char const* name{nullptr};
+        char const* category{nullptr};
+        juce::int64 startTime{0};
+        juce::int64 endTime{0};
+        uint32_t threadId{0u};
+    };
+
+    // The fields of a slot are atomic so the slot can be read while the owning thread overwrites it. The
+    // sequence identifies the event written in the slot and is reset while the event is written so the
+    // readers drop the events that have been overwritten during their reading.
+    struct Slot
+    {
+        std::atomic<size_t> sequence{0_z}; // The index of the event plus one, 0 while the event is written
+        std::atomic<char const*> name{nullptr};
+        std::atomic<char const*> category{nullptr};
+        std::atomic<juce::int64> startTime{0};
+        std::atomic<juce::int64> endTime{0};
+        std::atomic<uint32_t> threadId{0u};
+    };
+
+    // A single-producer ring buffer, the events are written by the owning thread and the head is published
+    // once an event is written so the events can be read from another thread.
+    struct Buffer
+    {
+        static auto constexpr capacity = 16384_z;
+        std::array<Slot, capacity> slots;
+        std::atomic<size_t> head{0_z};
+        std::atomic<bool> isUsed{false};
+
+        void write(Event const& event)
+        {
+            auto const index = head.load(std::memory_order_relaxed);
+            auto& slot = slots[index % capacity];
+            slot.sequence.store(0_z, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.name.store(event.name, std::memory_order_relaxed);
+            slot.category.store(event.category, std::memory_order_relaxed);
+            slot.startTime.store(event.startTime, std::memory_order_relaxed);
+            slot.endTime.store(event.endTime, std::memory_order_relaxed);
+            slot.threadId.store(event.threadId, std::memory_order_relaxed);
+            slot.sequence.store(index + 1_z, std::memory_order_release);
+            head.store(index + 1_z, std::memory_order_release);
+        }
+
+        // Returns nothing if the event is not or no longer in the slot
+        std::optional<Event> read(size_t index) const
+        {
+            auto const& slot = slots[index % capacity];
+            if(slot.sequence.load(std::memory_order_acquire) != index + 1_z)
+            {
+                return {};
+            }
+            Event const event{slot.name.load(std::memory_order_relaxed), slot.category.load(std::memory_order_relaxed), slot.startTime.load(std::memory_order_relaxed), slot.endTime.load(std::memory_order_relaxed), slot.threadId.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.sequence.load(std::memory_order_relaxed) != index + 1_z)
+            {
+                return {};
+            }
+            return event;
+        }
+    };
+
+    // The buffers of the ended threads are reused by the new threads, so the memory is bounded by the number of
+    // threads running concurrently rather than by the number of threads created.
+    class Registry
+    {
+    public:
+        static Registry& get()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        std::tuple<Buffer*, uint32_t> acquire()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto const threadId = mNextThreadId++;
+            mThreadNames[threadId] = juce::MessageManager::existsAndIsCurrentThread() ? juce::String("Message Thread") : juce::String("Thread ") + juce::String(threadId);
+            for(auto& buffer : mBuffers)
+            {
+                auto expected = false;
+                if(buffer->isUsed.compare_exchange_strong(expected, true))
+                {
+                    return {buffer.get(), threadId};
+                }
+            }
+            mBuffers.push_back(std::make_unique<Buffer>());
+            mBuffers.back()->isUsed.store(true);
+            return {mBuffers.back().get(), threadId};
+        }
+
+        void release(Buffer* buffer)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            buffer->isUsed.store(false);
+        }
+
+        void clear()
+        {
+            // The events that started before the origin are ignored so the buffers are never modified by another thread
+            mOrigin.store(juce::Time::getHighResolutionTicks());
+        }
+
+        nlohmann::json toJson() const
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto const origin = mOrigin.load();
+            auto const toMicroseconds = [](juce::int64 ticks)
+            {
+                return juce::Time::highResolutionTicksToSeconds(ticks) * 1000000.0;
+            };
+
+            auto events = nlohmann::json::array();
+            std::set<uint32_t> threadIds;
+            for(auto const& buffer : mBuffers)
+            {
+                auto const head = buffer->head.load(std::memory_order_acquire);
+                for(auto index = head - std::min(head, Buffer::capacity); index < head; ++index)
+                {
+                    auto const event = buffer->read(index);
+                    if(!event.has_value() || event->name == nullptr || event->startTime < origin)
+                    {
+                        continue;
+                    }
+                    threadIds.insert(event->threadId);
+                    auto json = nlohmann::json::object();
+                    json["name"] = event->name;
+                    json["cat"] = event->category;
+                    json["ph"] = "X";
+                    json["ts"] = toMicroseconds(event->startTime - origin);
+                    json["dur"] = toMicroseconds(event->endTime - event->startTime);
+                    json["pid"] = 1;
+                    json["tid"] = event->threadId;
+                    events.push_back(std::move(json));
+                }
+            }
+            for(auto const& threadId : threadIds)
+            {
+                auto const it = mThreadNames.find(threadId);
+                auto json = nlohmann::json::object();
+                json["name"] = "thread_name";
+                json["ph"] = "M";
+                json["pid"] = 1;
+                json["tid"] = threadId;
+                json["args"] = {{"name", it != mThreadNames.cend() ? it->second.toStdString() : std::string{}}};
+                events.push_back(std::move(json));
+            }
+            auto json = nlohmann::json::object();
+            json["traceEvents"] = std::move(events);
+            json["displayTimeUnit"] = "ms";
+            return json;
+        }
+
+        std::atomic<bool> enabled{false};
+
+    private:
+        Registry() = default;
+
+        mutable std::mutex mMutex;
+        std::vector<std::unique_ptr<Buffer>> mBuffers;
+        std::map<uint32_t, juce::String> mThreadNames;
+        uint32_t mNextThreadId{1u};
+        std::atomic<juce::int64> mOrigin{0};
+    };
+
+    // The buffer is acquired by a thread when it records its first event and released when the thread ends
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer()
+        {
+            std::tie(mBuffer, mThreadId) = Registry::get().acquire();
+        }
+
+        ~ThreadBuffer()
+        {
+            Registry::get().release(mBuffer);
+        }
+
+        void push(char const* name, char const* category, juce::int64 startTime, juce::int64 endTime)
+        {
+            mBuffer->write({name, category, startTime, endTime, mThreadId});
+        }
+
+    private:
+        Buffer* mBuffer{nullptr};
+        uint32_t mThreadId{0u};
+    };
+} // namespace Tracer
+
+void Tracer::setEnabled(bool state)
+{
+    if(state)
+    {
+        Registry::get().clear();
+    }
+    Registry::get().enabled.store(state);
+}
+
+bool Tracer::isEnabled()
+{
+    return Registry::get().enabled.load(std::memory_order_relaxed);
+}
+
+Tracer::ScopedEvent::ScopedEvent(char const* name, char const* category)
+: mName(name)
+, mCategory(category)
+, mStartTime(isEnabled() ? juce::Time::getHighResolutionTicks() : 0)
+{
+}
+
+Tracer::ScopedEvent::~ScopedEvent()
+{
+    if(mStartTime != 0 && isEnabled())
+    {
+        thread_local ThreadBuffer buffer;
+        buffer.push(mName, mCategory, mStartTime, juce::Time::getHighResolutionTicks());
+    }
+}
+
+nlohmann::json Tracer::toJson()
+{
+    return Registry::get().toJson();
+}
+
+juce::Result Tracer::writeTo(juce::File const& file)
+{
+    auto const result = file.getParentDirectory().createDirectory();
+    if(result.failed())
+    {
+        return result;
+    }
+    if(!file.replaceWithText(toJson().dump()))
+    {
+        return juce::Result::fail(juce::translate("The trace file FLNM cannot be written!").replace("FLNM", file.getFullPathName()));
+    }
+    return juce::Result::ok();
+}
+
+ANALYSE_FILE_END
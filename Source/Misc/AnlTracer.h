@@ -0,0 +1,45 @@
+#pragma once
+
+#include "AnlBase.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Tracer
+{
+    // Records the scoped events of the threads in the Chrome trace event format that can be opened in Perfetto
+    // (https://ui.perfetto.dev) or chrome://tracing to see how the analyses, the loadings, the renderings, the
+    // exports and the notifications overlap. Each thread writes its events to its own ring buffer without lock,
+    // so the overhead is a clock reading at the beginning and at the end of the events while the tracer is
+    // enabled and an atomic reading otherwise. The oldest events of a thread are overwritten once its buffer
+    // is full. The names and the categories of the events must be string literals.
+
+    //! @brief Enables or disables the recording of the events, the events are cleared when the recording is enabled.
+    void setEnabled(bool state);
+
+    //! @brief Checks if the events are recorded.
+    bool isEnabled();
+
+    //! @brief Records an event during its lifetime.
+    class ScopedEvent
+    {
+    public:
+        ScopedEvent(char const* name, char const* category);
+        ~ScopedEvent();
+
+    private:
+        char const* const mName;
+        char const* const mCategory;
+        juce::int64 const mStartTime;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedEvent)
+    };
+
+    //! @brief Gets the recorded events in the Chrome trace event format.
+    //! @details The events that are being written while the function is called might be missing.
+    nlohmann::json toJson();
+
+    //! @brief Writes the recorded events to a file in the Chrome trace event format.
+    juce::Result writeTo(juce::File const& file);
+} // namespace Tracer
+
+ANALYSE_FILE_END
@@ -57,7 +57,7 @@ float const** Plugin::Processor::CircularReader::getNextBlock()
     if(mStepSize >= mBlocksize)
     {
         juce::AudioBuffer<float> input(inputPointers, numChannels, 0, mBlocksize);
-        mAudioFormatReader.read(input.getArrayOfWritePointers(), numChannels, mReaderPosition, mBlocksize);
+        read(input.getArrayOfWritePointers(), numChannels, mReaderPosition, mBlocksize);
 
         mReaderPosition += static_cast<juce::int64>(mStepSize);
 
@@ -98,7 +98,7 @@ float const** Plugin::Processor::CircularReader::getNextBlock()
     }
     else
     {
-        mAudioFormatReader.read(input.getArrayOfWritePointers(), numChannels, mReaderPosition, bufferSize - silence);
+        read(input.getArrayOfWritePointers(), numChannels, mReaderPosition, bufferSize - silence);
         input.clear(bufferSize - silence, silence);
     }
 
@@ -113,16 +113,50 @@ float const** Plugin::Processor::CircularReader::getNextBlock()
     return mOutputBuffer.data();
 }
 
+double Plugin::Processor::CircularReader::getReadingDuration() const
+{
+    return juce::Time::highResolutionTicksToSeconds(mReadingTicks);
+}
+
+void Plugin::Processor::CircularReader::read(float* const* destChannels, int numChannels, juce::int64 startSample, int numSamples)
+{
+    auto const startTime = juce::Time::getHighResolutionTicks();
+    mAudioFormatReader.read(destChannels, numChannels, startSample, numSamples);
+    mReadingTicks += juce::Time::getHighResolutionTicks() - startTime;
+}
+
 Plugin::Processor::Processor(juce::AudioFormatReader& audioFormatReader, std::vector<std::unique_ptr<Ive::PluginWrapper>> plugins, Key const& key, size_t const feature, State const& state)
 : mPlugins(std::move(plugins))
 , mCircularReader(audioFormatReader, state.blockSize, state.stepSize)
-, mKey(key)
-, mFeature(feature)
+, mKeys({key})
+, mFeatures({feature})
 , mState(state)
 {
 }
 
-juce::Result Plugin::Processor::prepareToAnalyze(std::vector<std::vector<Result>>& results)
+size_t Plugin::Processor::addFeature(std::string const& feature)
+{
+    MiscWeakAssert(!mKeys.empty());
+    auto const it = std::find_if(mKeys.cbegin(), mKeys.cend(), [&](auto const& key)
+                                 {
+                                     return key.feature == feature;
+                                 });
+    if(it != mKeys.cend())
+    {
+        return static_cast<size_t>(std::distance(mKeys.cbegin(), it));
+    }
+    MiscStrongAssert(!mPlugins.empty() && mPlugins.at(0_z) != nullptr);
+    auto const index = Tools::getFeatureIndex(*mPlugins.at(0_z).get(), feature);
+    if(!index.has_value())
+    {
+        throw LoadingError("plugin feature is invalid");
+    }
+    mKeys.push_back({mKeys.at(0_z).identifier, feature});
+    mFeatures.push_back(index.value());
+    return mFeatures.size() - 1_z;
+}
+
+juce::Result Plugin::Processor::prepareToAnalyze(std::vector<std::vector<std::vector<Result>>>& results)
 {
     MiscStrongAssert(!mPlugins.empty());
     if(mPlugins.empty())
@@ -175,31 +209,40 @@ juce::Result Plugin::Processor::prepareToAnalyze(std::vector<std::vector<Result>
     }
 
     auto const descriptors = mPlugins.at(0)->getOutputDescriptors();
-    MiscStrongAssert(mFeature < descriptors.size());
-    if(mFeature >= descriptors.size())
+    auto const hasInvalidFeature = std::any_of(mFeatures.cbegin(), mFeatures.cend(), [&](auto const feature)
+                                               {
+                                                   return feature >= descriptors.size();
+                                               });
+    MiscStrongAssert(!hasInvalidFeature);
+    if(hasInvalidFeature)
     {
         return juce::Result::fail(juce::translate("The processor has an invalid feature index"));
     }
 
-    results.resize(mPlugins.size());
-    auto const& descriptor = descriptors[mFeature];
-    if(descriptor.sampleType == Output::SampleType::OneSamplePerStep)
+    results.resize(mFeatures.size());
+    for(auto featureIndex = 0_z; featureIndex < mFeatures.size(); ++featureIndex)
     {
-        auto const length = static_cast<double>(mCircularReader.getLengthInSamples());
-        auto const size = static_cast<size_t>(std::ceil(length / static_cast<double>(mState.stepSize)));
-        for(auto& channelResults : results)
+        auto& featureResults = results[featureIndex];
+        featureResults.resize(mPlugins.size());
+        auto const& descriptor = descriptors[mFeatures[featureIndex]];
+        if(descriptor.sampleType == Output::SampleType::OneSamplePerStep)
         {
-            channelResults.reserve(size);
+            auto const length = static_cast<double>(mCircularReader.getLengthInSamples());
+            auto const size = static_cast<size_t>(std::ceil(length / static_cast<double>(mState.stepSize)));
+            for(auto& channelResults : featureResults)
+            {
+                channelResults.reserve(size);
+            }
         }
-    }
-    else if(descriptor.sampleType == Output::SampleType::FixedSampleRate)
-    {
-        auto const length = static_cast<double>(mCircularReader.getLengthInSamples());
-        auto const duration = length / mCircularReader.getSampleRate();
-        auto const size = static_cast<size_t>(std::ceil(duration * descriptor.sampleRate));
-        for(auto& channelResults : results)
+        else if(descriptor.sampleType == Output::SampleType::FixedSampleRate)
         {
-            channelResults.reserve(size);
+            auto const length = static_cast<double>(mCircularReader.getLengthInSamples());
+            auto const duration = length / mCircularReader.getSampleRate();
+            auto const size = static_cast<size_t>(std::ceil(duration * descriptor.sampleRate));
+            for(auto& channelResults : featureResults)
+            {
+                channelResults.reserve(size);
+            }
         }
     }
     return juce::Result::ok();
@@ -256,7 +299,7 @@ juce::Result Plugin::Processor::setPrecomputingResults(std::vector<std::vector<s
     return (results.empty() || results.size() == 1_z || results.size() == mPlugins.size()) ? juce::Result::ok() : juce::Result::fail(juce::translate("The precomputed results size is invalid"));
 }
 
-std::tuple<juce::Result, bool> Plugin::Processor::performNextAudioBlock(std::vector<std::vector<Result>>& results)
+std::tuple<juce::Result, bool> Plugin::Processor::performNextAudioBlock(std::vector<std::vector<std::vector<Result>>>& results)
 {
     MiscStrongAssert(!mPlugins.empty());
     if(mPlugins.empty())
@@ -271,7 +314,34 @@ std::tuple<juce::Result, bool> Plugin::Processor::performNextAudioBlock(std::vec
         return std::make_tuple(juce::Result::fail(juce::translate("The processor has a null plugin")), false);
     }
 
-    auto const feature = mFeature;
+    MiscWeakAssert(results.size() == mFeatures.size());
+    if(results.size() != mFeatures.size())
+    {
+        return std::make_tuple(juce::Result::fail(juce::translate("The processor has an invalid feature index")), false);
+    }
+
+    // The features that are not used are discarded and the other features are moved to their results
+    auto const dispatch = [&](size_t index, Vamp::Plugin::FeatureSet& featureSet, Vamp::RealTime const& timestamp)
+    {
+        for(auto featureIndex = 0_z; featureIndex < mFeatures.size(); ++featureIndex)
+        {
+            auto it = featureSet.find(static_cast<int>(mFeatures[featureIndex]));
+            if(it != featureSet.end())
+            {
+                auto& channelResults = results[featureIndex][index];
+                for(auto& that : it->second)
+                {
+                    if(!that.hasTimestamp)
+                    {
+                        that.hasTimestamp = true;
+                        that.timestamp = timestamp;
+                    }
+                    channelResults.emplace_back(std::move(that));
+                }
+            }
+        }
+    };
+
     auto const blockSize = mState.blockSize;
     auto const stepSize = mState.stepSize;
     MiscStrongAssert(blockSize > 0 && stepSize > 0);
@@ -289,19 +359,7 @@ std::tuple<juce::Result, bool> Plugin::Processor::performNextAudioBlock(std::vec
         for(size_t index = 0; index < mPlugins.size(); ++index)
         {
             auto result = mPlugins[index]->getRemainingFeatures();
-            auto it = result.find(static_cast<int>(feature));
-            if(it != result.end())
-            {
-                for(auto& that : it->second)
-                {
-                    if(!that.hasTimestamp)
-                    {
-                        that.hasTimestamp = true;
-                        that.timestamp = rt;
-                    }
-                    results[index].emplace_back(std::move(that));
-                }
-            }
+            dispatch(index, result, rt);
         }
         return std::make_tuple(juce::Result::ok(), false);
     }
@@ -310,19 +368,7 @@ std::tuple<juce::Result, bool> Plugin::Processor::performNextAudioBlock(std::vec
     for(size_t index = 0; index < mPlugins.size(); ++index)
     {
         auto result = mPlugins[index]->process(block, rt);
-        auto it = result.find(static_cast<int>(feature));
-        if(it != result.end())
-        {
-            for(auto& that : it->second)
-            {
-                if(!that.hasTimestamp)
-                {
-                    that.hasTimestamp = true;
-                    that.timestamp = rt;
-                }
-                results[index].emplace_back(std::move(that));
-            }
-        }
+        dispatch(index, result, rt);
         block += mPlugins[index]->getMaxChannelCount();
     }
     return std::make_tuple(juce::Result::ok(), true);
@@ -335,14 +381,20 @@ float Plugin::Processor::getAdvancement() const
     return position / length;
 }
 
-Plugin::Description Plugin::Processor::getDescription() const
+double Plugin::Processor::getReadingDuration() const
+{
+    return mCircularReader.getReadingDuration();
+}
+
+Plugin::Description Plugin::Processor::getDescription(size_t feature) const
 {
     MiscStrongAssert(!mPlugins.empty());
     if(mPlugins.empty() || mPlugins.at(0) == nullptr)
     {
         return {};
     }
-    return loadDescription(*mPlugins.at(0), mKey);
+    MiscStrongAssert(feature < mKeys.size());
+    return feature < mKeys.size() ? loadDescription(*mPlugins.at(0), mKeys.at(feature)) : Plugin::Description{};
 }
 
 std::vector<Plugin::Input> Plugin::Processor::getInputs() const
@@ -363,7 +415,7 @@ std::vector<Plugin::Input> Plugin::Processor::getInputs() const
     return inputs;
 }
 
-Plugin::Output Plugin::Processor::getOutput() const
+Plugin::Output Plugin::Processor::getOutput(size_t feature) const
 {
     MiscStrongAssert(!mPlugins.empty());
     if(mPlugins.empty() || mPlugins.at(0) == nullptr)
@@ -371,9 +423,14 @@ Plugin::Output Plugin::Processor::getOutput() const
         return {};
     }
 
+    MiscStrongAssert(feature < mFeatures.size());
+    if(feature >= mFeatures.size())
+    {
+        return {};
+    }
     auto const descriptors = mPlugins.at(0)->getOutputDescriptors();
-    MiscStrongAssert(descriptors.size() > mFeature);
-    return descriptors.size() > mFeature ? descriptors.at(mFeature) : Plugin::Output{};
+    MiscStrongAssert(descriptors.size() > mFeatures.at(feature));
+    return descriptors.size() > mFeatures.at(feature) ? descriptors.at(mFeatures.at(feature)) : Plugin::Output{};
 }
 
 std::unique_ptr<Plugin::Processor> Plugin::Processor::create(Key const& key, State const& state, juce::AudioFormatReader& audioFormatReader)
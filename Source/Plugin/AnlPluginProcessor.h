@@ -13,15 +13,24 @@ namespace Plugin
 
         ~Processor() = default;
 
-        juce::Result prepareToAnalyze(std::vector<std::vector<Result>>& results);
+        //! @brief Adds a feature of the plugin that is computed with the feature of the key.
+        //! @details The feature must be added before preparing the analysis. The method returns the index of
+        //! the feature in the results (the index of the feature of the key is 0).
+        size_t addFeature(std::string const& feature);
+
+        // [features[channels[results]]]
+        juce::Result prepareToAnalyze(std::vector<std::vector<std::vector<Result>>>& results);
         // [channels[features[results]]]
         juce::Result setPrecomputingResults(std::vector<std::vector<std::vector<Result>>> const& results);
-        std::tuple<juce::Result, bool> performNextAudioBlock(std::vector<std::vector<Result>>& results);
+        // [features[channels[results]]]
+        std::tuple<juce::Result, bool> performNextAudioBlock(std::vector<std::vector<std::vector<Result>>>& results);
         float getAdvancement() const;
+        //! @brief Gets the time spent reading the audio file (in seconds).
+        double getReadingDuration() const;
 
-        Description getDescription() const;
+        Description getDescription(size_t feature = 0_z) const;
         std::vector<Input> getInputs() const;
-        Output getOutput() const;
+        Output getOutput(size_t feature = 0_z) const;
 
     private:
         class CircularReader
@@ -37,8 +46,11 @@ namespace Plugin
             bool hasReachedEnd() const;
             juce::int64 getPosition() const;
             float const** getNextBlock();
+            double getReadingDuration() const;
 
         private:
+            void read(float* const* destChannels, int numChannels, juce::int64 startSample, int numSamples);
+
             int const mBlocksize;
             int const mStepSize;
             juce::int64 const mOffset;
@@ -48,14 +60,15 @@ namespace Plugin
             juce::int64 mReaderPosition{0};
             juce::int64 mPosition{0};
             std::vector<float const*> mOutputBuffer;
+            juce::int64 mReadingTicks{0};
         };
 
         Processor(juce::AudioFormatReader& audioFormatReader, std::vector<std::unique_ptr<Ive::PluginWrapper>> plugins, Key const& key, size_t const feature, State const& state);
 
         std::vector<std::unique_ptr<Ive::PluginWrapper>> mPlugins;
         CircularReader mCircularReader;
-        Key const mKey;
-        size_t const mFeature;
+        std::vector<Key> mKeys;
+        std::vector<size_t> mFeatures;
         State const mState;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Processor)
@@ -7,10 +7,11 @@
 
 ANALYSE_FILE_BEGIN
 
-Track::Director::Director(Accessor& accessor, juce::UndoManager& undoManager, HierarchyManager& hierarchyManager, std::unique_ptr<juce::AudioFormatReader> audioFormatReader)
+Track::Director::Director(Accessor& accessor, juce::UndoManager& undoManager, HierarchyManager& hierarchyManager, std::unique_ptr<juce::AudioFormatReader> audioFormatReader, SharedAnalyzer* sharedAnalyzer)
 : mAccessor(accessor)
 , mUndoManager(undoManager)
 , mHierarchyManager(hierarchyManager)
+, mSharedAnalyzer(sharedAnalyzer)
 , mAudioFormatReader(std::move(audioFormatReader))
 {
     mSharedZoomListener.onAttrChanged = [=, this](Zoom::Accessor const& sharedZoomAcsr, Zoom::AttrType attribute)
@@ -186,6 +187,7 @@ Track::Director::Director(Accessor& accessor, juce::UndoManager& undoManager, Hi
                 auto const access = results.getReadAccess();
                 if(static_cast<bool>(access))
                 {
+                    mProfiler.updateMemory(Profiler::getMemorySize(results));
                     auto const numChannels = results.getNumChannels();
                     if(numChannels.has_value())
                     {
@@ -410,6 +412,13 @@ Track::Director::Director(Accessor& accessor, juce::UndoManager& undoManager, Hi
         {
             mAccessor.fromJson(fd.extra, NotificationType::synchronous);
         }
+        // The paged results are read around the visible range before being used by the track
+        if(results.isPaged() && mSafeAccessorRetriever.getTimeZoomAccessorFn != nullptr)
+        {
+            std::atomic<bool> const shouldAbort{false};
+            auto const visibleRange = mSafeAccessorRetriever.getTimeZoomAccessorFn().getAttr<Zoom::AttrType::visibleRange>();
+            results.setPage(visibleRange.expanded(visibleRange.getLength() * 0.5), shouldAbort);
+        }
         mAccessor.setAttr<AttrType::results>(results, NotificationType::synchronous);
         runRendering();
     };
@@ -694,6 +703,35 @@ void Track::Director::setGlobalValueRange(juce::Range<double> const& range, Noti
     mAccessor.getAcsr<AcsrType::valueZoom>().setAttr<Zoom::AttrType::globalRange>(range, notification);
 }
 
+bool Track::Director::updateResultsPage(Zoom::Range const& visibleRange)
+{
+    auto const& results = mAccessor.getAttr<AttrType::results>();
+    if(!results.isPaged() || visibleRange.isEmpty())
+    {
+        return false;
+    }
+    {
+        auto const access = results.getReadAccess();
+        auto const page = static_cast<bool>(access) ? results.getPage() : std::optional<Zoom::Range>{};
+        if(page.has_value() && page->contains(visibleRange))
+        {
+            return false;
+        }
+    }
+
+    // The page extends the visible range on both sides so the frames are not read again for each small move.
+    // The rendering is stopped to release its access to the frames of the previous page.
+    mGraphics.stopRendering();
+    std::atomic<bool> const shouldAbort{false};
+    auto const updated = results.setPage(visibleRange.expanded(visibleRange.getLength() * 0.5), shouldAbort);
+    if(!updated)
+    {
+        MiscDebug("Track", "Director::updateResultsPage cannot read the frames");
+    }
+    runRendering();
+    return updated;
+}
+
 void Track::Director::setAudioFormatReader(std::unique_ptr<juce::AudioFormatReader> audioFormatReader, NotificationType const notification)
 {
     MiscStrongAssert(audioFormatReader == nullptr || audioFormatReader != mAudioFormatReader);
@@ -777,7 +815,17 @@ void Track::Director::runAnalysis(NotificationType const notification)
         if(input.second.isNotEmpty())
         {
             auto const& inputAcsr = mHierarchyManager.getAccessor(input.second);
-            inputStates[input.first].first = inputAcsr.getAttr<AttrType::results>();
+            auto const& inputResults = inputAcsr.getAttr<AttrType::results>();
+            // The analysis uses all the frames of the paged results
+            std::atomic<bool> const shouldAbort{false};
+            auto const loadedResults = inputResults.loadFrames({-1.0, std::numeric_limits<double>::max()}, shouldAbort);
+            if(auto const* error = std::get_if<juce::String>(&loadedResults))
+            {
+                mAccessor.setAttr<AttrType::warnings>(WarningType::plugin, notification);
+                warmAboutPlugin(*error);
+                return;
+            }
+            inputStates[input.first].first = std::get<Results>(loadedResults);
             if(useExtraThresholds)
             {
                 inputStates[input.first].second = inputAcsr.getAttr<AttrType::extraThresholds>();
@@ -787,7 +835,8 @@ void Track::Director::runAnalysis(NotificationType const notification)
 
     try
     {
-        auto const result = mProcessor.runAnalysis(mAccessor, *mAudioFormatReader.get(), inputStates);
+        mProfiler.reset();
+        auto const result = mProcessor.runAnalysis(mAccessor, *mAudioFormatReader.get(), inputStates, mSharedAnalyzer);
         if(result)
         {
             MiscDebug("Track", "analysis launched");
@@ -834,6 +883,7 @@ void Track::Director::runLoading()
         else
         {
             mAccessor.setAttr<AttrType::warnings>(WarningType::none, NotificationType::synchronous);
+            mProfiler.reset();
             mLoader.loadAnalysis(std::get<1_z>(fdResult));
             startTimer(50);
             timerCallback();
@@ -1414,7 +1464,7 @@ void Track::Director::saveBackup() const
     if(mBackupDirectory != juce::File{} && mAccessor.getAttr<AttrType::file>().commit.isNotEmpty())
     {
         mBackupDirectory.createDirectory();
-        Exporter::consolidateInDirectory(mAccessor, mBackupDirectory);
+        Exporter::consolidateInDirectory(mAccessor, mBackupDirectory, false);
         MiscDebug("Track::Director", "saved");
     }
 }
@@ -1437,4 +1487,14 @@ bool Track::Director::isFileModified() const
     return getEffectiveFile().getFileName() != mAccessor.getAttr<AttrType::file>().file.getFileName();
 }
 
+Track::Profiler const& Track::Director::getProfiler() const
+{
+    return mProfiler;
+}
+
+Track::Profiler& Track::Director::getProfiler()
+{
+    return mProfiler;
+}
+
 ANALYSE_FILE_END
@@ -6,6 +6,7 @@
 #include "AnlTrackLoader.h"
 #include "AnlTrackModel.h"
 #include "AnlTrackProcessor.h"
+#include "AnlTrackProfiler.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -23,7 +24,7 @@ namespace Track
     , private juce::Timer
     {
     public:
-        Director(Accessor& accessor, juce::UndoManager& undoManager, HierarchyManager& hierarchyManager, std::unique_ptr<juce::AudioFormatReader> audioFormatReader);
+        Director(Accessor& accessor, juce::UndoManager& undoManager, HierarchyManager& hierarchyManager, std::unique_ptr<juce::AudioFormatReader> audioFormatReader, SharedAnalyzer* sharedAnalyzer = nullptr);
         ~Director() override;
 
         Accessor& getAccessor();
@@ -42,6 +43,9 @@ namespace Track
         void endAction(ActionState state, juce::String const& name = {});
 
         void setGlobalValueRange(juce::Range<double> const& range, NotificationType const notification);
+        //! @brief Reads the frames around the visible range if the results are paged.
+        //! @return true if the frames in memory have changed.
+        bool updateResultsPage(Zoom::Range const& visibleRange);
 
         void setAudioFormatReader(std::unique_ptr<juce::AudioFormatReader> audioFormatReader, NotificationType const notification);
         void setBackupDirectory(juce::File const& directory);
@@ -69,6 +73,10 @@ namespace Track
 
         bool isFileModified() const;
 
+        //! @brief Gets the profiler of the stages of the track.
+        Profiler const& getProfiler() const;
+        Profiler& getProfiler();
+
     private:
         void sanitizeZooms(NotificationType const notification);
         void sanitizeExtraOutputs(NotificationType const notification);
@@ -91,12 +99,14 @@ namespace Track
         Accessor& mAccessor;
         juce::UndoManager& mUndoManager;
         HierarchyManager& mHierarchyManager;
+        SharedAnalyzer* mSharedAnalyzer{nullptr};
         Accessor mSavedState;
         bool mIsPerformingAction{false};
         std::unique_ptr<juce::AudioFormatReader> mAudioFormatReader;
-        Processor mProcessor;
-        Loader mLoader;
-        Graphics mGraphics;
+        Profiler mProfiler;
+        Processor mProcessor{mProfiler};
+        Loader mLoader{mProfiler};
+        Graphics mGraphics{mProfiler};
         std::optional<ColourMap> mLastColourMap;
         std::optional<std::reference_wrapper<Zoom::Accessor>> mSharedZoomAccessor;
         Zoom::Accessor::Listener mSharedZoomListener{typeid(*this).name()};
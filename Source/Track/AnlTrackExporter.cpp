@@ -1,6 +1,12 @@
 #include "AnlTrackExporter.h"
+#include "AnlTrackLoader.h"
 #include "AnlTrackRenderer.h"
 #include "AnlTrackTools.h"
+#include "Result/AnlTrackResultBinary.h"
+#include "Result/AnlTrackResultNumpy.h"
+#include <charconv>
+#include <clocale>
+#include <cstdio>
 
 ANALYSE_FILE_BEGIN
 
@@ -16,6 +22,7 @@ namespace
     {
           dataLocked
         , dataInvalid
+        , dataIncompatible
         , streamAccessFailure
         , streamWritingFailure
         , fileAccessFailure
@@ -30,6 +37,8 @@ namespace
                 return failed(name, format, "the result data are being processed");
             case ErrorType::dataInvalid:
                 return failed(name, format, "the result data are invalid");
+            case ErrorType::dataIncompatible:
+                return failed(name, format, "the result data are not supported by the format");
             case ErrorType::streamAccessFailure:
                 return failed(name, format, "the output stream cannot be opened");
             case ErrorType::streamWritingFailure:
@@ -44,8 +53,341 @@ namespace
     {
         return juce::Result::fail(juce::translate("The export of the track NAME as FORMAT has been aborted.").replace("NAME", name).replace("FORMAT", format));
     }
+
+    // Buffers the text of the exports and writes it to the stream by blocks. The numbers are formatted
+    // with std::snprintf using the floating-point format and the precision of the stream, which is what
+    // the stream operators do with the classic locale (the floating-point std::to_chars isn't available
+    // on all the supported systems). The stream operators are still used if the stream has another
+    // locale or other formatting flags.
+    class TextWriter
+    {
+    public:
+        TextWriter(std::ostream& stream)
+        : mStream(stream)
+        , mFloatField(stream.flags() & std::ios::floatfield)
+        , mPrecision(static_cast<int>(stream.precision()))
+        , mUseStreamFormatting(!hasClassicFormatting(stream) || !hasClassicDecimalPoint())
+        , mUseDefaultFormatting(std::locale() != std::locale::classic() || !hasClassicDecimalPoint())
+        {
+            mBuffer.reserve(bufferSize);
+        }
+
+        ~TextWriter()
+        {
+            flush();
+        }
+
+        void write(char c)
+        {
+            mBuffer.push_back(c);
+            flushIfFull();
+        }
+
+        void write(std::string_view text)
+        {
+            mBuffer.append(text);
+            flushIfFull();
+        }
+
+        // Writes the value like the stream operator
+        void writeNumber(double value)
+        {
+            if(mUseStreamFormatting)
+            {
+                flush();
+                mStream << value;
+                return;
+            }
+            std::array<char, 512> buffer;
+            auto const* format = mFloatField == std::ios::fixed ? "%.*f" : (mFloatField == std::ios::scientific ? "%.*e" : "%.*g");
+            auto const length = std::snprintf(buffer.data(), buffer.size(), format, mPrecision, value);
+            if(length < 0 || static_cast<size_t>(length) >= buffer.size())
+            {
+                flush();
+                mStream << value;
+                return;
+            }
+            write(std::string_view(buffer.data(), static_cast<size_t>(length)));
+        }
+
+        // Writes the value like the stream operator
+        void writeInteger(long long value)
+        {
+            if(mUseStreamFormatting)
+            {
+                flush();
+                mStream << value;
+                return;
+            }
+            std::array<char, 32> buffer;
+            auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            write(std::string_view(buffer.data(), static_cast<size_t>(result.ptr - buffer.data())));
+        }
+
+        // Writes the value like a default std::ostringstream (general format with a precision of 6)
+        void writeDefaultNumber(float value)
+        {
+            if(mUseDefaultFormatting)
+            {
+                std::ostringstream ss;
+                ss << value;
+                write(ss.str());
+                return;
+            }
+            // The stream operator converts the value to double
+            std::array<char, 64> buffer;
+            auto const length = std::snprintf(buffer.data(), buffer.size(), "%.6g", static_cast<double>(value));
+            write(std::string_view(buffer.data(), static_cast<size_t>(std::clamp(length, 0, static_cast<int>(buffer.size()) - 1))));
+        }
+
+        // Writes the text between double quotes with the quotes, the tabulations and the line breaks escaped
+        void writeEscaped(std::string_view text)
+        {
+            appendEscaped(mBuffer, text);
+            flushIfFull();
+        }
+
+        bool flush()
+        {
+            if(!mBuffer.empty())
+            {
+                mStream.write(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+                mBuffer.clear();
+            }
+            return mStream.good();
+        }
+
+        // This gives the same result as replacing the characters one after the other and calling
+        // juce::String::quoted() that doesn't add the closing quote if the text already ends with one.
+        static void appendEscaped(std::string& output, std::string_view text)
+        {
+            static auto constexpr escapeTable = []()
+            {
+                std::array<char, 256> table{};
+                table[static_cast<unsigned char>('"')] = '"';
+                table[static_cast<unsigned char>('\'')] = '\'';
+                table[static_cast<unsigned char>('\t')] = 't';
+                table[static_cast<unsigned char>('\r')] = 'r';
+                table[static_cast<unsigned char>('\n')] = 'n';
+                return table;
+            }();
+
+            output.push_back('"');
+            for(auto const c : text)
+            {
+                auto const escaped = escapeTable[static_cast<unsigned char>(c)];
+                if(escaped != '\0')
+                {
+                    output.push_back('\\');
+                    output.push_back(escaped);
+                }
+                else
+                {
+                    output.push_back(c);
+                }
+            }
+            if(text.empty() || text.back() != '"')
+            {
+                output.push_back('"');
+            }
+        }
+
+    private:
+        static auto constexpr bufferSize = 65536_z;
+
+        static bool hasClassicFormatting(std::ostream const& stream)
+        {
+            auto const flags = stream.flags();
+            auto const floatField = flags & std::ios::floatfield;
+            auto const baseField = flags & std::ios::basefield;
+            return (flags & (std::ios::showpos | std::ios::showpoint | std::ios::uppercase)) == 0 && floatField != std::ios::floatfield && (baseField == std::ios::dec || baseField == 0) && stream.precision() >= 0 && stream.getloc() == std::locale::classic();
+        }
+
+        // std::snprintf uses the decimal point of the C locale
+        static bool hasClassicDecimalPoint()
+        {
+            auto const* conv = std::localeconv();
+            return conv != nullptr && conv->decimal_point != nullptr && std::string_view(conv->decimal_point) == ".";
+        }
+
+        void flushIfFull()
+        {
+            if(mBuffer.size() >= bufferSize)
+            {
+                flush();
+            }
+        }
+
+        std::ostream& mStream;
+        std::ios::fmtflags const mFloatField;
+        int const mPrecision;
+        bool const mUseStreamFormatting;
+        bool const mUseDefaultFormatting;
+        std::string mBuffer;
+    };
+
+    // The JSON results are written frame by frame with the same formatting as nlohmann::json::dump
+    // (sorted keys, shortest round-trip numbers, null for non-finite numbers and empty channels) so
+    // the output remains identical without building the whole document in memory.
+    void writeJsonNumber(TextWriter& writer, double value)
+    {
+        if(!std::isfinite(value))
+        {
+            writer.write("null");
+            return;
+        }
+        std::array<char, 64> buffer;
+        auto const* end = nlohmann::detail::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        writer.write(std::string_view(buffer.data(), static_cast<size_t>(end - buffer.data())));
+    }
+
+    void writeJsonNumbers(TextWriter& writer, std::vector<float> const& values)
+    {
+        writer.write('[');
+        for(auto index = 0_z; index < values.size(); ++index)
+        {
+            if(index > 0_z)
+            {
+                writer.write(',');
+            }
+            writeJsonNumber(writer, static_cast<double>(values[index]));
+        }
+        writer.write(']');
+    }
+
+    void writeJsonFrame(TextWriter& writer, Track::Results::Marker const& marker)
+    {
+        writer.write("{\"duration\":");
+        writeJsonNumber(writer, std::get<1_z>(marker));
+        if(!std::get<3_z>(marker).empty())
+        {
+            writer.write(",\"extra\":");
+            writeJsonNumbers(writer, std::get<3_z>(marker));
+        }
+        writer.write(",\"label\":");
+        writer.write(nlohmann::json(std::get<2_z>(marker)).dump());
+        writer.write(",\"time\":");
+        writeJsonNumber(writer, std::get<0_z>(marker));
+        writer.write('}');
+    }
+
+    void writeJsonFrame(TextWriter& writer, Track::Results::Point const& point)
+    {
+        writer.write("{\"duration\":");
+        writeJsonNumber(writer, std::get<1_z>(point));
+        if(!std::get<3_z>(point).empty())
+        {
+            writer.write(",\"extra\":");
+            writeJsonNumbers(writer, std::get<3_z>(point));
+        }
+        writer.write(",\"time\":");
+        writeJsonNumber(writer, std::get<0_z>(point));
+        writer.write(",\"value\":");
+        if(std::get<2_z>(point).has_value())
+        {
+            writeJsonNumber(writer, static_cast<double>(std::get<2_z>(point).value()));
+        }
+        else
+        {
+            writer.write("null");
+        }
+        writer.write('}');
+    }
+
+    void writeJsonFrame(TextWriter& writer, Track::Results::Column const& column)
+    {
+        writer.write("{\"duration\":");
+        writeJsonNumber(writer, std::get<1_z>(column));
+        if(!std::get<3_z>(column).empty())
+        {
+            writer.write(",\"extra\":");
+            writeJsonNumbers(writer, std::get<3_z>(column));
+        }
+        writer.write(",\"time\":");
+        writeJsonNumber(writer, std::get<0_z>(column));
+        writer.write(",\"values\":");
+        writeJsonNumbers(writer, std::get<2_z>(column));
+        writer.write('}');
+    }
+
+    template <typename T>
+    bool writeJsonChannels(TextWriter& writer, std::vector<std::vector<T>> const& results, Zoom::Range const& timeRange, std::set<size_t> const& channels, bool applyExtraThresholds, std::vector<std::optional<float>> const& extraThresholds, std::atomic<bool> const& shouldAbort)
+    {
+        auto hasChannel = false;
+        for(auto channelIndex = 0_z; channelIndex < results.size(); ++channelIndex)
+        {
+            if(channels.empty() || channels.count(channelIndex) > 0_z)
+            {
+                writer.write(hasChannel ? ',' : '[');
+                hasChannel = true;
+
+                auto const& channelResults = results.at(channelIndex);
+                auto hasFrame = false;
+                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Track::Result::lower_cmp<T>);
+                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
+                {
+                    if(shouldAbort)
+                    {
+                        return false;
+                    }
+                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
+                    if(!applyExtraThresholds || Track::Result::passThresholds(*it, extraThresholds))
+                    {
+                        writer.write(hasFrame ? ',' : '[');
+                        hasFrame = true;
+                        writeJsonFrame(writer, *it);
+                    }
+                    ++it;
+                }
+                writer.write(hasFrame ? "]" : "null");
+            }
+        }
+        writer.write(hasChannel ? "]" : "null");
+        return true;
+    }
+
+    void paintImage(Track::Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, juce::Graphics& g, int width, int height, Zoom::Grid::Justification outsideGridJustification)
+    {
+        g.fillAll(accessor.getAttr<Track::AttrType::graphicsSettings>().colours.background);
+        auto const bounds = juce::Rectangle<int>(0, 0, width, height);
+        auto const& laf = juce::Desktop::getInstance().getDefaultLookAndFeel();
+
+        auto const channelLayout = accessor.getAttr<Track::AttrType::channelsLayout>();
+        auto channelVisibility = channels.empty() ? channelLayout : std::vector<bool>(channelLayout.size(), false);
+        for(auto const& channel : channels)
+        {
+            if(channel < channelVisibility.size())
+            {
+                channelVisibility[channel] = true;
+            }
+        }
+
+        auto const colour = laf.findColour(Decorator::ColourIds::normalBorderColourId);
+        Track::Renderer::paint(accessor, timeZoomAccessor, g, bounds, channelVisibility, colour, outsideGridJustification);
+    }
 } // namespace
 
+std::unique_ptr<juce::ImageFileFormat> Track::Exporter::createImageFormat(juce::File const& file, int width, int height, int scaledWidth, int scaledHeight)
+{
+    // The formats returned by juce::ImageFileFormat::findImageFormatForFileExtension are shared
+    // instances, so a new one is created to set the density without affecting concurrent exports.
+    auto* sharedFormat = juce::ImageFileFormat::findImageFormatForFileExtension(file);
+    auto const density = PngStripWriter::getDensity(width, height, scaledWidth, scaledHeight);
+    if(dynamic_cast<juce::PNGImageFormat*>(sharedFormat) != nullptr)
+    {
+        auto pngFormat = std::make_unique<juce::PNGImageFormat>();
+        pngFormat->setDensity(static_cast<juce::uint32>(density.x), static_cast<juce::uint32>(density.y));
+        return pngFormat;
+    }
+    if(dynamic_cast<juce::JPEGImageFormat*>(sharedFormat) != nullptr)
+    {
+        auto jpegFormat = std::make_unique<juce::JPEGImageFormat>();
+        jpegFormat->setDensity(static_cast<juce::uint16>(density.x), static_cast<juce::uint16>(density.y));
+        return jpegFormat;
+    }
+    return nullptr;
+}
+
 juce::Result Track::Exporter::fromProcessorPreset(Accessor& accessor, juce::File const& file)
 {
     auto xml = juce::XmlDocument::parse(file);
@@ -132,22 +474,7 @@ juce::Image Track::Exporter::toImage(Accessor const& accessor, Zoom::Accessor co
     auto const scaleWidth = static_cast<float>(scaledWidth) / static_cast<float>(width);
     auto const scaleHeight = static_cast<float>(scaledHeight) / static_cast<float>(height);
     g.addTransform(juce::AffineTransform::scale(scaleWidth, scaleHeight));
-    g.fillAll(accessor.getAttr<AttrType::graphicsSettings>().colours.background);
-    auto const bounds = juce::Rectangle<int>(0, 0, width, height);
-    auto const& laf = juce::Desktop::getInstance().getDefaultLookAndFeel();
-
-    auto const channelLayout = accessor.getAttr<AttrType::channelsLayout>();
-    auto channelVisibility = channels.empty() ? channelLayout : std::vector<bool>(channelLayout.size(), false);
-    for(auto const& channel : channels)
-    {
-        if(channel < channelVisibility.size())
-        {
-            channelVisibility[channel] = true;
-        }
-    }
-
-    auto const colour = laf.findColour(Decorator::ColourIds::normalBorderColourId);
-    Renderer::paint(accessor, timeZoomAccessor, g, bounds, channelVisibility, colour, outsideGridJustification);
+    paintImage(accessor, timeZoomAccessor, channels, g, width, height, outsideGridJustification);
     return image;
 }
 
@@ -162,18 +489,8 @@ juce::Result Track::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
     }
 
     juce::TemporaryFile temp(file);
-    auto* imageFormat = juce::ImageFileFormat::findImageFormatForFileExtension(temp.getFile());
-    auto const xDensity = std::round(static_cast<double>(scaledWidth) / static_cast<double>(width) * 72.0);
-    auto const yDensity = std::round(static_cast<double>(scaledHeight) / static_cast<double>(height) * 72.0);
-    if(auto* pngFormat = dynamic_cast<juce::PNGImageFormat*>(imageFormat))
-    {
-        pngFormat->setDensity(static_cast<juce::uint32>(xDensity), static_cast<juce::uint32>(yDensity));
-    }
-    else if(auto* jpegFormat = dynamic_cast<juce::JPEGImageFormat*>(imageFormat))
-    {
-        jpegFormat->setDensity(static_cast<juce::uint16>(xDensity), static_cast<juce::uint16>(yDensity));
-    }
-    else
+    auto imageFormat = createImageFormat(temp.getFile(), width, height, scaledWidth, scaledHeight);
+    if(imageFormat == nullptr)
     {
         return failed(name, format, "the format is not supported");
     }
@@ -183,15 +500,36 @@ juce::Result Track::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
         return aborted(name, format);
     }
 
-    auto const image = toImage(accessor, timeZoomAccessor, channels, width, height, scaledWidth, scaledHeight, outsideGridJustification);
-
-    if(shouldAbort)
+    // The PNG images are rendered by strips and streamed to the file so large images don't need to be
+    // allocated entirely in memory
+    if(dynamic_cast<juce::PNGImageFormat*>(imageFormat.get()) != nullptr)
     {
-        return aborted(name, format);
+        juce::FileOutputStream stream(temp.getFile());
+        if(!stream.openedOk())
+        {
+            return failed(name, format, ErrorType::streamAccessFailure);
+        }
+        auto const paintFn = [&](juce::Graphics& g)
+        {
+            paintImage(accessor, timeZoomAccessor, channels, g, width, height, outsideGridJustification);
+        };
+        if(!PngStripWriter::write(stream, width, height, scaledWidth, scaledHeight, paintFn, shouldAbort))
+        {
+            return shouldAbort ? aborted(name, format) : failed(name, format, ErrorType::streamWritingFailure);
+        }
     }
-
-    if(image.isValid())
+    else
     {
+        auto const image = toImage(accessor, timeZoomAccessor, channels, width, height, scaledWidth, scaledHeight, outsideGridJustification);
+        if(shouldAbort)
+        {
+            return aborted(name, format);
+        }
+        if(!image.isValid())
+        {
+            return failed(name, format, "the image cannot be created");
+        }
+
         juce::FileOutputStream stream(temp.getFile());
         if(!stream.openedOk())
         {
@@ -203,10 +541,6 @@ juce::Result Track::Exporter::toImage(Accessor const& accessor, Zoom::Accessor c
             return failed(name, format, ErrorType::streamWritingFailure);
         }
     }
-    else
-    {
-        return failed(name, format, "the image cannot be created");
-    }
 
     if(shouldAbort)
     {
@@ -255,6 +589,7 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
 
     auto const& extraThresholds = accessor.getAttr<AttrType::extraThresholds>();
 
+    TextWriter writer(stream);
     auto state = false;
     auto lineIndex = 0;
     auto const addLine = [&]()
@@ -262,29 +597,60 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
         if(lineIndex > 0)
         {
             state = false;
-            stream << lineBreakSeparator;
+            writer.write(lineBreakSeparator);
         }
         if(prependLineIndex)
         {
-            stream << (lineIndex + 1) << ", ";
+            writer.writeInteger(lineIndex + 1);
+            writer.write(", ");
         }
         ++lineIndex;
     };
 
-    auto const addColumn = [&](auto const& text)
+    auto const addSeparator = [&]()
     {
         if(state)
         {
-            stream << separator;
+            writer.write(separator);
         }
-        stream << text;
         state = true;
-        return true;
     };
 
-    auto const escapeString = [&](juce::String const& s)
+    auto const addColumn = [&](std::string_view text)
+    {
+        addSeparator();
+        writer.write(text);
+    };
+
+    auto const escapeString = [&](std::string const& s)
     {
-        return disableLabelEscaping ? s.toStdString() : s.replace("\"", "\\\"").replace("\'", "\\\'").replace("\t", "\\t").replace("\r", "\\r").replace("\n", "\\n").quoted().toStdString();
+        if(disableLabelEscaping)
+        {
+            return s;
+        }
+        std::string escaped;
+        TextWriter::appendEscaped(escaped, s);
+        return escaped;
+    };
+
+    auto const addLabelColumn = [&](std::string const& label)
+    {
+        addSeparator();
+        if(disableLabelEscaping)
+        {
+            writer.write(label);
+        }
+        else
+        {
+            writer.writeEscaped(label);
+        }
+    };
+
+    // Don't use the stream formatting (e.g. precision) for the values but the default formatting
+    auto const addValueColumn = [&](float value)
+    {
+        addSeparator();
+        writer.writeDefaultNumber(value);
     };
 
     auto const description = accessor.getAttr<AttrType::description>();
@@ -363,29 +729,17 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
         }
     };
 
-    auto const addRow = [&](auto const iterator, auto const& extraColumns)
+    auto const addTimeColumns = [&](auto const iterator)
     {
         addLine();
         auto const time = std::get<0_z>(*iterator);
         auto const duration = std::get<1_z>(*iterator);
         MiscWeakAssert(time >= timeRange.getStart());
         MiscWeakAssert(duration >= 0.0);
-        addColumn(time);
-        addColumn(std::max(useEndTime ? time + duration : duration, 0.0));
-        for(auto const& extraColumn : extraColumns)
-        {
-            addColumn(extraColumn);
-        }
-    };
-
-    auto const escapeFloat = [](auto const& s)
-    {
-        // Don't use the stream directly to avoid locale issues, especially with the decimal separator.
-        // Instead, use a separate stringstream that we can control the locale of if needed.
-        // But ignore the formatting of the stream (e.g. precision) // ss.copyfmt(stream); ss.imbue(stream.getloc());
-        std::ostringstream ss;
-        ss << s;
-        return ss.str();
+        addSeparator();
+        writer.writeNumber(time);
+        addSeparator();
+        writer.writeNumber(std::max(useEndTime ? time + duration : duration, 0.0));
     };
 
     auto const markers = results.getMarkers();
@@ -412,25 +766,28 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
         }
     };
 
-    std::vector<std::string> binColumns;
+    auto const& extraOutputs = description.extraOutputs;
+    auto const addExtraColumns = [&](std::vector<float> const& extra)
+    {
+        for(size_t j = 0; j < extra.size() && j < extraOutputs.size(); ++j)
+        {
+            addValueColumn(extra.at(j));
+        }
+    };
+
     if(markers != nullptr)
     {
         auto const addChannel = [&](std::vector<Results::Marker> const& channelMarkers)
         {
             addHeader(1_z, "LABEL");
-            auto const& extraOutputs = description.extraOutputs;
             auto it = std::lower_bound(channelMarkers.cbegin(), channelMarkers.cend(), timeRange.getStart(), Result::lower_cmp<Results::Marker>);
             while(it != channelMarkers.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
             {
                 if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
                 {
-                    binColumns.clear();
-                    binColumns.push_back(escapeString(std::get<2_z>(*it)));
-                    for(size_t j = 0; j < std::get<3_z>(*it).size() && j < extraOutputs.size(); ++j)
-                    {
-                        binColumns.push_back(escapeFloat(std::get<3_z>(*it).at(j)));
-                    }
-                    addRow(it, binColumns);
+                    addTimeColumns(it);
+                    addLabelColumn(std::get<2_z>(*it));
+                    addExtraColumns(std::get<3_z>(*it));
                 }
                 ++it;
             }
@@ -442,19 +799,21 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
         auto const addChannel = [&](std::vector<Results::Point> const& channelPoints)
         {
             addHeader(1_z, "VALUE");
-            auto const& extraOutputs = description.extraOutputs;
             auto it = std::lower_bound(channelPoints.cbegin(), channelPoints.cend(), timeRange.getStart(), Result::lower_cmp<Results::Point>);
             while(it != channelPoints.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
             {
                 if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
                 {
-                    binColumns.clear();
-                    binColumns.push_back(std::get<2_z>(*it).has_value() ? escapeFloat(std::get<2_z>(*it).value()) : std::string{});
-                    for(size_t j = 0; j < std::get<3_z>(*it).size() && j < extraOutputs.size(); ++j)
+                    addTimeColumns(it);
+                    if(std::get<2_z>(*it).has_value())
+                    {
+                        addValueColumn(std::get<2_z>(*it).value());
+                    }
+                    else
                     {
-                        binColumns.push_back(escapeFloat(std::get<3_z>(*it).at(j)));
+                        addSeparator();
                     }
-                    addRow(it, binColumns);
+                    addExtraColumns(std::get<3_z>(*it));
                 }
                 ++it;
             }
@@ -470,22 +829,17 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
                                                      return std::max(s, std::get<2>(channelColumn).size());
                                                  });
             addHeader(numBins, "BIN");
-            auto const& extraOutputs = description.extraOutputs;
             auto it = std::lower_bound(channelColumns.cbegin(), channelColumns.cend(), timeRange.getStart(), Result::lower_cmp<Results::Column>);
             while(it != channelColumns.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
             {
                 if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
                 {
-                    binColumns.clear();
+                    addTimeColumns(it);
                     for(auto const& value : std::get<2_z>(*it))
                     {
-                        binColumns.push_back(escapeFloat(value));
-                    }
-                    for(size_t j = 0; j < std::get<3_z>(*it).size() && j < extraOutputs.size(); ++j)
-                    {
-                        binColumns.push_back(escapeFloat(std::get<3_z>(*it).at(j)));
+                        addValueColumn(value);
                     }
-                    addRow(it, binColumns);
+                    addExtraColumns(std::get<3_z>(*it));
                 }
                 ++it;
             }
@@ -496,7 +850,7 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
     if(lineIndex > 0)
     {
         state = false;
-        stream << lineBreakSeparator;
+        writer.write(lineBreakSeparator);
     }
 
     if(shouldAbort)
@@ -504,7 +858,7 @@ juce::Result Track::Exporter::toCsv(Accessor const& accessor, Zoom::Range timeRa
         return aborted(name, format);
     }
 
-    if(!stream.good())
+    if(!writer.flush())
     {
         return failed(name, format, ErrorType::streamWritingFailure);
     }
@@ -594,129 +948,37 @@ juce::Result Track::Exporter::toJson(Accessor const& accessor, Zoom::Range timeR
 
     auto const& extraThresholds = accessor.getAttr<AttrType::extraThresholds>();
 
-    auto container = nlohmann::json::object();
-    auto& json = container["results"];
-    if(includeDescription)
+    TextWriter writer(stream);
+    auto const completed = [&]()
     {
-        container["track"] = std::move(description);
-    }
-
-    auto const markers = results.getMarkers();
-    auto const points = results.getPoints();
-    auto const columns = results.getColumns();
-    if(markers != nullptr)
-    {
-        for(auto channelIndex = 0_z; channelIndex < markers->size(); ++channelIndex)
+        writer.write("{\"results\":");
+        if(auto const markers = results.getMarkers())
         {
-            if(channels.empty() || channels.count(channelIndex) > 0_z)
-            {
-                auto const& channelResults = markers->at(channelIndex);
-                if(shouldAbort)
-                {
-                    return aborted(name, format);
-                }
-
-                nlohmann::json cjson;
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Marker>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
-                    {
-                        nlohmann::json vjson;
-                        vjson["time"] = std::get<0_z>(*it);
-                        vjson["duration"] = std::get<1_z>(*it);
-                        vjson["label"] = std::get<2_z>(*it);
-                        if(!std::get<3_z>(*it).empty())
-                        {
-                            vjson["extra"] = std::get<3_z>(*it);
-                        }
-                        cjson.emplace_back(std::move(vjson));
-                    }
-                    ++it;
-                }
-                json.emplace_back(std::move(cjson));
-            }
+            return writeJsonChannels(writer, *markers, timeRange, channels, applyExtraThresholds, extraThresholds, shouldAbort);
         }
-    }
-    else if(points != nullptr)
-    {
-        for(auto channelIndex = 0_z; channelIndex < points->size(); ++channelIndex)
+        if(auto const points = results.getPoints())
         {
-            if(channels.empty() || channels.count(channelIndex) > 0_z)
-            {
-                auto const& channelResults = points->at(channelIndex);
-                if(shouldAbort)
-                {
-                    return aborted(name, format);
-                }
-
-                nlohmann::json cjson;
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Point>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
-                    {
-                        nlohmann::json vjson;
-                        vjson["time"] = std::get<0_z>(*it);
-                        vjson["duration"] = std::get<1_z>(*it);
-                        if(std::get<2_z>(*it).has_value())
-                        {
-                            vjson["value"] = std::get<2_z>(*it).value();
-                        }
-                        else
-                        {
-                            vjson["value"] = {};
-                        }
-                        if(!std::get<3_z>(*it).empty())
-                        {
-                            vjson["extra"] = std::get<3_z>(*it);
-                        }
-                        cjson.emplace_back(std::move(vjson));
-                    }
-                    ++it;
-                }
-                json.emplace_back(std::move(cjson));
-            }
+            return writeJsonChannels(writer, *points, timeRange, channels, applyExtraThresholds, extraThresholds, shouldAbort);
         }
-    }
-    else if(columns != nullptr)
-    {
-        for(auto channelIndex = 0_z; channelIndex < columns->size(); ++channelIndex)
+        if(auto const columns = results.getColumns())
         {
-            if(channels.empty() || channels.count(channelIndex) > 0_z)
-            {
-                auto const& channelResults = columns->at(channelIndex);
-                nlohmann::json cjson;
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Column>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    if(shouldAbort)
-                    {
-                        return aborted(name, format);
-                    }
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
-                    {
-                        nlohmann::json vjson;
-                        vjson["time"] = std::get<0_z>(*it);
-                        vjson["duration"] = std::get<1_z>(*it);
-                        vjson["values"] = std::get<2_z>(*it);
-                        if(!std::get<3_z>(*it).empty())
-                        {
-                            vjson["extra"] = std::get<3_z>(*it);
-                        }
-                        cjson.emplace_back(std::move(vjson));
-                    }
-                    ++it;
-                }
-                json.emplace_back(std::move(cjson));
-            }
+            return writeJsonChannels(writer, *columns, timeRange, channels, applyExtraThresholds, extraThresholds, shouldAbort);
         }
+        writer.write("null");
+        return true;
+    }();
+    if(!completed)
+    {
+        return aborted(name, format);
     }
-
-    stream << container << std::endl;
+    if(includeDescription)
+    {
+        writer.write(",\"track\":");
+        writer.write(description.dump());
+    }
+    writer.write('}');
+    writer.flush();
+    stream << std::endl;
     if(!stream.good())
     {
         return failed(name, format, ErrorType::streamWritingFailure);
@@ -811,19 +1073,24 @@ juce::Result Track::Exporter::toCue(Accessor const& accessor, Zoom::Range timeRa
         return aborted(name, format);
     }
 
-    auto const to2Digits = [](int value)
+    TextWriter writer(stream);
+    auto const write2Digits = [&](int value)
     {
         value = std::max(std::min(value, 99), 0);
-        auto const v10 = static_cast<int>(value / 10);
-        return std::to_string(v10) + std::to_string(value - (v10 * 10));
+        writer.write(static_cast<char>('0' + value / 10));
+        writer.write(static_cast<char>('0' + value % 10));
     };
 
-    auto const timeToString = [&](double time)
+    auto const writeTime = [&](double time)
     {
         auto const minutes = std::floor(time / 60.0);
         auto const seconds = std::floor(time - (minutes * 60.0));
         auto const frames = std::round((time - (minutes * 60.0) - seconds) * 75.0);
-        return to2Digits(static_cast<int>(minutes)) + ":" + to2Digits(static_cast<int>(seconds)) + ":" + to2Digits(static_cast<int>(frames));
+        write2Digits(static_cast<int>(minutes));
+        writer.write(':');
+        write2Digits(static_cast<int>(seconds));
+        writer.write(':');
+        write2Digits(static_cast<int>(frames));
     };
 
     auto const& extraThresholds = accessor.getAttr<AttrType::extraThresholds>();
@@ -837,7 +1104,9 @@ juce::Result Track::Exporter::toCue(Accessor const& accessor, Zoom::Range timeRa
             }
 
             auto const& channelResults = markers->at(channelIndex);
-            stream << "TITLE CHANNEL_" << to2Digits(static_cast<int>(channelIndex)) << "\n";
+            writer.write("TITLE CHANNEL_");
+            write2Digits(static_cast<int>(channelIndex));
+            writer.write('\n');
             auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Marker>);
             auto frameIndex = std::distance(channelResults.cbegin(), it);
             while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
@@ -845,12 +1114,15 @@ juce::Result Track::Exporter::toCue(Accessor const& accessor, Zoom::Range timeRa
                 if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
                 {
                     MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    stream << "  "
-                           << "TRACK " << to2Digits(static_cast<int>(frameIndex)) << " AUDIO \n";
-                    stream << "    "
-                           << "TITLE \"" << std::get<2_z>(*it) << "\"\n";
-                    stream << "    "
-                           << "INDEX 01 " << timeToString(std::get<0_z>(*it)) << "\n";
+                    writer.write("  TRACK ");
+                    write2Digits(static_cast<int>(frameIndex));
+                    writer.write(" AUDIO \n");
+                    writer.write("    TITLE \"");
+                    writer.write(std::get<2_z>(*it));
+                    writer.write("\"\n");
+                    writer.write("    INDEX 01 ");
+                    writeTime(std::get<0_z>(*it));
+                    writer.write('\n');
                 }
                 ++it;
                 ++frameIndex;
@@ -858,7 +1130,7 @@ juce::Result Track::Exporter::toCue(Accessor const& accessor, Zoom::Range timeRa
         }
     }
 
-    if(!stream.good())
+    if(!writer.flush())
     {
         return failed(name, format, ErrorType::streamWritingFailure);
     }
@@ -952,16 +1224,12 @@ juce::Result Track::Exporter::toReaper(Accessor const& accessor, Zoom::Range tim
         return aborted(name, format);
     }
 
-    auto const escapeString = [](juce::String const& s)
-    {
-        return s.replace("\"", "\\\"").replace("\'", "\\\'").replace("\t", "\\t").replace("\r", "\\r").replace("\n", "\\n").quoted().toStdString();
-    };
-
     auto const& extraThresholds = accessor.getAttr<AttrType::extraThresholds>();
 
     stream << std::fixed;
     stream << std::setprecision(10);
-    stream << "#,Name,Start,End,Length" << '\n';
+    TextWriter writer(stream);
+    writer.write("#,Name,Start,End,Length\n");
 
     for(size_t i = 0; i < markers->size(); ++i)
     {
@@ -978,23 +1246,33 @@ juce::Result Track::Exporter::toReaper(Accessor const& accessor, Zoom::Range tim
             {
                 if(!applyExtraThresholds || Result::passThresholds(*it, extraThresholds))
                 {
+                    writer.write(isMarker ? 'M' : 'R');
+                    writer.writeInteger(index);
+                    writer.write(',');
+                    writer.writeEscaped(std::get<2_z>(*it));
+                    writer.write(',');
+                    writer.writeNumber(std::get<0_z>(*it));
                     if(isMarker)
                     {
-                        stream << 'M' << index << ',' << escapeString(std::get<2_z>(*it)) << ',' << std::get<0_z>(*it) << ",,\n";
+                        writer.write(",,\n");
                     }
                     else
                     {
-                        stream << 'R' << index << ',' << escapeString(std::get<2_z>(*it)) << ',' << std::get<0_z>(*it) << ',' << std::get<0_z>(*it) + std::get<1_z>(*it) << ',' << std::get<1_z>(*it) << '\n';
+                        writer.write(',');
+                        writer.writeNumber(std::get<0_z>(*it) + std::get<1_z>(*it));
+                        writer.write(',');
+                        writer.writeNumber(std::get<1_z>(*it));
+                        writer.write('\n');
                     }
                 }
                 ++it;
                 ++index;
             }
-            stream << '\n';
+            writer.write('\n');
         }
     }
 
-    if(!stream.good())
+    if(!writer.flush())
     {
         return failed(name, format, ErrorType::streamWritingFailure);
     }
@@ -1044,7 +1322,7 @@ juce::Result Track::Exporter::toReaper(Accessor const& accessor, Zoom::Range tim
     return juce::Result::ok();
 }
 
-juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, std::atomic<bool> const& shouldAbort)
+juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, bool compact, std::atomic<bool> const& shouldAbort)
 {
     auto const name = accessor.getAttr<AttrType::name>();
     auto constexpr format = "DAT";
@@ -1077,113 +1355,98 @@ juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range tim
         return aborted(name, format);
     }
 
-    auto const markers = results.getMarkers();
-    auto const points = results.getPoints();
-    auto const columns = results.getColumns();
-    if(markers != nullptr)
+    if(!Result::Binary::write(stream, results, timeRange, channels, compact, shouldAbort))
     {
-        stream.write("PTLM01", 6 * sizeof(char));
-        for(size_t i = 0; i < markers->size(); ++i)
-        {
-            if(channels.empty() || channels.count(i) > 0)
-            {
-                if(shouldAbort)
-                {
-                    return aborted(name, format);
-                }
+        return shouldAbort ? aborted(name, format) : failed(name, format, ErrorType::streamWritingFailure);
+    }
 
-                auto const& channelResults = markers->at(i);
-                auto const numChannels = static_cast<uint64_t>(channelResults.size());
-                stream.write(reinterpret_cast<char const*>(&numChannels), sizeof(numChannels));
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Marker>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    stream.write(reinterpret_cast<char const*>(&std::get<0_z>(*it)), sizeof(std::get<0_z>(*it)));
-                    stream.write(reinterpret_cast<char const*>(&std::get<1_z>(*it)), sizeof(std::get<1_z>(*it)));
-                    auto const length = static_cast<uint64_t>(std::get<2_z>(*it).size());
-                    stream.write(reinterpret_cast<char const*>(&length), sizeof(length));
-                    stream.write(std::get<2_z>(*it).c_str(), static_cast<long>(sizeof(char) * std::get<2_z>(*it).size()));
-                    auto const numExtra = static_cast<uint64_t>(std::get<3_z>(*it).size());
-                    stream.write(reinterpret_cast<char const*>(&numExtra), sizeof(numExtra));
-                    stream.write(reinterpret_cast<char const*>(std::get<3_z>(*it).data()), static_cast<long>(sizeof(*std::get<3_z>(*it).data()) * numExtra));
-                    ++it;
-                }
-            }
-        }
+    if(shouldAbort)
+    {
+        return aborted(name, format);
     }
-    else if(points != nullptr)
+
+    return juce::Result::ok();
+}
+
+juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool compact, std::atomic<bool> const& shouldAbort)
+{
+    auto const name = accessor.getAttr<AttrType::name>();
+    auto constexpr format = "DAT";
+
+    juce::TemporaryFile temp(file);
+    std::ofstream stream(temp.getFile().getFullPathName().toStdString(), std::ios::out | std::ios::binary);
+    if(!stream.is_open())
     {
-        stream.write("PTLP01", 6 * sizeof(char));
-        for(size_t i = 0; i < points->size(); ++i)
-        {
-            if(channels.empty() || channels.count(i) > 0)
-            {
-                if(shouldAbort)
-                {
-                    return aborted(name, format);
-                }
+        return failed(name, format, ErrorType::streamAccessFailure);
+    }
+    auto const result = toBinary(accessor, timeRange, channels, stream, compact, shouldAbort);
+    if(result.failed())
+    {
+        return result;
+    }
+    // This is important on Windows otherwise the temporary file cannot be copied
+    stream.close();
+    if(!temp.overwriteTargetFileWithTemporary())
+    {
+        return failed(name, format, ErrorType::fileAccessFailure, file);
+    }
+    return juce::Result::ok();
+}
 
-                auto const& channelResults = points->at(i);
-                auto const numChannels = static_cast<uint64_t>(channelResults.size());
-                stream.write(reinterpret_cast<char const*>(&numChannels), sizeof(numChannels));
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Point>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    stream.write(reinterpret_cast<char const*>(&std::get<0_z>(*it)), sizeof(std::get<0_z>(*it)));
-                    stream.write(reinterpret_cast<char const*>(&std::get<1_z>(*it)), sizeof(std::get<1_z>(*it)));
-                    auto const hasValue = std::get<2_z>(*it).has_value();
-                    stream.write(reinterpret_cast<char const*>(&hasValue), sizeof(hasValue));
-                    if(hasValue)
-                    {
-                        auto const& value = std::get<2_z>(*it).value();
-                        stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
-                    }
-                    auto const numExtra = static_cast<uint64_t>(std::get<3_z>(*it).size());
-                    stream.write(reinterpret_cast<char const*>(&numExtra), sizeof(numExtra));
-                    stream.write(reinterpret_cast<char const*>(std::get<3_z>(*it).data()), static_cast<long>(sizeof(*std::get<3_z>(*it).data()) * numExtra));
-                    ++it;
-                }
-            }
-        }
+juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::String& string, bool compact, std::atomic<bool> const& shouldAbort)
+{
+    std::ostringstream stream;
+    auto const result = toBinary(accessor, timeRange, channels, stream, compact, shouldAbort);
+    if(result.failed())
+    {
+        return result;
     }
-    else if(columns != nullptr)
+    string = stream.str();
+    return juce::Result::ok();
+}
+
+juce::Result Track::Exporter::toNpy(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort)
+{
+    auto const name = accessor.getAttr<AttrType::name>();
+    auto constexpr format = "NPY";
+
+    if(!static_cast<bool>(stream))
     {
-        stream.write("PTLC01", 6 * sizeof(char));
-        for(size_t i = 0; i < columns->size(); ++i)
-        {
-            if(channels.empty() || channels.count(i) > 0)
-            {
-                if(shouldAbort)
-                {
-                    return aborted(name, format);
-                }
+        return failed(name, format, ErrorType::streamAccessFailure);
+    }
 
-                auto const& channelResults = columns->at(i);
-                auto const numChannels = static_cast<uint64_t>(channelResults.size());
-                stream.write(reinterpret_cast<char const*>(&numChannels), sizeof(numChannels));
-                auto it = std::lower_bound(channelResults.cbegin(), channelResults.cend(), timeRange.getStart(), Result::lower_cmp<Results::Column>);
-                while(it != channelResults.cend() && std::get<0_z>(*it) <= timeRange.getEnd())
-                {
-                    MiscWeakAssert(std::get<0_z>(*it) >= timeRange.getStart());
-                    stream.write(reinterpret_cast<char const*>(&std::get<0_z>(*it)), sizeof(std::get<0_z>(*it)));
-                    stream.write(reinterpret_cast<char const*>(&std::get<1_z>(*it)), sizeof(std::get<1_z>(*it)));
-                    auto const numBins = static_cast<uint64_t>(std::get<2_z>(*it).size());
-                    stream.write(reinterpret_cast<char const*>(&numBins), sizeof(numBins));
-                    stream.write(reinterpret_cast<char const*>(std::get<2_z>(*it).data()), static_cast<long>(sizeof(*std::get<2_z>(*it).data()) * numBins));
-                    auto const numExtra = static_cast<uint64_t>(std::get<3_z>(*it).size());
-                    stream.write(reinterpret_cast<char const*>(&numExtra), sizeof(numExtra));
-                    stream.write(reinterpret_cast<char const*>(std::get<3_z>(*it).data()), static_cast<long>(sizeof(*std::get<3_z>(*it).data()) * numExtra));
-                    ++it;
-                }
-            }
-        }
+    auto const& results = accessor.getAttr<AttrType::results>();
+
+    if(timeRange.isEmpty())
+    {
+        timeRange = {-1.0, std::numeric_limits<double>::max()};
     }
 
-    if(!stream.good())
+    auto const access = results.getReadAccess();
+    if(!static_cast<bool>(access))
     {
-        return failed(name, format, ErrorType::streamWritingFailure);
+        return failed(name, format, ErrorType::dataLocked);
+    }
+
+    if(results.isEmpty())
+    {
+        return failed(name, format, ErrorType::dataInvalid);
+    }
+
+    if(results.getMarkers() != nullptr)
+    {
+        return failed(name, format, ErrorType::dataIncompatible);
+    }
+
+    if(shouldAbort)
+    {
+        return aborted(name, format);
+    }
+
+    auto const extraThresholds = applyExtraThresholds ? accessor.getAttr<AttrType::extraThresholds>() : std::vector<std::optional<float>>{};
+    if(!Result::Numpy::writeMatrix(stream, results, timeRange, channels, extraThresholds, shouldAbort))
+    {
+        return shouldAbort ? aborted(name, format) : failed(name, format, ErrorType::streamWritingFailure);
     }
 
     if(shouldAbort)
@@ -1194,18 +1457,18 @@ juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range tim
     return juce::Result::ok();
 }
 
-juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, std::atomic<bool> const& shouldAbort)
+juce::Result Track::Exporter::toNpy(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort)
 {
     auto const name = accessor.getAttr<AttrType::name>();
-    auto constexpr format = "DAT";
+    auto constexpr format = "NPY";
 
     juce::TemporaryFile temp(file);
-    std::ofstream stream(temp.getFile().getFullPathName().toStdString());
+    std::ofstream stream(temp.getFile().getFullPathName().toStdString(), std::ios::out | std::ios::binary);
     if(!stream.is_open())
     {
         return failed(name, format, ErrorType::streamAccessFailure);
     }
-    auto const result = toBinary(accessor, timeRange, channels, stream, shouldAbort);
+    auto const result = toNpy(accessor, timeRange, channels, stream, applyExtraThresholds, shouldAbort);
     if(result.failed())
     {
         return result;
@@ -1219,15 +1482,75 @@ juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range tim
     return juce::Result::ok();
 }
 
-juce::Result Track::Exporter::toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::String& string, std::atomic<bool> const& shouldAbort)
+juce::Result Track::Exporter::toNpz(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::OutputStream& stream, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort)
 {
-    std::ostringstream stream;
-    auto const result = toBinary(accessor, timeRange, channels, stream, shouldAbort);
-    if(result.failed())
+    auto const name = accessor.getAttr<AttrType::name>();
+    auto constexpr format = "NPZ";
+
+    auto const& results = accessor.getAttr<AttrType::results>();
+
+    if(timeRange.isEmpty())
     {
-        return result;
+        timeRange = {-1.0, std::numeric_limits<double>::max()};
+    }
+
+    auto const access = results.getReadAccess();
+    if(!static_cast<bool>(access))
+    {
+        return failed(name, format, ErrorType::dataLocked);
+    }
+
+    if(results.isEmpty())
+    {
+        return failed(name, format, ErrorType::dataInvalid);
+    }
+
+    if(results.getMarkers() != nullptr)
+    {
+        return failed(name, format, ErrorType::dataIncompatible);
+    }
+
+    if(shouldAbort)
+    {
+        return aborted(name, format);
+    }
+
+    auto const extraThresholds = applyExtraThresholds ? accessor.getAttr<AttrType::extraThresholds>() : std::vector<std::optional<float>>{};
+    if(!Result::Numpy::writeArchive(stream, results, timeRange, channels, extraThresholds, shouldAbort))
+    {
+        return shouldAbort ? aborted(name, format) : failed(name, format, ErrorType::streamWritingFailure);
+    }
+
+    if(shouldAbort)
+    {
+        return aborted(name, format);
+    }
+
+    return juce::Result::ok();
+}
+
+juce::Result Track::Exporter::toNpz(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort)
+{
+    auto const name = accessor.getAttr<AttrType::name>();
+    auto constexpr format = "NPZ";
+
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream stream(temp.getFile());
+        if(!stream.openedOk())
+        {
+            return failed(name, format, ErrorType::streamAccessFailure);
+        }
+        auto const result = toNpz(accessor, timeRange, channels, stream, applyExtraThresholds, shouldAbort);
+        if(result.failed())
+        {
+            return result;
+        }
+    }
+    if(!temp.overwriteTargetFileWithTemporary())
+    {
+        return failed(name, format, ErrorType::fileAccessFailure, file);
     }
-    string = stream.str();
     return juce::Result::ok();
 }
 
@@ -1308,7 +1631,7 @@ juce::File Track::Exporter::getConsolidatedFile(Accessor const& accessor, juce::
     return directory.getChildFile(fileName + ".dat");
 }
 
-juce::Result Track::Exporter::consolidateInDirectory(Accessor const& accessor, juce::File const& directory)
+juce::Result Track::Exporter::consolidateInDirectory(Accessor const& accessor, juce::File const& directory, bool compact)
 {
     auto const directoryResult = directory.createDirectory();
     if(directoryResult.failed())
@@ -1333,8 +1656,152 @@ juce::Result Track::Exporter::consolidateInDirectory(Accessor const& accessor, j
     else
     {
         std::atomic<bool> shouldAbort = false;
-        return toBinary(accessor, {}, {}, newFile, shouldAbort);
+        return toBinary(accessor, {}, {}, newFile, compact, shouldAbort);
     }
 }
 
+class TrackExporterUnitTest
+: public juce::UnitTest
+{
+public:
+    TrackExporterUnitTest()
+    : juce::UnitTest("Track", "Exporter")
+    {
+    }
+
+    ~TrackExporterUnitTest() override = default;
+
+    void runTest() override
+    {
+        // clang-format off
+        std::vector<double> const values
+        {
+              0.0, -0.0, 1.0, -2.5, 0.1 + 0.2, 1.0 / 3.0, 0.023219955, 78.026122449, 123456789.125, 1e-7, 1e21, 1e300, -1e-300, 4.9e-324
+            , std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::min()
+            , std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()
+        };
+        // clang-format on
+
+        beginTest("numbers");
+        {
+            for(auto const floatField : {std::ios::fmtflags{}, std::ios::fmtflags{std::ios::fixed}, std::ios::fmtflags{std::ios::scientific}})
+            {
+                for(auto const precision : {0, 1, 6, 10, 17})
+                {
+                    for(auto const value : values)
+                    {
+                        std::ostringstream expected;
+                        expected.setf(floatField, std::ios::floatfield);
+                        expected.precision(precision);
+                        expected << value;
+
+                        std::ostringstream stream;
+                        stream.setf(floatField, std::ios::floatfield);
+                        stream.precision(precision);
+                        {
+                            TextWriter writer(stream);
+                            writer.writeNumber(value);
+                        }
+                        expectEquals(juce::String(stream.str()), juce::String(expected.str()));
+                    }
+                }
+            }
+        }
+
+        beginTest("default numbers");
+        {
+            for(auto const value : values)
+            {
+                std::ostringstream expected;
+                expected << static_cast<float>(value);
+
+                std::ostringstream stream;
+                stream << std::fixed << std::setprecision(10);
+                {
+                    TextWriter writer(stream);
+                    writer.writeDefaultNumber(static_cast<float>(value));
+                }
+                expectEquals(juce::String(stream.str()), juce::String(expected.str()));
+            }
+        }
+
+        // The expected texts are the outputs of the stream operators used before the text writer
+        std::atomic<bool> shouldAbort{false};
+        Track::Accessor markerAccessor;
+        // clang-format off
+        markerAccessor.setAttr<Track::AttrType::results>(Track::Results(std::vector<Track::Results::Markers>
+        {
+              {{0.023219955, 0.0, "N", {}}, {1.0235827664399093, 0.5, "B7/D#", {}}}
+            , {{78.026122449, 1e-7, "A\tB", {}}}
+        }), NotificationType::synchronous);
+        // clang-format on
+
+        beginTest("csv");
+        {
+            std::ostringstream stream;
+            auto const result = Track::Exporter::toCsv(markerAccessor, {}, {}, stream, Track::Exporter::CsvHeaderType::none, ',', false, false, "\n", false, false, shouldAbort);
+            expect(result.wasOk(), result.getErrorMessage());
+            expectEquals(juce::String(stream.str()), juce::String("0.02322,0,\"N\"\n1.02358,0.5,\"B7/D#\"\n\n78.0261,1e-07,\"A\\tB\"\n"));
+        }
+
+        beginTest("lab");
+        {
+            std::ostringstream stream;
+            auto const result = Track::Exporter::toCsv(markerAccessor, {}, {}, stream, Track::Exporter::CsvHeaderType::none, '\t', true, false, "\n", false, false, shouldAbort);
+            expect(result.wasOk(), result.getErrorMessage());
+            expectEquals(juce::String(stream.str()), juce::String("0.02322\t0.02322\t\"N\"\n1.02358\t1.52358\t\"B7/D#\"\n\n78.0261\t78.0261\t\"A\\tB\"\n"));
+        }
+
+        beginTest("cue");
+        {
+            std::ostringstream stream;
+            auto const result = Track::Exporter::toCue(markerAccessor, {}, {}, stream, false, shouldAbort);
+            expect(result.wasOk(), result.getErrorMessage());
+            expectEquals(juce::String(stream.str()), juce::String("TITLE CHANNEL_00\n  TRACK 00 AUDIO \n    TITLE \"N\"\n    INDEX 01 00:00:02\n  TRACK 01 AUDIO \n    TITLE \"B7/D#\"\n    INDEX 01 00:01:02\nTITLE CHANNEL_01\n  TRACK 00 AUDIO \n    TITLE \"A\tB\"\n    INDEX 01 01:18:02\n"));
+        }
+
+        beginTest("csv values");
+        {
+            Track::Accessor columnAccessor;
+            // clang-format off
+            columnAccessor.setAttr<Track::AttrType::results>(Track::Results(std::vector<Track::Results::Columns>
+            {
+                {{0.1 + 0.2, 1e-7, {0.1f, -2.5f, 1e-7f}, {}}, {123456789.125, 0.0, {123456789.0f, 1.0f / 3.0f, -0.0f}, {}}}
+            }), NotificationType::synchronous);
+            // clang-format on
+
+            std::ostringstream stream;
+            auto const result = Track::Exporter::toCsv(columnAccessor, {}, {}, stream, Track::Exporter::CsvHeaderType::none, ',', false, false, "\n", false, false, shouldAbort);
+            expect(result.wasOk(), result.getErrorMessage());
+            expectEquals(juce::String(stream.str()), juce::String("0.3,1e-07,0.1,-2.5,1e-07\n1.23457e+08,0,1.23457e+08,0.333333,-0\n"));
+        }
+
+        beginTest("consolidate compact");
+        {
+            auto const directory = juce::File::getSpecialLocation(juce::File::SpecialLocationType::tempDirectory).getNonexistentChildFile("TrackExporterUnitTest", "");
+            Track::FileInfo fileInfo;
+            fileInfo.commit = "commit";
+            markerAccessor.setAttr<Track::AttrType::identifier>("markers", NotificationType::synchronous);
+            markerAccessor.setAttr<Track::AttrType::file>(fileInfo, NotificationType::synchronous);
+            auto const result = Track::Exporter::consolidateInDirectory(markerAccessor, directory, true);
+            expect(result.wasOk(), result.getErrorMessage());
+
+            auto const file = Track::Exporter::getConsolidatedFile(markerAccessor, directory);
+            expect(file.existsAsFile());
+            juce::MemoryBlock block;
+            expect(file.loadFileAsData(block));
+            expectEquals(block.toString().substring(0, 6), juce::String("PTLM03"));
+
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = Track::Loader::loadFromBinary(Track::FileDescription{file}, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            auto const* results = std::get_if<Track::Results>(&vResult);
+            expect(results != nullptr && results->matchWithEpsilon(markerAccessor.getAttr<Track::AttrType::results>(), 1e-9, 1e-6f));
+            expect(directory.deleteRecursively());
+        }
+    }
+};
+
+static TrackExporterUnitTest trackExporterUnitTest;
+
 ANALYSE_FILE_END
@@ -17,6 +17,7 @@ namespace Track
 
         juce::Result toGraphicPreset(Accessor const& accessor, juce::File const& file);
 
+        std::unique_ptr<juce::ImageFileFormat> createImageFormat(juce::File const& file, int width, int height, int scaledWidth, int scaledHeight);
         juce::Image toImage(Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, int width, int height, int scaledWidth, int scaledHeight, Zoom::Grid::Justification outsideGridjustification);
         juce::Result toImage(Accessor const& accessor, Zoom::Accessor const& timeZoomAccessor, std::set<size_t> const& channels, juce::File const& file, int width, int height, int scaledWidth, int scaledHeight, Zoom::Grid::Justification outsideGridjustification, std::atomic<bool> const& shouldAbort);
 
@@ -38,14 +39,20 @@ namespace Track
         juce::Result toReaper(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool isMarker, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
         juce::Result toReaper(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::String& string, bool isMarker, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
 
-        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, std::atomic<bool> const& shouldAbort);
-        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, std::atomic<bool> const& shouldAbort);
-        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::String& string, std::atomic<bool> const& shouldAbort);
+        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, bool compact, std::atomic<bool> const& shouldAbort);
+        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool compact, std::atomic<bool> const& shouldAbort);
+        juce::Result toBinary(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::String& string, bool compact, std::atomic<bool> const& shouldAbort);
+
+        juce::Result toNpy(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, std::ostream& stream, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
+        juce::Result toNpy(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
+
+        juce::Result toNpz(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::OutputStream& stream, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
+        juce::Result toNpz(Accessor const& accessor, Zoom::Range timeRange, std::set<size_t> const& channels, juce::File const& file, bool applyExtraThresholds, std::atomic<bool> const& shouldAbort);
 
         juce::Result toSdif(Accessor const& accessor, Zoom::Range timeRange, juce::File const& file, uint32_t frameId, uint32_t matrixId, std::optional<juce::String> columnName, std::atomic<bool> const& shouldAbort);
 
         juce::File getConsolidatedFile(Accessor const& accessor, juce::File const& directory);
-        juce::Result consolidateInDirectory(Accessor const& accessor, juce::File const& directory);
+        juce::Result consolidateInDirectory(Accessor const& accessor, juce::File const& directory, bool compact);
     } // namespace Exporter
 } // namespace Track
 
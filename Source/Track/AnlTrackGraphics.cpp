@@ -4,6 +4,11 @@
 
 ANALYSE_FILE_BEGIN
 
+Track::Graphics::Graphics(Profiler& profiler)
+: mProfiler(profiler)
+{
+}
+
 Track::Graphics::~Graphics()
 {
     std::unique_lock<std::mutex> lock(mRenderingMutex);
@@ -93,6 +98,7 @@ bool Track::Graphics::runRendering(Accessor const& accessor, std::unique_ptr<Ive
     mRenderingProcess = std::thread([this, columns, plug = std::move(plugin), colourMap, info]()
                                     {
                                         juce::Thread::setCurrentThreadName("Track::Graphics::Process");
+                                        Profiler::ScopedStage const scopedStage(mProfiler, Profiler::Stage::rendering);
                                         performRendering(*columns, colourMap, info);
                                     });
     return hasPluginColorMap;
@@ -110,6 +116,7 @@ float Track::Graphics::getAdvancement() const
 
 void Track::Graphics::handleAsyncUpdate()
 {
+    Tracer::ScopedEvent const scopedEvent("Track::Graphics::handleAsyncUpdate", "notification");
     std::unique_lock<std::mutex> lock(mRenderingMutex);
     if(mRenderingProcess.joinable())
     {
@@ -177,6 +184,7 @@ void Track::Graphics::abortRendering()
 
 void Track::Graphics::performRendering(std::vector<Track::Result::Data::Columns> const& columns, ColourMap const colourMap, DrawInfo const& info)
 {
+    Tracer::ScopedEvent const scopedEvent("Track::Graphics::performRendering", "rendering");
     mAdvancement.store(0.0f);
     auto expected = ProcessState::available;
     if(!mRenderingState.compare_exchange_weak(expected, ProcessState::running))
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AnlTrackModel.h"
+#include "AnlTrackProfiler.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -10,7 +11,7 @@ namespace Track
     : private juce::AsyncUpdater
     {
     public:
-        Graphics() = default;
+        explicit Graphics(Profiler& profiler);
         ~Graphics() override;
 
         bool runRendering(Accessor const& accessor, std::unique_ptr<Ive::PluginWrapper> plugin);
@@ -52,6 +53,7 @@ namespace Track
         };
         // clang-format on
 
+        Profiler& mProfiler;
         std::mutex mMutex;
         Graph mGraph;
         Result::Data mData;
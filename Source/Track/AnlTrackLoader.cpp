@@ -1,83 +1,901 @@
 #include "AnlTrackLoader.h"
+#include "AnlTrackExporter.h"
 #include "AnlTrackTools.h"
+#include "Result/AnlTrackResultBinary.h"
+#include "Result/AnlTrackResultNumpy.h"
 #include <TestResultsData.h>
+#include <charconv>
 #include <regex>
 
-#if JUCE_GCC
-#define ANL_ATTR_UNUSED __attribute__((unused))
-#else
-#define ANL_ATTR_UNUSED
-#endif
-
 ANALYSE_FILE_BEGIN
 
 namespace
 {
-    template <class T>
-    class StopableStreamIterator
+    // Builds the results directly from the SAX events of the JSON parser, without creating the JSON document
+    class JsonResultsParser
+    : public nlohmann::json_sax<nlohmann::json>
     {
     public:
-        typedef char value_type ANL_ATTR_UNUSED;
-        typedef ptrdiff_t difference_type ANL_ATTR_UNUSED;
-        typedef const char* pointer ANL_ATTR_UNUSED;
-        typedef const char& reference ANL_ATTR_UNUSED;
-        typedef std::input_iterator_tag iterator_category ANL_ATTR_UNUSED;
+        JsonResultsParser(std::istream& stream, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+        : mStream(stream)
+        , mShouldAbort(shouldAbort)
+        , mAdvancement(advancement)
+        {
+        }
+
+        ~JsonResultsParser() override = default;
+
+        std::variant<Track::Results, juce::String> parse()
+        {
+            mStreamStart = static_cast<std::streamoff>(mStream.tellg());
+            if(mStreamStart >= 0 && mStream.seekg(0, std::ios::end))
+            {
+                mStreamSize = static_cast<std::streamoff>(mStream.tellg()) - mStreamStart;
+                mStream.seekg(mStreamStart, std::ios::beg);
+            }
+            mStream.clear();
+
+            auto succeeded = false;
+            try
+            {
+                succeeded = nlohmann::json::sax_parse(mStream, this);
+            }
+            catch(nlohmann::json::exception& e)
+            {
+                return {juce::translate(e.what())};
+            }
+            if(mShouldAbort)
+            {
+                return {};
+            }
+            if(!succeeded)
+            {
+                return {mError.isEmpty() ? juce::translate("Parsing error: invalid JSON format") : mError};
+            }
+
+            mAdvancement.store(1.0f);
+            switch(mMode)
+            {
+                case Mode::undefined:
+                    break;
+                case Mode::marker:
+                    return Track::Results(std::move(mMarkers));
+                case Mode::point:
+                    return Track::Results(std::move(mPoints));
+                case Mode::column:
+                    return Track::Results(std::move(mColumns));
+            }
+            return {juce::translate("Parsing error: couldn't determine the type of results")};
+        }
+
+        bool null() override
+        {
+            if(mContexts.empty())
+            {
+                return true;
+            }
+            // The non-finite numbers are exported as null so the bins and the extras keep their positions
+            switch(mContexts.back())
+            {
+                case Context::values:
+                    mFrame.values.push_back(std::numeric_limits<float>::quiet_NaN());
+                    return true;
+                case Context::extra:
+                    mFrame.extra.push_back(std::numeric_limits<float>::quiet_NaN());
+                    return true;
+                case Context::frame:
+                    if(mKey == Key::value)
+                    {
+                        mFrame.hasValue = true;
+                        mFrame.value.reset();
+                    }
+                    return true;
+                case Context::ignored:
+                case Context::document:
+                case Context::results:
+                case Context::channel:
+                    return true;
+            }
+            return true;
+        }
+
+        bool boolean(bool) override
+        {
+            return !isInFrame() || mKey == Key::other || fail(juce::translate("Parsing error: the result frame contains an invalid value"));
+        }
+
+        bool number_integer(number_integer_t value) override
+        {
+            return number(static_cast<double>(value));
+        }
+
+        bool number_unsigned(number_unsigned_t value) override
+        {
+            return number(static_cast<double>(value));
+        }
 
-        StopableStreamIterator(T const& s)
-        : shouldAbort(s)
+        bool number_float(number_float_t value, string_t const&) override
         {
+            return number(static_cast<double>(value));
+        }
+
+        bool string(string_t& value) override
+        {
+            if(mContexts.empty() || mContexts.back() != Context::frame)
+            {
+                return !isInFrame() || fail(juce::translate("Parsing error: the result frame contains an invalid value"));
+            }
+            if(mKey == Key::label)
+            {
+                mFrame.hasLabel = true;
+                mFrame.label = std::move(value);
+                return true;
+            }
+            return mKey == Key::other || fail(juce::translate("Parsing error: the result frame contains an invalid value"));
+        }
+
+        bool binary(binary_t&) override
+        {
+            return true;
+        }
+
+        bool start_object(std::size_t) override
+        {
+            if(mShouldAbort)
+            {
+                return false;
+            }
+            if(mContexts.empty())
+            {
+                mContexts.push_back(Context::document);
+            }
+            else if(mContexts.back() == Context::channel)
+            {
+                mContexts.push_back(Context::frame);
+                mKey = Key::other;
+            }
+            else if(mContexts.back() == Context::results)
+            {
+                return fail(juce::translate("Parsing error: the results must be an array of channels"));
+            }
+            else
+            {
+                mContexts.push_back(Context::ignored);
+            }
+            return true;
+        }
+
+        bool key(string_t& value) override
+        {
+            if(mContexts.back() == Context::document)
+            {
+                mIsResultsKey = value == "results";
+            }
+            else if(mContexts.back() == Context::frame)
+            {
+                mKey = getKey(value);
+            }
+            return true;
+        }
+
+        bool end_object() override
+        {
+            auto const context = mContexts.back();
+            mContexts.pop_back();
+            return context != Context::frame || addFrame();
+        }
+
+        bool start_array(std::size_t) override
+        {
+            if(mShouldAbort)
+            {
+                return false;
+            }
+            if(mContexts.empty() || (mContexts.back() == Context::document && mIsResultsKey))
+            {
+                mContexts.push_back(Context::results);
+            }
+            else if(mContexts.back() == Context::results)
+            {
+                mContexts.push_back(Context::channel);
+                mMarkers.emplace_back();
+                mPoints.emplace_back();
+                mColumns.emplace_back();
+            }
+            else if(mContexts.back() == Context::frame && mKey == Key::values)
+            {
+                mContexts.push_back(Context::values);
+                mFrame.hasValues = true;
+            }
+            else if(mContexts.back() == Context::frame && mKey == Key::extra)
+            {
+                mContexts.push_back(Context::extra);
+            }
+            else if(mContexts.back() == Context::channel)
+            {
+                return fail(juce::translate("Parsing error: the result frame doesn't contain the time value"));
+            }
+            else if(mContexts.back() == Context::frame && mKey != Key::other)
+            {
+                return fail(juce::translate("Parsing error: the result frame contains an invalid value"));
+            }
+            else
+            {
+                mContexts.push_back(Context::ignored);
+            }
+            return true;
+        }
+
+        bool end_array() override
+        {
+            mContexts.pop_back();
+            return !mShouldAbort;
+        }
+
+        bool parse_error(std::size_t, std::string const&, nlohmann::detail::exception const& ex) override
+        {
+            return fail(juce::translate(ex.what()));
+        }
+
+    private:
+        // clang-format off
+        enum class Mode
+        {
+              undefined
+            , marker
+            , point
+            , column
+        };
+
+        enum class Context
+        {
+              ignored
+            , document
+            , results
+            , channel
+            , frame
+            , values
+            , extra
+        };
+
+        enum class Key
+        {
+              other
+            , time
+            , duration
+            , label
+            , value
+            , values
+            , extra
+        };
+        // clang-format on
+
+        struct Frame
+        {
+            bool hasTime{false};
+            double time{0.0};
+            double duration{0.0};
+            bool hasLabel{false};
+            std::string label;
+            bool hasValue{false};
+            std::optional<float> value;
+            bool hasValues{false};
+            std::vector<float> values;
+            std::vector<float> extra;
+        };
+
+        static Key getKey(std::string const& name)
+        {
+            if(name == "time")
+            {
+                return Key::time;
+            }
+            if(name == "duration")
+            {
+                return Key::duration;
+            }
+            if(name == "label")
+            {
+                return Key::label;
+            }
+            if(name == "value")
+            {
+                return Key::value;
+            }
+            if(name == "values")
+            {
+                return Key::values;
+            }
+            if(name == "extra")
+            {
+                return Key::extra;
+            }
+            return Key::other;
+        }
+
+        bool isInFrame() const
+        {
+            return !mContexts.empty() && (mContexts.back() == Context::frame || mContexts.back() == Context::values || mContexts.back() == Context::extra || mContexts.back() == Context::channel);
+        }
+
+        bool fail(juce::String const& error)
+        {
+            mError = error;
+            return false;
+        }
+
+        bool number(double value)
+        {
+            if(mContexts.empty())
+            {
+                return true;
+            }
+            switch(mContexts.back())
+            {
+                case Context::ignored:
+                case Context::document:
+                    return true;
+                case Context::results:
+                    return fail(juce::translate("Parsing error: the results must be an array of channels"));
+                case Context::channel:
+                    return fail(juce::translate("Parsing error: the result frame doesn't contain the time value"));
+                case Context::values:
+                    mFrame.values.push_back(static_cast<float>(value));
+                    return true;
+                case Context::extra:
+                    mFrame.extra.push_back(static_cast<float>(value));
+                    return true;
+                case Context::frame:
+                    break;
+            }
+            switch(mKey)
+            {
+                case Key::other:
+                    return true;
+                case Key::time:
+                    mFrame.hasTime = true;
+                    mFrame.time = value;
+                    return true;
+                case Key::duration:
+                    mFrame.duration = value;
+                    return true;
+                case Key::value:
+                    mFrame.hasValue = true;
+                    mFrame.value = static_cast<float>(value);
+                    return true;
+                case Key::label:
+                case Key::values:
+                case Key::extra:
+                    break;
+            }
+            return fail(juce::translate("Parsing error: the result frame contains an invalid value"));
+        }
+
+        bool checkAndSet(Mode const expected)
+        {
+            if(mMode == Mode::undefined || mMode == expected)
+            {
+                mMode = expected;
+                return true;
+            }
+            return fail(juce::translate("Parsing error: the type of results is not consistent - expected EXPECTTYPE, but got CURRENTTYPE").replace("EXPECTTYPE", std::string(magic_enum::enum_name(expected))).replace("CURRENTTYPE", std::string(magic_enum::enum_name(mMode))));
+        }
+
+        bool addFrame()
+        {
+            auto frame = std::exchange(mFrame, {});
+            if(!frame.hasTime)
+            {
+                return fail(juce::translate("Parsing error: the result frame doesn't contain the time value"));
+            }
+            if(frame.hasLabel || mMode == Mode::marker || (mMode == Mode::undefined && !frame.hasValue && !frame.hasValues))
+            {
+                if(!checkAndSet(Mode::marker))
+                {
+                    return false;
+                }
+                mMarkers.back().push_back({frame.time, frame.duration, std::move(frame.label), std::move(frame.extra)});
+            }
+            else if(frame.hasValue || mMode == Mode::point)
+            {
+                if(!checkAndSet(Mode::point))
+                {
+                    return false;
+                }
+                mPoints.back().push_back({frame.time, frame.duration, frame.value, std::move(frame.extra)});
+            }
+            else if(frame.hasValues || mMode == Mode::column)
+            {
+                if(!checkAndSet(Mode::column))
+                {
+                    return false;
+                }
+                mColumns.back().push_back({frame.time, frame.duration, std::move(frame.values), std::move(frame.extra)});
+            }
+
+            if(mStreamSize > 0 && ++mNumFrames % 1024_z == 0_z)
+            {
+                auto const position = static_cast<std::streamoff>(mStream.rdbuf()->pubseekoff(0, std::ios::cur, std::ios::in));
+                if(position >= mStreamStart)
+                {
+                    mAdvancement.store(std::min(static_cast<float>(position - mStreamStart) / static_cast<float>(mStreamSize), 1.0f));
+                }
+            }
+            return !mShouldAbort;
+        }
+
+        std::istream& mStream;
+        std::atomic<bool> const& mShouldAbort;
+        std::atomic<float>& mAdvancement;
+        std::streamoff mStreamStart{0};
+        std::streamoff mStreamSize{0};
+        size_t mNumFrames{0_z};
+        juce::String mError;
+
+        std::vector<Context> mContexts;
+        bool mIsResultsKey{false};
+        Key mKey{Key::other};
+        Frame mFrame;
+        Mode mMode{Mode::undefined};
+        std::vector<Track::Results::Markers> mMarkers;
+        std::vector<Track::Results::Points> mPoints;
+        std::vector<Track::Results::Columns> mColumns;
+    };
+
+    // Parses the CSV, LAB, PureData and Max results from a buffer. The lines and the fields are split in
+    // place and the numbers are converted directly from the fields. A parser can be fed successive parts of a
+    // file as long as they end on a line boundary, and the parts of a large file can be parsed by several
+    // parsers concurrently before being appended to the first one.
+    class CsvResultsParser
+    {
+    public:
+        // clang-format off
+        enum class Mode
+        {
+              undefined
+            , marker
+            , point
+        };
+        // clang-format on
+
+        CsvResultsParser(char separator, bool useEndTime, char lineBreakSeparator, bool prependLineIndex, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement, std::atomic<size_t>& position, size_t size)
+        : mSeparator(separator)
+        , mUseEndTime(useEndTime)
+        , mLineBreakSeparator(lineBreakSeparator)
+        , mPrependLineIndex(prependLineIndex)
+        , mShouldAbort(shouldAbort)
+        , mAdvancement(advancement)
+        , mPosition(position)
+        , mSize(size)
+        {
+        }
+
+        // Continues the last channel of the previous part instead of starting a new channel with the first line
+        void continueChannel()
+        {
+            mAddNewChannel = false;
+            mContinuesChannel = true;
+            mMarkers.push_back({});
+            mPoints.push_back({});
+        }
+
+        void setMode(Mode mode)
+        {
+            mMode = mode;
+        }
+
+        bool parse(std::string_view data)
+        {
+            auto position = 0_z;
+            auto lastPosition = 0_z;
+            auto numLines = 0_z;
+            while(position < data.size())
+            {
+                if(mShouldAbort)
+                {
+                    return false;
+                }
+                if(!parseLine(getNextLine(data, position)))
+                {
+                    return false;
+                }
+                if(mSize > 0_z && ++numLines % 4096_z == 0_z)
+                {
+                    auto const processed = mPosition.fetch_add(position - lastPosition) + position - lastPosition;
+                    mAdvancement.store(std::min(static_cast<float>(processed) / static_cast<float>(mSize), 1.0f));
+                    lastPosition = position;
+                }
+            }
+            mPosition.fetch_add(position - lastPosition);
+            return true;
+        }
+
+        // Appends the results of a parser that parsed the following part of the file
+        void append(CsvResultsParser& next)
+        {
+            if(!mError.isEmpty())
+            {
+                return;
+            }
+            if(!next.mError.isEmpty())
+            {
+                mError = next.mError;
+                return;
+            }
+            if(mMode == Mode::undefined)
+            {
+                mMode = next.mMode;
+            }
+            auto channelIndex = 0_z;
+            if(next.mContinuesChannel && !mMarkers.empty())
+            {
+                auto& markers = next.mMarkers.front();
+                mMarkers.back().insert(mMarkers.back().end(), std::make_move_iterator(markers.begin()), std::make_move_iterator(markers.end()));
+                auto& points = next.mPoints.front();
+                mPoints.back().insert(mPoints.back().end(), std::make_move_iterator(points.begin()), std::make_move_iterator(points.end()));
+                channelIndex = 1_z;
+            }
+            for(; channelIndex < next.mMarkers.size(); ++channelIndex)
+            {
+                mMarkers.push_back(std::move(next.mMarkers[channelIndex]));
+                mPoints.push_back(std::move(next.mPoints[channelIndex]));
+            }
+        }
+
+        std::variant<Track::Results, juce::String> getResults()
+        {
+            if(mShouldAbort)
+            {
+                return {};
+            }
+            if(!mError.isEmpty())
+            {
+                return {mError};
+            }
+            mAdvancement.store(1.0f);
+            switch(mMode)
+            {
+                case Mode::undefined:
+                    break;
+                case Mode::marker:
+                    return Track::Results(std::move(mMarkers));
+                case Mode::point:
+                    return Track::Results(std::move(mPoints));
+            }
+            return {juce::translate("Parsing error - unknown mode")};
+        }
+
+        // Gets the trimmed line that starts at the position and moves the position after the line break
+        std::string_view getNextLine(std::string_view data, size_t& position) const
+        {
+            auto const end = std::min(data.find(mLineBreakSeparator, position), data.size());
+            auto line = trim(data.substr(position, end - position));
+            position = end + 1_z;
+            if(mPrependLineIndex)
+            {
+                auto const index = line.find(',');
+                if(index != std::string_view::npos)
+                {
+                    line = trim(line.substr(index + 1_z));
+                }
+            }
+            return line;
+        }
+
+        // Gets the mode defined by the first line with a time and a duration
+        Mode findMode(std::string_view data) const
+        {
+            auto position = 0_z;
+            while(position < data.size())
+            {
+                if(mShouldAbort)
+                {
+                    return Mode::undefined;
+                }
+                auto const line = getNextLine(data, position);
+                if(!line.empty())
+                {
+                    auto fieldPosition = 0_z;
+                    auto const time = getNextField(line, fieldPosition);
+                    auto const duration = getNextField(line, fieldPosition);
+                    auto const value = getNextField(line, fieldPosition);
+                    if(time.empty() || duration.empty())
+                    {
+                        return Mode::undefined;
+                    }
+                    if(isDigit(time.front()) && isDigit(duration.front()))
+                    {
+                        return getFloatValue(value).has_value() ? Mode::point : Mode::marker;
+                    }
+                }
+            }
+            return Mode::undefined;
+        }
+
+    private:
+        static bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        static std::string_view trim(std::string_view s)
+        {
+            auto const start = s.find_first_not_of(" \n\r\t\f\v");
+            if(start == std::string_view::npos)
+            {
+                return {};
+            }
+            auto const end = s.find_last_not_of(" \n\r\t\f\v");
+            return s.substr(start, end + 1_z - start);
+        }
+
+        // Gets the field that starts at the position and moves the position after the separator
+        std::string_view getNextField(std::string_view line, size_t& position) const
+        {
+            if(position >= line.size())
+            {
+                return {};
+            }
+            auto const end = std::min(line.find(mSeparator, position), line.size());
+            auto const field = line.substr(position, end - position);
+            position = end + 1_z;
+            return field;
+        }
+
+        // Skips the leading white spaces and the plus sign like std::stod and std::stof. The floating-point
+        // std::from_chars is not available with the oldest macOS deployment targets so the floating-point numbers
+        // are converted with std::strtod and std::strtof (the application never changes the C locale).
+        template <typename T>
+        static std::optional<T> getNumber(std::string_view field)
+        {
+            if constexpr(std::is_integral_v<T>)
+            {
+                auto const* first = field.data();
+                auto const* last = field.data() + field.size();
+                while(first != last && std::isspace(static_cast<unsigned char>(*first)))
+                {
+                    ++first;
+                }
+                if(std::distance(first, last) > 1 && *first == '+' && *std::next(first) != '-' && *std::next(first) != '+')
+                {
+                    ++first;
+                }
+                T value;
+                auto const result = std::from_chars(first, last, value);
+                if(result.ec != std::errc())
+                {
+                    return {};
+                }
+                return value;
+            }
+            else
+            {
+                // The fields are not null-terminated, the short fields are copied on the stack
+                std::array<char, 64_z> buffer;
+                std::string string;
+                char const* text = buffer.data();
+                if(field.size() < buffer.size())
+                {
+                    std::copy(field.cbegin(), field.cend(), buffer.begin());
+                    buffer[field.size()] = '\0';
+                }
+                else
+                {
+                    string.assign(field);
+                    text = string.c_str();
+                }
+                char* end = nullptr;
+                errno = 0;
+                T value;
+                if constexpr(std::is_same_v<T, float>)
+                {
+                    value = std::strtof(text, &end);
+                }
+                else
+                {
+                    value = static_cast<T>(std::strtod(text, &end));
+                }
+                if(end == text || errno == ERANGE)
+                {
+                    return {};
+                }
+                return value;
+            }
+        }
+
+        static std::optional<float> getFloatValue(std::string_view field)
+        {
+            auto const value = getNumber<float>(field);
+            if(!value.has_value() || std::isnan(value.value()) || !std::isfinite(value.value()))
+            {
+                return {};
+            }
+            return value;
+        }
+
+        // Unescapes the quotes, the tabulations and the line breaks in a single pass
+        static std::string getLabel(std::string_view field)
+        {
+            std::string label;
+            label.reserve(field.size());
+            for(auto index = 0_z; index < field.size(); ++index)
+            {
+                auto const c = field[index];
+                if(c == '\\' && index + 1_z < field.size())
+                {
+                    auto const next = field[index + 1_z];
+                    auto const escaped = next == 't' ? '\t' : next == 'r' ? '\r' : next == 'n' ? '\n' : next == '"' || next == '\'' ? next : '\0';
+                    if(escaped != '\0')
+                    {
+                        label.push_back(escaped);
+                        ++index;
+                        continue;
+                    }
+                }
+                label.push_back(c);
+            }
+            if(label.find_first_of("\"\'") != std::string::npos)
+            {
+                return juce::String(label).unquoted().toStdString();
+            }
+            return label;
+        }
+
+        bool fail(juce::String const& error)
+        {
+            mError = error;
+            return false;
+        }
+
+        bool parseLine(std::string_view line)
+        {
+            if(line.empty())
+            {
+                mAddNewChannel = true;
+                return true;
+            }
+            if(std::exchange(mAddNewChannel, false))
+            {
+                mMarkers.push_back({});
+                mPoints.push_back({});
+            }
+
+            auto position = 0_z;
+            auto const time = getNextField(line, position);
+            auto const duration = getNextField(line, position);
+            auto const value = getNextField(line, position);
+            if(time.empty() || duration.empty())
+            {
+                return fail(juce::translate("Parsing error - time and duration"));
+            }
+            if(!isDigit(time.front()) || !isDigit(duration.front()))
+            {
+                return true;
+            }
+
+            auto const timeValue = getNumber<double>(time);
+            auto const durationValue = getNumber<double>(duration);
+            if(!timeValue.has_value() || !durationValue.has_value())
+            {
+                return fail(juce::translate("Parsing error - time and duration"));
+            }
+            auto const frameTime = timeValue.value();
+            auto const frameDuration = std::max(mUseEndTime ? durationValue.value() - frameTime : durationValue.value(), 0.0);
+            auto const pointValue = mMode == Mode::marker ? std::optional<float>{} : getFloatValue(value);
+            std::vector<float> extra;
+            while(position < line.size())
+            {
+                auto const extraValue = getFloatValue(getNextField(line, position));
+                if(extraValue.has_value())
+                {
+                    extra.push_back(extraValue.value());
+                }
+            }
+            if(pointValue.has_value())
+            {
+                mMode = Mode::point;
+                mPoints.back().push_back({frameTime, frameDuration, pointValue, std::move(extra)});
+            }
+            else
+            {
+                if(mMode == Mode::point)
+                {
+                    return fail(juce::translate("Parsing error - mode"));
+                }
+                mMode = Mode::marker;
+                mMarkers.back().push_back({frameTime, frameDuration, getLabel(value), std::move(extra)});
+            }
+            return true;
         }
 
-        StopableStreamIterator(std::istream& i, T const& s)
-        : iterator(i)
-        , shouldAbort(s)
-        {
-        }
+        char const mSeparator;
+        bool const mUseEndTime;
+        char const mLineBreakSeparator;
+        bool const mPrependLineIndex;
+        std::atomic<bool> const& mShouldAbort;
+        std::atomic<float>& mAdvancement;
+        std::atomic<size_t>& mPosition;
+        size_t const mSize;
+
+        Mode mMode{Mode::undefined};
+        bool mAddNewChannel{true};
+        bool mContinuesChannel{false};
+        juce::String mError;
+        std::vector<Track::Results::Markers> mMarkers;
+        std::vector<Track::Results::Points> mPoints;
+    };
 
-        StopableStreamIterator(StopableStreamIterator const& x)
-        : iterator(x.iterator)
-        , shouldAbort(x.shouldAbort)
-        {
+    // Splits large buffers on line boundaries and parses the parts concurrently, the mode is defined
+    // beforehand by the first line with a time and a duration so all the parts interpret the lines the
+    // same way as a sequential parsing would.
+    std::variant<Track::Results, juce::String> parseCsvResults(std::string_view data, char separator, bool useEndTime, char lineBreakSeparator, bool prependLineIndex, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+    {
+        static auto constexpr minPartSize = 4_z * 1024_z * 1024_z;
+        std::atomic<size_t> position{0_z};
+        auto const numParts = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), data.size() / minPartSize);
+        std::vector<size_t> boundaries{0_z};
+        for(auto partIndex = 1_z; partIndex < numParts; ++partIndex)
+        {
+            auto const boundary = data.find(lineBreakSeparator, partIndex * data.size() / numParts);
+            if(boundary == std::string_view::npos)
+            {
+                break;
+            }
+            if(boundary + 1_z > boundaries.back() && boundary + 1_z < data.size())
+            {
+                boundaries.push_back(boundary + 1_z);
+            }
         }
+        boundaries.push_back(data.size());
 
-        ~StopableStreamIterator() = default;
-
-        inline const char& operator*() const
+        std::vector<CsvResultsParser> parsers;
+        parsers.reserve(boundaries.size() - 1_z);
+        for(auto partIndex = 0_z; partIndex < boundaries.size() - 1_z; ++partIndex)
         {
-            return iterator.operator*();
+            parsers.emplace_back(separator, useEndTime, lineBreakSeparator, prependLineIndex, shouldAbort, advancement, position, data.size());
         }
-
-        inline const char* operator->() const
+        if(parsers.size() == 1_z)
         {
-            return iterator.operator->();
+            parsers.front().parse(data);
+            return parsers.front().getResults();
         }
 
-        inline StopableStreamIterator& operator++()
+        auto const mode = parsers.front().findMode(data);
+        for(auto partIndex = 0_z; partIndex < parsers.size(); ++partIndex)
         {
-            iterator.operator++();
-            return *this;
+            parsers[partIndex].setMode(mode);
+            if(partIndex > 0_z)
+            {
+                // The part continues the last channel if the line before is not empty
+                auto const previousEnd = boundaries[partIndex] - 1_z;
+                auto const previousStart = previousEnd == 0_z ? std::string_view::npos : data.rfind(lineBreakSeparator, previousEnd - 1_z);
+                auto linePosition = previousStart == std::string_view::npos ? 0_z : previousStart + 1_z;
+                if(!parsers[partIndex].getNextLine(data.substr(0_z, previousEnd), linePosition).empty())
+                {
+                    parsers[partIndex].continueChannel();
+                }
+            }
         }
 
-        inline StopableStreamIterator& operator++(int v)
+        std::vector<std::future<void>> workers;
+        for(auto partIndex = 1_z; partIndex < parsers.size(); ++partIndex)
         {
-            iterator.operator++(v);
-            return *this;
+            workers.push_back(std::async(std::launch::async, [&, partIndex]()
+                                         {
+                                             parsers[partIndex].parse(data.substr(boundaries[partIndex], boundaries[partIndex + 1_z] - boundaries[partIndex]));
+                                         }));
         }
-
-        inline bool operator==(StopableStreamIterator const& rhs) const
+        parsers.front().parse(data.substr(0_z, boundaries[1_z]));
+        for(auto& worker : workers)
         {
-            return shouldAbort ? true : iterator == rhs.iterator;
+            worker.get();
         }
-
-        inline bool operator!=(StopableStreamIterator const& rhs) const
+        for(auto partIndex = 1_z; partIndex < parsers.size(); ++partIndex)
         {
-            return shouldAbort ? false : iterator != rhs.iterator;
+            parsers.front().append(parsers[partIndex]);
         }
-
-    private:
-        std::istream_iterator<char, char, std::char_traits<char>, ptrdiff_t> iterator;
-        T const& shouldAbort;
-    };
+        return parsers.front().getResults();
+    }
 } // namespace
 
 std::tuple<juce::Result, Track::FileDescription> Track::Loader::getFileDescription(juce::File const& file, double sampleRate)
@@ -135,6 +953,16 @@ std::tuple<juce::Result, Track::FileDescription> Track::Loader::getFileDescripti
         fd.format = FileDescription::Format::cue;
         return std::make_tuple(juce::Result::ok(), fd);
     }
+    else if(file.hasFileExtension(".npy"))
+    {
+        fd.format = FileDescription::Format::npy;
+        return std::make_tuple(juce::Result::ok(), fd);
+    }
+    else if(file.hasFileExtension(".npz"))
+    {
+        fd.format = FileDescription::Format::npz;
+        return std::make_tuple(juce::Result::ok(), fd);
+    }
     else if(file.hasFileExtension(".json"))
     {
         fd.format = FileDescription::Format::json;
@@ -307,6 +1135,11 @@ std::tuple<juce::Result, Track::FileDescription> Track::Loader::getFileDescripti
     return std::make_tuple(juce::Result::fail(juce::translate("The format of the file 'FLNAME' is not supported.").replace("FLNAME", fullPath)), Track::FileDescription{});
 }
 
+Track::Loader::Loader(Profiler& profiler)
+: mProfiler(profiler)
+{
+}
+
 Track::Loader::~Loader()
 {
     std::unique_lock<std::mutex> lock(mLoadingMutex);
@@ -338,7 +1171,16 @@ void Track::Loader::loadAnalysis(FileDescription const& fd)
                                          return {};
                                      }
                                      juce::Thread::setCurrentThreadName("Track::Loader::Process");
-                                     auto results = loadFromFile(fd, mShouldAbort, mAdvancement);
+                                     Tracer::ScopedEvent const scopedEvent("Track::Loader::loadFromFile", "loading");
+                                     auto results = mProfiler.measure(Profiler::Stage::loading, [&]()
+                                                                      {
+                                                                          // The binary files that don't fit in the cache of the reader are paged
+                                                                          if(fd.format == FileDescription::Format::binary && fd.file.getSize() > static_cast<juce::int64>(Result::Binary::Reader::defaultCacheSize))
+                                                                          {
+                                                                              return openFromBinary(fd, mShouldAbort, mAdvancement);
+                                                                          }
+                                                                          return loadFromFile(fd, mShouldAbort, mAdvancement);
+                                                                      });
                                      triggerAsyncUpdate();
                                      return results;
                                  });
@@ -346,6 +1188,7 @@ void Track::Loader::loadAnalysis(FileDescription const& fd)
 
 void Track::Loader::handleAsyncUpdate()
 {
+    Tracer::ScopedEvent const scopedEvent("Track::Loader::handleAsyncUpdate", "notification");
     std::unique_lock<std::mutex> lock(mLoadingMutex);
     if(mLoadingProcess.valid())
     {
@@ -437,6 +1280,10 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromFile(FileDescr
                 return loadFromCue(fd, shouldAbort, advancement);
             case FileDescription::Format::sdif:
                 return loadFromSdif(fd, shouldAbort, advancement);
+            case FileDescription::Format::npy:
+                return loadFromNpy(fd, shouldAbort, advancement);
+            case FileDescription::Format::npz:
+                return loadFromNpz(fd, shouldAbort, advancement);
             default:
                 break;
         }
@@ -464,186 +1311,45 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromJson(FileDescr
 
 std::variant<Track::Results, juce::String> Track::Loader::loadFromJson(std::istream& stream, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
 {
-    StopableStreamIterator<std::atomic<bool>> const itStart(stream, shouldAbort);
-    StopableStreamIterator<std::atomic<bool>> const itEnd(shouldAbort);
-    nlohmann::basic_json container;
-    try
-    {
-        container = nlohmann::json::parse(itStart, itEnd, nullptr);
-    }
-    catch(nlohmann::json::parse_error& e)
-    {
-        return {juce::translate(e.what())};
-    }
+    JsonResultsParser parser(stream, shouldAbort, advancement);
+    return parser.parse();
+}
 
-    advancement.store(0.2f);
-    if(container.is_discarded())
+std::variant<Track::Results, juce::String> Track::Loader::loadFromBinary(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    juce::MemoryMappedFile const mappedFile(fd.file, juce::MemoryMappedFile::AccessMode::readOnly);
+    auto const* data = static_cast<char const*>(mappedFile.getData());
+    if(data != nullptr && Result::Binary::isIndexed(data, mappedFile.getSize()))
     {
-        return {juce::translate("Parsing error: invalid JSON format")};
+        return Result::Binary::read(data, mappedFile.getSize(), shouldAbort, advancement);
     }
 
-    auto const& json = container.count("results") ? container.at("results") : container;
-    if(shouldAbort)
+    auto stream = std::ifstream(fd.file.getFullPathName().toStdString(), std::ios::in | std::ios::binary);
+    if(!stream || !stream.is_open() || !stream.good())
     {
-        return {};
+        return {juce::translate("The input stream of cannot be opened")};
     }
+    return loadFromBinary(stream, shouldAbort, advancement);
+}
 
-    std::vector<Results::Markers> markers;
-    std::vector<Results::Points> points;
-    std::vector<Results::Columns> columns;
-    markers.reserve(json.size());
-    points.reserve(json.size());
-    columns.reserve(json.size());
-
-    // clang-format off
-    enum class Mode
-    {
-          undefined
-        , marker
-        , point
-        , column
-    };
-    // clang-format on
-
-    auto mode = Mode::undefined;
-    auto const checkAndSet = [&](Mode const expected)
+std::variant<Track::Results, juce::String> Track::Loader::openFromBinary(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    auto reader = std::make_shared<Result::Binary::Reader>(fd.file);
+    if(reader->getStatus().failed())
     {
-        if(mode == Mode::undefined || mode == expected)
-        {
-            mode = expected;
-            return true;
-        }
-        return false;
-    };
-
-    for(size_t channelIndex = 0_z; channelIndex < json.size(); ++channelIndex)
+        // The files without index (version 1) cannot be paged
+        return loadFromBinary(fd, shouldAbort, advancement);
+    }
+    auto const summary = reader->getSummary(shouldAbort, advancement);
+    if(auto const* error = std::get_if<juce::String>(&summary))
     {
-        auto const& channelData = json.at(channelIndex);
-        Results::Markers markerChannel;
-        Results::Points pointChannel;
-        Results::Columns columnChannel;
-        markerChannel.reserve(mode == Mode::marker ? channelData.size() : 0_z);
-        pointChannel.reserve(mode == Mode::point ? channelData.size() : 0_z);
-        columnChannel.reserve(mode == Mode::column ? channelData.size() : 0_z);
-
-        auto const advRatio = 0.8f * static_cast<float>(channelIndex) / static_cast<float>(json.size());
-        advancement.store(0.2f + advRatio);
-        for(size_t frameIndex = 0_z; frameIndex < channelData.size(); ++frameIndex)
-        {
-            advancement.store(0.2f + advRatio + 0.1f * static_cast<float>(frameIndex) / static_cast<float>(channelData.size()));
-            if(shouldAbort)
-            {
-                return {};
-            }
-
-            auto const& frameData = channelData.at(frameIndex);
-            auto const timeIt = frameData.find("time");
-            if(timeIt == frameData.cend())
-            {
-                return {juce::translate("Parsing error: the result frame doesn't contain the time value")};
-            }
-            auto const durationIt = frameData.find("duration");
-            auto const extraIt = frameData.find("extra");
-            auto const labelIt = frameData.find("label");
-            auto const valueIt = frameData.find("value");
-            auto const valuesIt = frameData.find("values");
-            if(labelIt != frameData.cend() || mode == Mode::marker || (mode == Mode::undefined && valueIt == frameData.cend() && valuesIt == frameData.cend()))
-            {
-                if(!checkAndSet(Mode::marker))
-                {
-                    return {juce::translate("Parsing error: the type of results is not consistent - expected EXPECTTYPE, but got CURRENTTYPE").replace("EXPECTTYPE", std::string(magic_enum::enum_name(Mode::marker))).replace("CURRENTTYPE", std::string(magic_enum::enum_name(mode)))};
-                }
-                markerChannel.push_back({});
-                std::get<0_z>(markerChannel.back()) = timeIt->get<double>();
-                std::get<1_z>(markerChannel.back()) = durationIt == frameData.cend() ? 0.0 : durationIt->get<double>();
-                if(labelIt != frameData.cend())
-                {
-                    std::get<2_z>(markerChannel.back()) = labelIt->get<std::string>();
-                }
-                if(extraIt != frameData.cend())
-                {
-                    std::get<3_z>(markerChannel.back()) = extraIt->get<std::vector<float>>();
-                }
-            }
-            else if(valueIt != frameData.cend() || mode == Mode::point)
-            {
-                if(!checkAndSet(Mode::point))
-                {
-                    return {juce::translate("Parsing error: the type of results is not consistent - expected EXPECTTYPE, but got CURRENTTYPE").replace("EXPECTTYPE", std::string(magic_enum::enum_name(Mode::point))).replace("CURRENTTYPE", std::string(magic_enum::enum_name(mode)))};
-                }
-                pointChannel.push_back({});
-                std::get<0_z>(pointChannel.back()) = timeIt->get<double>();
-                std::get<1_z>(pointChannel.back()) = durationIt == frameData.cend() ? 0.0 : durationIt->get<double>();
-                if(valueIt != frameData.cend())
-                {
-                    std::get<2_z>(pointChannel.back()) = valueIt->get<float>();
-                }
-                if(extraIt != frameData.cend())
-                {
-                    std::get<3_z>(pointChannel.back()) = extraIt->get<std::vector<float>>();
-                }
-            }
-            else if(valuesIt != frameData.cend() || mode == Mode::column)
-            {
-                if(!checkAndSet(Mode::column))
-                {
-                    return {juce::translate("Parsing error: the type of results is not consistent - expected EXPECTTYPE, but got CURRENTTYPE").replace("EXPECTTYPE", std::string(magic_enum::enum_name(Mode::column))).replace("CURRENTTYPE", std::string(magic_enum::enum_name(mode)))};
-                }
-                columnChannel.push_back({});
-                std::get<0_z>(columnChannel.back()) = timeIt->get<double>();
-                std::get<1_z>(columnChannel.back()) = durationIt == frameData.cend() ? 0.0 : durationIt->get<double>();
-                if(valuesIt != frameData.cend())
-                {
-                    std::get<2_z>(columnChannel.back()) = valuesIt->get<std::vector<float>>();
-                }
-                if(extraIt != frameData.cend())
-                {
-                    std::get<3_z>(columnChannel.back()) = extraIt->get<std::vector<float>>();
-                }
-            }
-        }
-        if(mode == Mode::marker)
-        {
-            markers.push_back(std::move(markerChannel));
-        }
-        else if(mode == Mode::point)
-        {
-            points.push_back(std::move(pointChannel));
-        }
-        else if(mode == Mode::column)
-        {
-            columns.push_back(std::move(columnChannel));
-        }
+        return {*error};
     }
     if(shouldAbort)
     {
         return {};
     }
-
-    advancement.store(1.0f);
-    if(mode == Mode::marker)
-    {
-        return Track::Results(std::move(markers));
-    }
-    else if(mode == Mode::point)
-    {
-        return Track::Results(std::move(points));
-    }
-    else if(mode == Mode::column)
-    {
-        return Track::Results(std::move(columns));
-    }
-    return {juce::translate("Parsing error: couldn't determine the type of results")};
-}
-
-std::variant<Track::Results, juce::String> Track::Loader::loadFromBinary(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
-{
-    auto stream = std::ifstream(fd.file.getFullPathName().toStdString(), std::ios::in | std::ios::binary);
-    if(!stream || !stream.is_open() || !stream.good())
-    {
-        return {juce::translate("The input stream of cannot be opened")};
-    }
-    return loadFromBinary(stream, shouldAbort, advancement);
+    return {Results(std::move(reader), std::get<Result::Binary::Summary>(summary))};
 }
 
 std::variant<Track::Results, juce::String> Track::Loader::loadFromBinary(std::istream& stream, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
@@ -660,6 +1366,13 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromBinary(std::is
         return {juce::translate("Parsing error - type")};
     }
 
+    if(Result::Binary::isIndexed(type, 6_z))
+    {
+        std::vector<char> buffer(type, type + 6);
+        buffer.insert(buffer.end(), std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        return Result::Binary::read(buffer.data(), buffer.size(), shouldAbort, advancement);
+    }
+
     if(stream.eof())
     {
         return {juce::translate("Parsing error - eof")};
@@ -851,6 +1564,27 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromBinary(std::is
     return {std::move(res)};
 }
 
+std::variant<Track::Results, juce::String> Track::Loader::loadFromNpy(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    juce::MemoryMappedFile const mappedFile(fd.file, juce::MemoryMappedFile::AccessMode::readOnly);
+    auto const* data = static_cast<char const*>(mappedFile.getData());
+    if(data == nullptr)
+    {
+        return {juce::translate("The input stream of cannot be opened")};
+    }
+    return Result::Numpy::readMatrix(data, mappedFile.getSize(), shouldAbort, advancement);
+}
+
+std::variant<Track::Results, juce::String> Track::Loader::loadFromNpz(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    juce::FileInputStream stream(fd.file);
+    if(!stream.openedOk())
+    {
+        return {juce::translate("The input stream of cannot be opened")};
+    }
+    return Result::Numpy::readArchive(stream, shouldAbort, advancement);
+}
+
 std::variant<Track::Results, juce::String> Track::Loader::loadFromCue(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
 {
     auto stream = std::ifstream(fd.file.getFullPathName().toStdString());
@@ -918,225 +1652,114 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromCue(std::istre
 
     auto addNewChannel = true;
     std::string line;
-    while(getline(stream, line, '\n'))
-    {
-        if(shouldAbort)
-        {
-            return {};
-        }
-
-        if(hasKey(line, "TITLE"s, 0_z))
-        {
-            addNewChannel = true;
-        }
-        else if(hasKey(line, "TRACK"s, 1_z))
-        {
-            if(std::exchange(addNewChannel, false))
-            {
-                channelResults.push_back({});
-            }
-            if(channelResults.empty())
-            {
-                return {juce::translate("Parsing error")};
-            }
-            channelResults.back().push_back({});
-        }
-        else if(hasKey(line, "TITLE"s, 2_z))
-        {
-            if(channelResults.empty() || channelResults.back().empty())
-            {
-                return {juce::translate("Parsing error")};
-            }
-            auto& frameResult = channelResults.back().back();
-            auto const label = unescapeString(trimString(trimString(line).substr("TITLE"s.length())));
-            std::get<2>(frameResult) = label;
-        }
-        else if(hasKey(line, "INDEX 01"s, 2_z))
-        {
-            if(channelResults.empty() || channelResults.back().empty())
-            {
-                return {juce::translate("Parsing error")};
-            }
-            auto& frameResult = channelResults.back().back();
-            auto const timeString = trimString(trimString(line).substr("INDEX 01"s.length()));
-            std::string minutes, secondes, frames;
-            std::istringstream timeStream(timeString);
-            getline(timeStream, minutes, ':');
-            getline(timeStream, secondes, ':');
-            getline(timeStream, frames, ':');
-            auto const time = std::stod(minutes) * 60.0 + std::stod(secondes) + std::stod(frames) / 75.0;
-            std::get<0>(frameResult) = time;
-        }
-    }
-
-    advancement.store(1.0f);
-    return Results(std::move(channelResults));
-}
-
-std::variant<Track::Results, juce::String> Track::Loader::loadFromCsv(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
-{
-    auto stream = std::ifstream(fd.file.getFullPathName().toStdString());
-    if(!stream || !stream.is_open() || !stream.good())
-    {
-        return {juce::translate("The input stream of cannot be opened")};
-    }
-    auto const separator = FileDescription::toChar(fd.columnSeparator);
-    auto const useEndTime = fd.format == FileDescription::Format::lab;
-    auto const lineBreakSeparator = fd.format == FileDescription::Format::puredata || fd.format == FileDescription::Format::max ? ';' : '\n';
-    auto const prependLineIndex = fd.format == FileDescription::Format::max;
-    return loadFromCsv(stream, separator, useEndTime, lineBreakSeparator, prependLineIndex, shouldAbort, advancement);
-}
-
-std::variant<Track::Results, juce::String> Track::Loader::loadFromCsv(std::istream& stream, char const separator, bool useEndTime, char const lineBreakSeparator, bool prependLineIndex, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
-{
-    auto const trimString = [](std::string const& s)
-    {
-        auto const ltrim = [](std::string const& sr)
-        {
-            auto const start = sr.find_first_not_of(" \n\r\t\f\v");
-            return (start == std::string::npos) ? "" : sr.substr(start);
-        };
-
-        auto const rtrim = [](std::string const& sr)
-        {
-            auto const end = sr.find_last_not_of(" \n\r\t\f\v");
-            return (end == std::string::npos) ? "" : sr.substr(0, end + 1);
-        };
-
-        return rtrim(ltrim(s));
-    };
-
-    auto const unescapeString = [](juce::String const& s)
-    {
-        return s.replace("\\\"", "\"").replace("\\\'", "\'").replace("\\t", "\t").replace("\\r", "\r").replace("\\n", "\n").unquoted();
-    };
-
-    // clang-format off
-    enum class Mode
-    {
-          undefined
-        , marker
-        , point
-    };
-    // clang-format on
-
-    auto mode = Mode::undefined;
-    auto const getFloatValue = [](auto const& v) -> std::optional<float>
-    {
-        try
-        {
-            auto value = std::stof(v);
-            if(std::isnan(value) || !std::isfinite(value))
-            {
-                return {};
-            }
-            return value;
-        }
-        catch(...)
-        {
-            return {};
-        }
-    };
-
-    std::vector<Results::Markers> markers;
-    std::vector<Results::Points> points;
-
-    auto addNewChannel = true;
-    std::string line;
-    while(std::getline(stream, line, lineBreakSeparator))
+    while(getline(stream, line, '\n'))
     {
         if(shouldAbort)
         {
             return {};
         }
 
-        line = trimString(line);
-        if(prependLineIndex)
-        {
-            auto const position = line.find(",");
-            if(position != std::string::npos)
-            {
-                line.erase(0, position + 1_z);
-                line = trimString(line);
-            }
-        }
-        if(line.empty())
+        if(hasKey(line, "TITLE"s, 0_z))
         {
             addNewChannel = true;
         }
-        else
+        else if(hasKey(line, "TRACK"s, 1_z))
         {
             if(std::exchange(addNewChannel, false))
             {
-                markers.push_back({});
-                points.push_back({});
+                channelResults.push_back({});
             }
-            std::string time, duration, value;
-            std::istringstream linestream(line);
-            std::getline(linestream, time, separator);
-            std::getline(linestream, duration, separator);
-            std::getline(linestream, value, separator);
-            if(time.empty() || duration.empty())
+            if(channelResults.empty())
             {
-                return {juce::translate("Parsing error - time and duration")};
+                return {juce::translate("Parsing error")};
             }
-            else if(std::isdigit(static_cast<int>(time[0])) && std::isdigit(static_cast<int>(duration[0])))
+            channelResults.back().push_back({});
+        }
+        else if(hasKey(line, "TITLE"s, 2_z))
+        {
+            if(channelResults.empty() || channelResults.back().empty())
             {
-                auto& markerChannel = markers.back();
-                auto& pointChannel = points.back();
-                auto const timevalue = std::stod(time);
-                auto const durationvalue = std::max(useEndTime ? std::stod(duration) - timevalue : std::stod(duration), 0.0);
-                auto pointvalue = mode == Mode::marker ? std::optional<float>{} : getFloatValue(value);
-                if(pointvalue.has_value())
-                {
-                    mode = Mode::point;
-                    pointChannel.push_back({});
-                    std::get<0_z>(pointChannel.back()) = timevalue;
-                    std::get<1_z>(pointChannel.back()) = durationvalue;
-                    std::get<2_z>(pointChannel.back()) = pointvalue.value();
-                    while(getline(linestream, value, separator))
-                    {
-                        pointvalue = getFloatValue(value);
-                        if(pointvalue.has_value())
-                        {
-                            std::get<3_z>(pointChannel.back()).push_back(pointvalue.value());
-                        }
-                    }
-                }
-                else
-                {
-                    if(mode == Mode::point)
-                    {
-                        return {juce::translate("Parsing error - mode")};
-                    }
-                    mode = Mode::marker;
-                    markerChannel.push_back({});
-                    std::get<0_z>(markerChannel.back()) = timevalue;
-                    std::get<1_z>(markerChannel.back()) = durationvalue;
-                    std::get<2_z>(markerChannel.back()) = unescapeString(value).toStdString();
-                    while(getline(linestream, value, separator))
-                    {
-                        pointvalue = getFloatValue(value);
-                        if(pointvalue.has_value())
-                        {
-                            std::get<3_z>(markerChannel.back()).push_back(pointvalue.value());
-                        }
-                    }
-                }
+                return {juce::translate("Parsing error")};
+            }
+            auto& frameResult = channelResults.back().back();
+            auto const label = unescapeString(trimString(trimString(line).substr("TITLE"s.length())));
+            std::get<2>(frameResult) = label;
+        }
+        else if(hasKey(line, "INDEX 01"s, 2_z))
+        {
+            if(channelResults.empty() || channelResults.back().empty())
+            {
+                return {juce::translate("Parsing error")};
             }
+            auto& frameResult = channelResults.back().back();
+            auto const timeString = trimString(trimString(line).substr("INDEX 01"s.length()));
+            std::string minutes, secondes, frames;
+            std::istringstream timeStream(timeString);
+            getline(timeStream, minutes, ':');
+            getline(timeStream, secondes, ':');
+            getline(timeStream, frames, ':');
+            auto const time = std::stod(minutes) * 60.0 + std::stod(secondes) + std::stod(frames) / 75.0;
+            std::get<0>(frameResult) = time;
         }
     }
 
     advancement.store(1.0f);
-    if(mode == Mode::marker)
+    return Results(std::move(channelResults));
+}
+
+std::variant<Track::Results, juce::String> Track::Loader::loadFromCsv(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    auto const separator = FileDescription::toChar(fd.columnSeparator);
+    auto const useEndTime = fd.format == FileDescription::Format::lab;
+    auto const lineBreakSeparator = fd.format == FileDescription::Format::puredata || fd.format == FileDescription::Format::max ? ';' : '\n';
+    auto const prependLineIndex = fd.format == FileDescription::Format::max;
+
+    juce::MemoryMappedFile const mappedFile(fd.file, juce::MemoryMappedFile::AccessMode::readOnly);
+    auto const* data = static_cast<char const*>(mappedFile.getData());
+    if(data != nullptr)
+    {
+        return parseCsvResults(std::string_view(data, mappedFile.getSize()), separator, useEndTime, lineBreakSeparator, prependLineIndex, shouldAbort, advancement);
+    }
+
+    auto stream = std::ifstream(fd.file.getFullPathName().toStdString());
+    if(!stream || !stream.is_open() || !stream.good())
+    {
+        return {juce::translate("The input stream of cannot be opened")};
+    }
+    return loadFromCsv(stream, separator, useEndTime, lineBreakSeparator, prependLineIndex, shouldAbort, advancement);
+}
+
+std::variant<Track::Results, juce::String> Track::Loader::loadFromCsv(std::istream& stream, char const separator, bool useEndTime, char const lineBreakSeparator, bool prependLineIndex, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    auto streamSize = 0_z;
+    auto const streamStart = static_cast<std::streamoff>(stream.tellg());
+    if(streamStart >= 0 && stream.seekg(0, std::ios::end))
     {
-        return Track::Results(std::move(markers));
+        streamSize = static_cast<size_t>(static_cast<std::streamoff>(stream.tellg()) - streamStart);
+        stream.seekg(streamStart, std::ios::beg);
     }
-    else if(mode == Mode::point)
+    stream.clear();
+
+    // The stream is read by blocks and only the complete lines are parsed, the remaining part is kept for the next block
+    std::atomic<size_t> position{0_z};
+    CsvResultsParser parser(separator, useEndTime, lineBreakSeparator, prependLineIndex, shouldAbort, advancement, position, streamSize);
+    std::vector<char> block(1024_z * 1024_z);
+    std::string buffer;
+    while(stream.read(block.data(), static_cast<std::streamsize>(block.size())) || stream.gcount() > 0)
     {
-        return Track::Results(std::move(points));
+        buffer.append(block.data(), static_cast<size_t>(stream.gcount()));
+        auto const end = buffer.rfind(lineBreakSeparator);
+        if(end != std::string::npos)
+        {
+            if(!parser.parse(std::string_view(buffer).substr(0_z, end + 1_z)))
+            {
+                return parser.getResults();
+            }
+            buffer.erase(0_z, end + 1_z);
+        }
     }
-    return {juce::translate("Parsing error - unknown mode")};
+    parser.parse(buffer);
+    return parser.getResults();
 }
 
 std::variant<Track::Results, juce::String> Track::Loader::loadFromReaper(FileDescription const& fd, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
@@ -1283,79 +1906,75 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromSdif(juce::Fil
             juce::ignoreUnused(frameSignature, frameIndex, numRows, numColumns, names);
             return !shouldAbort && message.isEmpty() && matrixSignature == matrixId;
         },
-        [&](uint32_t frameSignature, size_t frameIndex, uint32_t matrixSignature, double time, size_t numRows, size_t numColumns, std::variant<std::vector<std::string>, std::vector<std::vector<double>>> data)
+        [&](SdifConverter::Matrix const& matrix)
         {
-            juce::ignoreUnused(frameSignature, matrixSignature);
             if(shouldAbort || !message.isEmpty())
             {
                 return false;
             }
-            if(data.index() == 0_z && column.has_value() && *column != 0_z)
+            if(matrix.isText && column.has_value() && *column != 0_z)
             {
                 message = "Column index cannot be specified with text data type";
                 return false;
             }
-            if(numRows != 1_z && !row.has_value() && numColumns != 1_z && !column.has_value())
+            if(matrix.numRows != 1_z && !row.has_value() && matrix.numColumns != 1_z && !column.has_value())
             {
                 message = "Can't convert all rows and all columns (either one row or one column must be selected)";
                 return false;
             }
 
-            pluginResults.resize(std::max(pluginResults.size(), frameIndex + 1_z));
-            if(pluginResults.size() < frameIndex)
+            pluginResults.resize(std::max(pluginResults.size(), matrix.frameIndex + 1_z));
+            if(pluginResults.size() < matrix.frameIndex)
             {
                 message = "Channels cannot be alocated";
                 return false;
             }
-            auto& channelResults = pluginResults[frameIndex];
-
-            auto const* labels = std::get_if<0_z>(&data);
-            auto const* values = std::get_if<1_z>(&data);
+            auto& channelResults = pluginResults[matrix.frameIndex];
 
             Plugin::Result result;
             result.hasTimestamp = true;
-            result.timestamp = Vamp::RealTime::fromSeconds(time);
+            result.timestamp = Vamp::RealTime::fromSeconds(matrix.time);
 
-            if(row.has_value() || numRows == 1_z)
+            if(row.has_value() || matrix.numRows == 1_z)
             {
                 auto const rowIndex = row.has_value() ? *row : 0_z;
-                if(labels != nullptr && labels->size() > rowIndex)
+                if(matrix.isText && matrix.labels.size() > rowIndex)
                 {
-                    result.label = labels->at(rowIndex);
+                    result.label = matrix.labels.at(rowIndex);
                     setBinCount(0_z);
                 }
-                else if(values != nullptr && values->size() > rowIndex)
+                else if(!matrix.isText && matrix.numRows > rowIndex)
                 {
-                    if(column.has_value() || numColumns == 1)
+                    auto const* rowValues = matrix.getRow(rowIndex);
+                    if(column.has_value() || matrix.numColumns == 1)
                     {
                         auto const columnIndex = column.has_value() ? *column : 0_z;
-                        if(values->at(rowIndex).size() > columnIndex)
+                        if(matrix.numColumns > columnIndex)
                         {
-                            result.values = {static_cast<float>(values->at(rowIndex).at(columnIndex))};
+                            result.values = {static_cast<float>(rowValues[columnIndex])};
                         }
                         setBinCount(1_z);
                     }
                     else
                     {
-                        auto const& rowValues = values->at(rowIndex);
-                        result.values.reserve(rowValues.size());
-                        for(auto index = 0_z; index < rowValues.size(); ++index)
-                        {
-                            result.values.push_back(static_cast<float>(rowValues[index]));
-                        }
-                        setBinCount(rowValues.size());
+                        result.values.resize(matrix.numColumns);
+                        std::transform(rowValues, rowValues + matrix.numColumns, result.values.begin(), [](auto const value)
+                                       {
+                                           return static_cast<float>(value);
+                                       });
+                        setBinCount(matrix.numColumns);
                     }
                 }
             }
-            else if(values != nullptr)
+            else if(!matrix.isText)
             {
                 auto const columnIndex = column.has_value() ? *column : 0_z;
-                result.values.reserve(values->size());
-                for(auto rowIndex = 0_z; rowIndex < values->size(); ++rowIndex)
+                if(columnIndex < matrix.numColumns)
                 {
-                    if(columnIndex < values->at(rowIndex).size())
+                    result.values.resize(matrix.numRows);
+                    for(auto rowIndex = 0_z; rowIndex < matrix.numRows; ++rowIndex)
                     {
-                        result.values.push_back(static_cast<float>(values->at(rowIndex).at(columnIndex)));
+                        result.values[rowIndex] = static_cast<float>(matrix.getRow(rowIndex)[columnIndex]);
                     }
                 }
                 setBinCount(result.values.size());
@@ -1398,7 +2017,7 @@ std::variant<Track::Results, juce::String> Track::Loader::loadFromSdif(juce::Fil
 
 juce::String Track::Loader::getWildCardForAllFormats()
 {
-    return "*.json;*.csv;*.lab;*.txt;*.cue;*.sdif;*.dat";
+    return "*.json;*.csv;*.lab;*.txt;*.cue;*.sdif;*.dat;*.npy;*.npz";
 }
 
 class Track::Loader::UnitTest
@@ -1608,6 +2227,35 @@ public:
             checkMarkers(loadFromCsv(stream, '\t', true, '\n', false, shouldAbort, advancement));
         }
 
+        beginTest("load csv markers in parts");
+        {
+            std::string data = "TIME,DURATION,LABEL\n";
+            for(auto channelIndex = 0_z; channelIndex < 3_z; ++channelIndex)
+            {
+                data += "\n";
+                for(auto frameIndex = 0_z; frameIndex < 200000_z; ++frameIndex)
+                {
+                    data += std::to_string(static_cast<double>(frameIndex) * 0.01) + ",0.5,\"label \\\"" + std::to_string(frameIndex % 10_z) + "\\\"\",1.5\n";
+                }
+            }
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            std::istringstream stream(data);
+            auto const expected = loadFromCsv(stream, ',', false, '\n', false, shouldAbort, advancement);
+            auto const result = parseCsvResults(data, ',', false, '\n', false, shouldAbort, advancement);
+            expectEquals(expected.index(), 0_z);
+            expectEquals(result.index(), 0_z);
+            auto const expectedMarkers = std::get_if<Results>(&expected) != nullptr ? std::get_if<Results>(&expected)->getMarkers() : nullptr;
+            auto const markers = std::get_if<Results>(&result) != nullptr ? std::get_if<Results>(&result)->getMarkers() : nullptr;
+            expect(expectedMarkers != nullptr && markers != nullptr);
+            if(expectedMarkers != nullptr && markers != nullptr)
+            {
+                expectEquals(markers->size(), 4_z);
+                expect(*markers == *expectedMarkers);
+                expectEquals(std::get<2_z>(markers->at(1_z).at(3_z)), std::string("label \"3\""));
+            }
+        }
+
         beginTest("load reaper markers m");
         {
             std::stringstream stream;
@@ -1689,6 +2337,41 @@ public:
             checkPoints(loadFromJson(stream, shouldAbort, advancement), true);
         }
 
+        beginTest("load json columns - non-finite values");
+        {
+            auto constexpr nan = std::numeric_limits<float>::quiet_NaN();
+            Accessor accessor;
+            // clang-format off
+            accessor.setAttr<AttrType::results>(Results(std::vector<Results::Columns>
+            {
+                {{0.0, 0.1, {1.0f, nan, 2.0f, nan}, {nan, 3.0f}}, {0.1, 0.1, {nan, nan}, {}}}
+            }), NotificationType::synchronous);
+            // clang-format on
+            std::atomic<bool> shouldAbort{false};
+            std::stringstream stream;
+            auto const exportResult = Exporter::toJson(accessor, {}, {}, stream, false, false, shouldAbort);
+            expect(exportResult.wasOk(), exportResult.getErrorMessage());
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromJson(stream, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            auto const columns = std::get_if<Results>(&vResult) != nullptr ? std::get_if<Results>(&vResult)->getColumns() : nullptr;
+            expect(columns != nullptr && columns->size() == 1_z && columns->front().size() == 2_z);
+            if(columns != nullptr && columns->size() == 1_z && columns->front().size() == 2_z)
+            {
+                auto const expectValues = [this](std::vector<float> const& values, std::vector<float> const& expected)
+                {
+                    expectEquals(values.size(), expected.size(), "Num Values");
+                    for(auto index = 0_z; index < std::min(values.size(), expected.size()); ++index)
+                    {
+                        expect(std::isnan(values[index]) ? std::isnan(expected[index]) : values[index] == expected[index], "Value");
+                    }
+                };
+                expectValues(std::get<2_z>(columns->front().at(0_z)), {1.0f, nan, 2.0f, nan});
+                expectValues(std::get<3_z>(columns->front().at(0_z)), {nan, 3.0f});
+                expectValues(std::get<2_z>(columns->front().at(1_z)), {nan, nan});
+            }
+        }
+
         beginTest("load binary error");
         {
             std::stringstream stream;
@@ -1734,6 +2417,377 @@ public:
             checkPoints(loadFromBinary(stream, shouldAbort, advancement));
         }
 
+        beginTest("load binary v2 markers");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Markers_dat, TestResultsData::Markers_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream stream;
+            expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            checkMarkers(loadFromBinary(stream, shouldAbort, advancement));
+        }
+
+        beginTest("load binary v2 points");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Points_dat, TestResultsData::Points_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream stream;
+            expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            checkPoints(loadFromBinary(stream, shouldAbort, advancement));
+        }
+
+        beginTest("load binary v3 markers");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Markers_dat, TestResultsData::Markers_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream stream;
+            expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, true, shouldAbort));
+            checkMarkers(loadFromBinary(stream, shouldAbort, advancement));
+        }
+
+        beginTest("load binary v3 points");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Points_dat, TestResultsData::Points_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream stream;
+            expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, true, shouldAbort));
+            checkPoints(loadFromBinary(stream, shouldAbort, advancement));
+        }
+
+        beginTest("load binary v3 columns");
+        {
+            std::vector<Results::Columns> columns(2_z);
+            for(auto channel = 0_z; channel < columns.size(); ++channel)
+            {
+                for(auto frame = 0_z; frame < 50000_z; ++frame)
+                {
+                    std::vector<float> values(frame % 7_z == 0_z ? 16_z : 32_z);
+                    for(auto bin = 0_z; bin < values.size(); ++bin)
+                    {
+                        values[bin] = std::sin(static_cast<float>(frame) * 0.001f + static_cast<float>(bin)) * static_cast<float>(channel + 1_z);
+                    }
+                    std::vector<float> extras;
+                    if(frame % 3_z == 0_z)
+                    {
+                        extras.push_back(static_cast<float>(frame));
+                    }
+                    columns[channel].push_back(std::make_tuple(static_cast<double>(frame) * 512.0 / 44100.0, 512.0 / 44100.0, std::move(values), std::move(extras)));
+                }
+            }
+            auto columnsCopy = columns;
+            Results const results(std::move(columnsCopy));
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            std::stringstream raw;
+            std::stringstream compact;
+            expect(Result::Binary::write(raw, results, {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            expect(Result::Binary::write(compact, results, {-1.0, std::numeric_limits<double>::max()}, {}, true, shouldAbort));
+            auto const rawSize = raw.str().size();
+            auto const compactSize = compact.str().size();
+            expect(compactSize < rawSize);
+
+            auto const rawStart = juce::Time::getMillisecondCounterHiRes();
+            auto const vRaw = loadFromBinary(raw, shouldAbort, advancement);
+            auto const compactStart = juce::Time::getMillisecondCounterHiRes();
+            auto const vCompact = loadFromBinary(compact, shouldAbort, advancement);
+            auto const compactEnd = juce::Time::getMillisecondCounterHiRes();
+            expectEquals(vRaw.index(), 0_z);
+            expectEquals(vCompact.index(), 0_z);
+            auto const rawColumns = std::get_if<Results>(&vRaw) != nullptr ? std::get_if<Results>(&vRaw)->getColumns() : nullptr;
+            auto const compactColumns = std::get_if<Results>(&vCompact) != nullptr ? std::get_if<Results>(&vCompact)->getColumns() : nullptr;
+            expect(rawColumns != nullptr && compactColumns != nullptr && *rawColumns == columns && *compactColumns == columns);
+            logMessage("Binary v2: " + juce::String(rawSize) + " bytes (" + juce::String(compactStart - rawStart, 1) + "ms) - v3: " + juce::String(compactSize) + " bytes (" + juce::String(compactEnd - compactStart, 1) + "ms)");
+        }
+
+        beginTest("load binary v2 checksum error");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Markers_dat, TestResultsData::Markers_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream output;
+            expect(Result::Binary::write(output, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            auto data = output.str();
+            data[data.size() / 2_z] = static_cast<char>(data[data.size() / 2_z] ^ 0x01);
+            std::stringstream stream(data);
+            expectEquals(loadFromBinary(stream, shouldAbort, advancement).index(), 1_z);
+        }
+
+        beginTest("load binary v2 chunk error");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Markers_dat, TestResultsData::Markers_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            std::stringstream output;
+            expect(Result::Binary::write(output, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            auto data = output.str();
+            auto const readValue = [&](size_t position)
+            {
+                uint64_t value;
+                std::memcpy(&value, data.data() + position, sizeof(value));
+                return value;
+            };
+            // The number of frames of the first chunk is increased so the end positions would be read after the chunk
+            auto const numFrames = static_cast<uint64_t>(readValue(32_z + 24_z) / sizeof(double));
+            std::memcpy(data.data() + 32_z + 8_z, &numFrames, sizeof(numFrames));
+            // The checksum is updated so only the chunk is invalid
+            uint64_t checksum = 14695981039346656037ull;
+            for(auto position = 0_z; position + 16_z <= data.size(); position += 8_z)
+            {
+                checksum = (checksum ^ readValue(position)) * 1099511628211ull;
+            }
+            std::memcpy(data.data() + data.size() - 8_z, &checksum, sizeof(checksum));
+            std::stringstream stream(data);
+            expectEquals(loadFromBinary(stream, shouldAbort, advancement).index(), 1_z);
+        }
+
+        beginTest("read binary v2 time range");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Markers_dat, TestResultsData::Markers_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            juce::TemporaryFile temp(".dat");
+            {
+                std::ofstream stream(temp.getFile().getFullPathName().toStdString(), std::ios::out | std::ios::binary);
+                expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, false, shouldAbort));
+            }
+            Result::Binary::Reader reader(temp.getFile());
+            expect(reader.getStatus().wasOk(), reader.getStatus().getErrorMessage());
+            expectEquals(reader.getHeader().numChannels, 2_z);
+            auto const vData = reader.getData({1.0, 20.0}, shouldAbort);
+            expectEquals(vData.index(), 0_z);
+            if(auto const* data = std::get_if<Results>(&vData))
+            {
+                auto const access = data->getReadAccess();
+                auto const markers = data->getMarkers();
+                expect(markers != nullptr && markers->size() == 2_z);
+                if(markers != nullptr && markers->size() == 2_z)
+                {
+                    expectEquals(markers->at(0_z).size(), 1_z);
+                    expectEquals(markers->at(1_z).size(), 1_z);
+                    expectEquals(std::get<2_z>(markers->at(0_z).front()), std::string("B7/D#"));
+                    expectEquals(std::get<2_z>(markers->at(1_z).front()), std::string("A"));
+                }
+            }
+        }
+
+        beginTest("open paged binary");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Points_dat, TestResultsData::Points_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            juce::TemporaryFile temp(".dat");
+            {
+                std::ofstream stream(temp.getFile().getFullPathName().toStdString(), std::ios::out | std::ios::binary);
+                expect(Result::Binary::write(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, true, shouldAbort));
+            }
+            auto const vPaged = openFromBinary(FileDescription{temp.getFile()}, shouldAbort, advancement);
+            expectEquals(vPaged.index(), 0_z);
+            auto const* paged = std::get_if<Results>(&vPaged);
+            auto const* full = std::get_if<Results>(&vResult);
+            if(paged != nullptr && full != nullptr)
+            {
+                expect(paged->isPaged());
+                {
+                    // The summary describes the whole file before any frame is read
+                    auto const pagedAccess = paged->getReadAccess();
+                    auto const fullAccess = full->getReadAccess();
+                    expect(!paged->getPage().has_value());
+                    expect(paged->getNumChannels() == full->getNumChannels());
+                    expect(paged->getNumBins() == full->getNumBins());
+                    expect(paged->getValueRange() == full->getValueRange());
+                    expect(paged->getExtraRange(0_z) == full->getExtraRange(0_z));
+                    auto const points = paged->getPoints();
+                    expect(points != nullptr && points->size() == 2_z && points->at(0_z).empty() && points->at(1_z).empty());
+                }
+
+                // The copies share the frames of the page
+                auto const copy = *paged;
+                expect(copy.setPage({1.0, 2.0}, shouldAbort));
+                {
+                    auto const pagedAccess = paged->getReadAccess();
+                    auto const fullAccess = full->getReadAccess();
+                    expect(paged->getPage() == std::optional<Zoom::Range>(Zoom::Range{1.0, 2.0}));
+                    auto const points = paged->getPoints();
+                    auto const allPoints = full->getPoints();
+                    expect(points != nullptr && allPoints != nullptr && points->size() == allPoints->size());
+                    if(points != nullptr && allPoints != nullptr && points->size() == allPoints->size())
+                    {
+                        for(auto channel = 0_z; channel < points->size(); ++channel)
+                        {
+                            auto const& channelPoints = allPoints->at(channel);
+                            auto const expected = std::count_if(channelPoints.cbegin(), channelPoints.cend(), [](auto const& point)
+                                                                {
+                                                                    return std::get<0_z>(point) <= 2.0 && std::get<0_z>(point) + std::get<1_z>(point) >= 1.0;
+                                                                });
+                            expectEquals(points->at(channel).size(), static_cast<size_t>(expected));
+                        }
+                    }
+                    expect(paged->getValueRange() == full->getValueRange());
+                }
+
+                checkPoints(paged->loadFrames({-1.0, std::numeric_limits<double>::max()}, shouldAbort));
+            }
+        }
+
+        beginTest("load npz points");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Points_dat, TestResultsData::Points_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            juce::TemporaryFile temp(".npz");
+            {
+                juce::FileOutputStream stream(temp.getFile());
+                expect(Result::Numpy::writeArchive(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, {}, shouldAbort));
+            }
+            checkPoints(loadFromNpz(FileDescription{temp.getFile()}, shouldAbort, advancement));
+        }
+
+        beginTest("load npz columns - non-finite values");
+        {
+            auto constexpr nan = std::numeric_limits<float>::quiet_NaN();
+            // clang-format off
+            Results const results(std::vector<Results::Columns>
+            {
+                {{0.0, 0.1, {1.0f, nan, 2.0f, nan}, {nan, 3.0f}}, {0.1, 0.1, {nan}, {}}, {0.2, 0.1, {4.0f}, {5.0f}}}
+            });
+            // clang-format on
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            juce::TemporaryFile temp(".npz");
+            {
+                juce::FileOutputStream stream(temp.getFile());
+                expect(Result::Numpy::writeArchive(stream, results, {-1.0, std::numeric_limits<double>::max()}, {}, {}, shouldAbort));
+            }
+            auto const vResult = loadFromNpz(FileDescription{temp.getFile()}, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            auto const columns = std::get_if<Results>(&vResult) != nullptr ? std::get_if<Results>(&vResult)->getColumns() : nullptr;
+            expect(columns != nullptr && columns->size() == 1_z && columns->front().size() == 3_z);
+            if(columns != nullptr && columns->size() == 1_z && columns->front().size() == 3_z)
+            {
+                auto const expectValues = [this](std::vector<float> const& values, std::vector<float> const& expected)
+                {
+                    expectEquals(values.size(), expected.size(), "Num Values");
+                    for(auto index = 0_z; index < std::min(values.size(), expected.size()); ++index)
+                    {
+                        expect(std::isnan(values[index]) ? std::isnan(expected[index]) : values[index] == expected[index], "Value");
+                    }
+                };
+                // The NaN of the results are preserved and only the padding is removed
+                expectValues(std::get<2_z>(columns->front().at(0_z)), {1.0f, nan, 2.0f, nan});
+                expectValues(std::get<3_z>(columns->front().at(0_z)), {nan, 3.0f});
+                expectValues(std::get<2_z>(columns->front().at(1_z)), {nan});
+                expectValues(std::get<3_z>(columns->front().at(1_z)), {});
+                expectValues(std::get<2_z>(columns->front().at(2_z)), {4.0f});
+                expectValues(std::get<3_z>(columns->front().at(2_z)), {5.0f});
+            }
+        }
+
+        beginTest("load npy points");
+        {
+            std::stringstream input;
+            input.write(TestResultsData::Points_dat, TestResultsData::Points_datSize);
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromBinary(input, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            juce::TemporaryFile temp(".npy");
+            {
+                std::ofstream stream(temp.getFile().getFullPathName().toStdString(), std::ios::out | std::ios::binary);
+                expect(Result::Numpy::writeMatrix(stream, *std::get_if<Results>(&vResult), {-1.0, std::numeric_limits<double>::max()}, {}, {}, shouldAbort));
+            }
+            auto const vData = loadFromNpy(FileDescription{temp.getFile()}, shouldAbort, advancement);
+            expectEquals(vData.index(), 0_z);
+            auto const points = std::get_if<Results>(&vData) != nullptr ? std::get_if<Results>(&vData)->getPoints() : nullptr;
+            expect(points != nullptr && points->size() == 2_z);
+            if(points != nullptr && points->size() == 2_z)
+            {
+                // The matrix doesn't contain the times so the frames are indexed
+                expectEquals(points->at(0_z).size(), 4_z);
+                expectEquals(points->at(1_z).size(), 3_z);
+                expectEquals(std::get<0_z>(points->at(0_z).back()), 3.0);
+                expectEquals(std::get<2_z>(points->at(1_z).back()).value_or(0.0f), 3045.656005859375f);
+            }
+        }
+
+        beginTest("load sdif columns");
+        {
+            auto constexpr numChannels = 2_z;
+            auto constexpr numFrames = 8_z;
+            auto constexpr numBins = 4_z;
+            SdifConverter::Columns columns(numChannels);
+            for(auto channel = 0_z; channel < numChannels; ++channel)
+            {
+                for(auto frame = 0_z; frame < numFrames; ++frame)
+                {
+                    std::vector<float> values(numBins);
+                    for(auto bin = 0_z; bin < numBins; ++bin)
+                    {
+                        values[bin] = static_cast<float>(channel * numBins + bin) + static_cast<float>(frame) * 0.5f;
+                    }
+                    columns[channel].push_back(std::make_tuple(static_cast<double>(frame) * 0.01, 0.0, std::move(values), std::vector<float>{}));
+                }
+            }
+
+            juce::TemporaryFile temp(".sdif");
+            auto const frameId = SdifConverter::getSignature("1TRC");
+            auto const matrixId = SdifConverter::getSignature("1TRC");
+            auto const writeResult = SdifConverter::write(temp.getFile(), {0.0, static_cast<double>(numFrames)}, frameId, matrixId, {}, columns, []()
+                                                          {
+                                                              return true;
+                                                          });
+            expect(writeResult.wasOk(), writeResult.getErrorMessage());
+
+            std::atomic<bool> shouldAbort{false};
+            std::atomic<float> advancement{0.0f};
+            auto const vResult = loadFromSdif(temp.getFile(), frameId, matrixId, {}, {}, shouldAbort, advancement);
+            expectEquals(vResult.index(), 0_z);
+            auto const results = std::get_if<Results>(&vResult) != nullptr ? std::get_if<Results>(&vResult)->getColumns() : nullptr;
+            expect(results != nullptr && results->size() == numChannels);
+            if(results != nullptr && results->size() == numChannels)
+            {
+                for(auto channel = 0_z; channel < numChannels; ++channel)
+                {
+                    expectEquals(results->at(channel).size(), numFrames);
+                    for(auto frame = 0_z; frame < std::min(results->at(channel).size(), numFrames); ++frame)
+                    {
+                        auto const& result = results->at(channel).at(frame);
+                        expectEquals(std::get<0_z>(result), std::get<0_z>(columns[channel][frame]));
+                        expect(std::get<2_z>(result) == std::get<2_z>(columns[channel][frame]), "Values");
+                    }
+                }
+            }
+        }
+
         beginTest("load pd markers");
         {
             std::stringstream stream;
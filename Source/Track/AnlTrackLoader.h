@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AnlTrackModel.h"
+#include "AnlTrackProfiler.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -10,7 +11,7 @@ namespace Track
     : private juce::AsyncUpdater
     {
     public:
-        Loader() = default;
+        explicit Loader(Profiler& profiler);
         ~Loader() override;
 
         void loadAnalysis(FileDescription const& fd);
@@ -25,10 +26,13 @@ namespace Track
         static std::variant<Results, juce::String> loadFromFile(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromJson(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromBinary(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+        static std::variant<Results, juce::String> openFromBinary(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromCsv(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromReaper(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromCue(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static std::variant<Results, juce::String> loadFromSdif(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+        static std::variant<Results, juce::String> loadFromNpy(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+        static std::variant<Results, juce::String> loadFromNpz(FileDescription const& fileInfo, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
         static juce::String getWildCardForAllFormats();
 
         static std::tuple<juce::Result, FileDescription> getFileDescription(juce::File const& file, double sampleRate);
@@ -47,6 +51,7 @@ namespace Track
         // juce::AsyncUpdater
         void handleAsyncUpdate() override;
 
+        Profiler& mProfiler;
         std::atomic<bool> mShouldAbort{false};
         std::atomic<float> mAdvancement{0.0f};
         std::mutex mLoadingMutex;
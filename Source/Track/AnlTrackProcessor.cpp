@@ -4,6 +4,11 @@
 
 ANALYSE_FILE_BEGIN
 
+Track::Processor::Processor(Profiler& profiler)
+: mProfiler(profiler)
+{
+}
+
 Track::Processor::~Processor()
 {
     std::unique_lock<std::mutex> lock(mAnalysisMutex);
@@ -16,7 +21,7 @@ void Track::Processor::stopAnalysis()
     abortAnalysis(lock);
 }
 
-bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatReader& reader, InputStates inputStates)
+bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatReader& reader, InputStates inputStates, SharedAnalyzer* sharedAnalyzer)
 {
     std::unique_lock<std::mutex> lock(mAnalysisMutex, std::try_to_lock);
     MiscWeakAssert(lock.owns_lock());
@@ -41,7 +46,8 @@ bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatRe
                                       {
                                           MiscDebug("Track", "Processor thread launched");
                                           juce::Thread::setCurrentThreadName("Track::Processor::Process");
-                                          auto result = runWaveformAnalysis(reader, [this](float advancement)
+                                          Tracer::ScopedEvent const scopedEvent("Track::Processor::runWaveformAnalysis", "analysis");
+                                          auto result = runWaveformAnalysis(reader, mProfiler, [this](float advancement)
                                                                             {
                                                                                 mAdvancement.store(advancement);
                                                                                 return !mShouldAbort.load();
@@ -66,6 +72,35 @@ bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatRe
         state.stepSize = state.blockSize;
     }
 
+    // The tracks with inputs can't share the analysis because the plugin uses the results of the inputs
+    if(sharedAnalyzer != nullptr && inputStates.empty())
+    {
+        auto request = sharedAnalyzer->join(key, state);
+        if(request != nullptr)
+        {
+            mChrono.start();
+            mAnalysisProcess = std::async(std::launch::async, [this, req = std::move(request)]() mutable
+                                          {
+                                              MiscDebug("Track", "Processor thread launched");
+                                              juce::Thread::setCurrentThreadName("Track::Processor::Process");
+                                              Tracer::ScopedEvent const scopedEvent("Track::Processor::runSharedAnalysis", "analysis");
+                                              Plugin::Description description;
+                                              auto result = runSharedAnalysis(std::move(req), description, mProfiler, [this](float advancement)
+                                                                              {
+                                                                                  mAdvancement.store(advancement);
+                                                                                  return !mShouldAbort.load();
+                                                                              });
+                                              auto fresult = std::make_tuple(std::move(std::get<0>(result)), std::move(std::get<1>(result)), std::move(description));
+                                              if(!mShouldAbort.load())
+                                              {
+                                                  triggerAsyncUpdate();
+                                              }
+                                              return fresult;
+                                          });
+            return true;
+        }
+    }
+
     auto processor = Plugin::Processor::create(key, state, reader);
     MiscWeakAssert(processor != nullptr);
     if(processor == nullptr)
@@ -79,7 +114,8 @@ bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatRe
                                   {
                                       MiscDebug("Track", "Processor thread launched");
                                       juce::Thread::setCurrentThreadName("Track::Processor::Process");
-                                      auto result = runPluginAnalysis(*proc, inputs, [&, this](float advancement)
+                                      Tracer::ScopedEvent const scopedEvent("Track::Processor::runPluginAnalysis", "analysis");
+                                      auto result = runPluginAnalysis(*proc, inputs, mProfiler, [&, this](float advancement)
                                                                       {
                                                                           mAdvancement.store(advancement);
                                                                           return !mShouldAbort.load();
@@ -96,6 +132,7 @@ bool Track::Processor::runAnalysis(Accessor const& accessor, juce::AudioFormatRe
 
 void Track::Processor::handleAsyncUpdate()
 {
+    Tracer::ScopedEvent const scopedEvent("Track::Processor::handleAsyncUpdate", "notification");
     std::unique_lock<std::mutex> lock(mAnalysisMutex);
     if(mAnalysisProcess.valid())
     {
@@ -156,8 +193,10 @@ void Track::Processor::abortAnalysis(std::unique_lock<std::mutex>& lock)
     }
 }
 
-Track::Processor::ProcessResult Track::Processor::runWaveformAnalysis(juce::AudioFormatReader& reader, std::function<bool(float)> callback)
+Track::Processor::ProcessResult Track::Processor::runWaveformAnalysis(juce::AudioFormatReader& reader, Profiler& profiler, std::function<bool(float)> callback)
 {
+    auto const startTime = juce::Time::getHighResolutionTicks();
+    auto readingDuration = 0.0;
     if(callback != nullptr && !callback(0.0f))
     {
         return createEmptyProcessResult(createError(juce::translate("Aborted")));
@@ -203,7 +242,10 @@ Track::Processor::ProcessResult Track::Processor::runWaveformAnalysis(juce::Audi
 
         auto const remainingSize = reader.lengthInSamples - index;
         auto const blockSize = std::min(remainingSize, static_cast<juce::int64>(buffer.getNumSamples()));
-        if(!reader.read(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), index, static_cast<int>(blockSize)))
+        auto const readingTime = juce::Time::getHighResolutionTicks();
+        auto const readingSucceeded = reader.read(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), index, static_cast<int>(blockSize));
+        readingDuration += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - readingTime);
+        if(!readingSucceeded)
         {
 
             return createEmptyProcessResult(createError(juce::translate("Failed to read audio data")));
@@ -265,10 +307,12 @@ Track::Processor::ProcessResult Track::Processor::runWaveformAnalysis(juce::Audi
     {
         return createEmptyProcessResult(createError(juce::translate("Aborted")));
     }
+    profiler.addDuration(Profiler::Stage::reading, readingDuration);
+    profiler.addDuration(Profiler::Stage::processing, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTime) - readingDuration);
     return std::make_tuple(juce::Result::ok(), Track::Results(std::move(points)));
 }
 
-Track::Processor::ProcessResult Track::Processor::runPluginAnalysis(Plugin::Processor& processor, InputStates const& inputStates, std::function<bool(float)> callback)
+std::tuple<juce::Result, Track::Processor::PluginResults> Track::Processor::runPluginProcessing(Plugin::Processor& processor, InputStates const& inputStates, Profiler& profiler, std::function<bool(float)> callback)
 {
     auto const tryProcess = [&](std::function<juce::Result(void)> fn) -> juce::Result
     {
@@ -288,18 +332,21 @@ Track::Processor::ProcessResult Track::Processor::runPluginAnalysis(Plugin::Proc
 
     if(callback != nullptr && !callback(0.0f))
     {
-        return createEmptyProcessResult(createError(juce::translate("Aborted")));
+        return std::make_tuple(createError(juce::translate("Aborted")), PluginResults{});
     }
 
     MiscDebug("Track::Processor", "Preparing analysis...");
-    std::vector<std::vector<Plugin::Result>> results;
-    auto result = tryProcess([&]()
-                             {
-                                 return processor.prepareToAnalyze(results);
-                             });
+    PluginResults results;
+    auto result = profiler.measure(Profiler::Stage::processing, [&]()
+                                   {
+                                       return tryProcess([&]()
+                                                         {
+                                                             return processor.prepareToAnalyze(results);
+                                                         });
+                                   });
     if(result.failed())
     {
-        return createEmptyProcessResult(std::move(result));
+        return std::make_tuple(std::move(result), PluginResults{});
     }
 
     MiscDebug("Track::Processor", "Setting inputs...");
@@ -314,7 +361,10 @@ Track::Processor::ProcessResult Track::Processor::runPluginAnalysis(Plugin::Proc
         if(it != inputs.cend())
         {
             auto const featureIndex = static_cast<size_t>(std::distance(inputs.cbegin(), it));
-            auto allData = Tools::convert(*it, inputState.second.first, inputState.second.second);
+            auto allData = profiler.measure(Profiler::Stage::converting, [&]()
+                                            {
+                                                return Tools::convert(*it, inputState.second.first, inputState.second.second);
+                                            });
             for(auto channelIndex = 0_z; channelIndex < allData.size(); ++channelIndex)
             {
                 if(channelIndex >= inputData.size())
@@ -336,31 +386,89 @@ Track::Processor::ProcessResult Track::Processor::runPluginAnalysis(Plugin::Proc
                         });
     if(result.failed())
     {
-        return createEmptyProcessResult(std::move(result));
+        return std::make_tuple(std::move(result), PluginResults{});
     }
     MiscDebug("Track::Processor", "Performing analysis...");
 
+    auto const performTime = juce::Time::getHighResolutionTicks();
     auto performResult = processor.performNextAudioBlock(results);
     while(std::get<1>(performResult))
     {
         if(callback != nullptr && !callback(processor.getAdvancement()))
         {
-            return std::make_tuple(juce::Result::fail(juce::translate("Aborted")), Track::Results{});
+            return std::make_tuple(juce::Result::fail(juce::translate("Aborted")), PluginResults{});
         }
         performResult = processor.performNextAudioBlock(results);
     }
+    // The time spent reading the audio file is excluded from the processing time
+    auto const readingDuration = processor.getReadingDuration();
+    profiler.addDuration(Profiler::Stage::reading, readingDuration);
+    profiler.addDuration(Profiler::Stage::processing, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - performTime) - readingDuration);
     if(std::get<0>(performResult).failed())
     {
-        return createEmptyProcessResult(std::get<0>(performResult));
+        return std::make_tuple(std::get<0>(performResult), PluginResults{});
     }
+    return std::make_tuple(juce::Result::ok(), std::move(results));
+}
 
+Track::Processor::ProcessResult Track::Processor::runPluginAnalysis(Plugin::Processor& processor, InputStates const& inputStates, Profiler& profiler, std::function<bool(float)> callback)
+{
+    auto processing = runPluginProcessing(processor, inputStates, profiler, callback);
+    if(std::get<0>(processing).failed())
+    {
+        return createEmptyProcessResult(std::move(std::get<0>(processing)));
+    }
+    auto& results = std::get<1>(processing);
+    MiscWeakAssert(!results.empty());
+    if(results.empty())
+    {
+        return createEmptyProcessResult(createError(juce::translate("Unknown")));
+    }
+    return runConversion(processor.getOutput(), results[0_z], profiler, callback);
+}
+
+Track::Processor::ProcessResult Track::Processor::runSharedAnalysis(std::unique_ptr<SharedAnalyzer::Request> request, Plugin::Description& description, Profiler& profiler, std::function<bool(float)> callback)
+{
+    MiscWeakAssert(request != nullptr);
+    if(request == nullptr)
+    {
+        return createEmptyProcessResult(createError(juce::translate("Unknown")));
+    }
+
+    MiscDebug("Track::Processor", "Waiting for the shared analysis...");
+    while(!request->waitForEnd(5))
+    {
+        if(callback != nullptr && !callback(request->getAdvancement()))
+        {
+            return createEmptyProcessResult(createError(juce::translate("Aborted")));
+        }
+    }
+    auto feature = request->getFeature();
+    // The request is released so the plugins and the audio reader of the analysis can be freed before the conversion
+    request.reset();
+
+    profiler.addDuration(Profiler::Stage::reading, feature.readingDuration);
+    profiler.addDuration(Profiler::Stage::processing, feature.processingDuration);
+    if(feature.result.failed())
+    {
+        return createEmptyProcessResult(std::move(feature.result));
+    }
+    description = std::move(feature.description);
+    return runConversion(feature.output, feature.results, profiler, callback);
+}
+
+Track::Processor::ProcessResult Track::Processor::runConversion(Plugin::Output const& output, std::vector<std::vector<Plugin::Result>>& results, Profiler& profiler, std::function<bool(float)> callback)
+{
     MiscDebug("Track::Processor", "Converting results...");
     auto processed = false;
-    auto const cresults = Tools::convert(processor.getOutput(), results, [&]()
-                                         {
-                                             processed = callback == nullptr || callback(1.0f);
-                                             return processed;
-                                         });
+    auto const cresults = profiler.measure(Profiler::Stage::converting, [&]()
+                                           {
+                                               return Tools::convert(output, results, [&]()
+                                                                     {
+                                                                         processed = callback == nullptr || callback(1.0f);
+                                                                         return processed;
+                                                                     });
+                                           });
     if(!processed)
     {
         return createEmptyProcessResult(createError(juce::translate("Aborted")));
@@ -2,6 +2,8 @@
 
 #include "../Plugin/AnlPluginProcessor.h"
 #include "AnlTrackModel.h"
+#include "AnlTrackProfiler.h"
+#include "AnlTrackSharedAnalyzer.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -14,10 +16,13 @@ namespace Track
         // [input.identifier, [result, thresholds]]
         using InputStates = std::map<juce::String, std::pair<Results, std::vector<std::optional<float>>>>;
 
-        Processor() = default;
+        explicit Processor(Profiler& profiler);
         ~Processor() override;
 
-        bool runAnalysis(Accessor const& accessor, juce::AudioFormatReader& reader, InputStates inputStates);
+        //! @brief Runs the analysis of the track.
+        //! @details If the shared analyzer is defined and the track has no input, the plugin is run once with the
+        //! tracks that use the same plugin with the same state.
+        bool runAnalysis(Accessor const& accessor, juce::AudioFormatReader& reader, InputStates inputStates, SharedAnalyzer* sharedAnalyzer = nullptr);
         void stopAnalysis();
         bool isRunning() const;
         float getAdvancement() const;
@@ -25,6 +30,12 @@ namespace Track
         std::function<void(juce::Result const&, Results const&, Plugin::Description const& description)> onAnalysisEnded = nullptr;
         std::function<void(void)> onAnalysisAborted = nullptr;
 
+        // [features[channels[results]]]
+        using PluginResults = std::vector<std::vector<std::vector<Plugin::Result>>>;
+
+        //! @brief Prepares the processor, sets the inputs and performs the analysis of all the features of the processor.
+        static std::tuple<juce::Result, PluginResults> runPluginProcessing(Plugin::Processor& processor, InputStates const& inputStates, Profiler& profiler, std::function<bool(float)> callback);
+
     private:
         void abortAnalysis(std::unique_lock<std::mutex>& lock);
 
@@ -32,11 +43,14 @@ namespace Track
         void handleAsyncUpdate() override;
 
         using ProcessResult = std::tuple<juce::Result, Results>;
-        static ProcessResult runWaveformAnalysis(juce::AudioFormatReader& reader, std::function<bool(float)> callback);
-        static ProcessResult runPluginAnalysis(Plugin::Processor& processor, InputStates const& inputStates, std::function<bool(float)> callback);
+        static ProcessResult runWaveformAnalysis(juce::AudioFormatReader& reader, Profiler& profiler, std::function<bool(float)> callback);
+        static ProcessResult runPluginAnalysis(Plugin::Processor& processor, InputStates const& inputStates, Profiler& profiler, std::function<bool(float)> callback);
+        static ProcessResult runSharedAnalysis(std::unique_ptr<SharedAnalyzer::Request> request, Plugin::Description& description, Profiler& profiler, std::function<bool(float)> callback);
+        static ProcessResult runConversion(Plugin::Output const& output, std::vector<std::vector<Plugin::Result>>& results, Profiler& profiler, std::function<bool(float)> callback);
         static ProcessResult createEmptyProcessResult(juce::Result result);
         static juce::Result createError(juce::String const& reason);
 
+        Profiler& mProfiler;
         std::unique_ptr<juce::AudioFormatReader> mAudioFormatReaderManager;
         std::atomic<bool> mShouldAbort{false};
         std::future<std::tuple<juce::Result, Results, Plugin::Description>> mAnalysisProcess;
@@ -0,0 +1,114 @@
+#include "AnlTrackProfiler.h"
+
+ANALYSE_FILE_BEGIN
+
+Track::Profiler::ScopedStage::ScopedStage(Profiler& profiler, Stage stage)
+: mProfiler(profiler)
+, mStage(stage)
+, mStartTime(juce::Time::getHighResolutionTicks())
+{
+}
+
+Track::Profiler::ScopedStage::~ScopedStage()
+{
+    mProfiler.addDuration(mStage, juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - mStartTime));
+}
+
+void Track::Profiler::addDuration(Stage stage, double duration)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mSummary.durations[static_cast<size_t>(stage)] += duration;
+}
+
+void Track::Profiler::updateMemory(size_t size)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mSummary.peakMemory = std::max(mSummary.peakMemory, size);
+}
+
+void Track::Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mSummary = {};
+}
+
+Track::Profiler::Summary Track::Profiler::getSummary() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mSummary;
+}
+
+juce::String Track::Profiler::getStageName(Stage stage)
+{
+    switch(stage)
+    {
+        case Stage::reading:
+            return "read";
+        case Stage::processing:
+            return "process";
+        case Stage::converting:
+            return "convert";
+        case Stage::loading:
+            return "load";
+        case Stage::rendering:
+            return "render";
+        case Stage::exporting:
+            return "export";
+    }
+    return {};
+}
+
+size_t Track::Profiler::getMemorySize(Results const& results)
+{
+    // The size is an estimation that includes the containers but not the allocator overhead
+    auto size = 0_z;
+    if(auto const markers = results.getMarkers())
+    {
+        for(auto const& channel : *markers)
+        {
+            size += channel.capacity() * sizeof(Result::Data::Marker);
+            for(auto const& marker : channel)
+            {
+                size += std::get<2_z>(marker).capacity() + std::get<3_z>(marker).capacity() * sizeof(float);
+            }
+        }
+    }
+    else if(auto const points = results.getPoints())
+    {
+        for(auto const& channel : *points)
+        {
+            size += channel.capacity() * sizeof(Result::Data::Point);
+            for(auto const& point : channel)
+            {
+                size += std::get<3_z>(point).capacity() * sizeof(float);
+            }
+        }
+    }
+    else if(auto const columns = results.getColumns())
+    {
+        for(auto const& channel : *columns)
+        {
+            size += channel.capacity() * sizeof(Result::Data::Column);
+            for(auto const& column : channel)
+            {
+                size += (std::get<2_z>(column).capacity() + std::get<3_z>(column).capacity()) * sizeof(float);
+            }
+        }
+    }
+    return size;
+}
+
+nlohmann::json Track::Profiler::toJson(Summary const& summary)
+{
+    auto durations = nlohmann::json::object();
+    for(auto const stage : magic_enum::enum_values<Stage>())
+    {
+        durations[getStageName(stage).toStdString()] = summary.durations[static_cast<size_t>(stage)];
+    }
+    auto json = nlohmann::json::object();
+    json["durations"] = std::move(durations);
+    json["peakMemory"] = summary.peakMemory;
+    return json;
+}
+
+ANALYSE_FILE_END
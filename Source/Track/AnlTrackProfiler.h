@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AnlTrackModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Track
+{
+    //! @brief Records the durations of the stages of a track and the peak memory used by its results.
+    //! @details Unlike the chronometers, the profiler is enabled in release builds. The durations are accumulated
+    //! from the threads that perform the stages so the profiler can be used from any thread.
+    class Profiler
+    {
+    public:
+        // clang-format off
+        enum class Stage
+        {
+              reading
+            , processing
+            , converting
+            , loading
+            , rendering
+            , exporting
+        };
+        // clang-format on
+
+        struct Summary
+        {
+            std::array<double, magic_enum::enum_count<Stage>()> durations{}; // In seconds
+            size_t peakMemory{0_z};                                           // In bytes
+        };
+
+        //! @brief Measures the duration of a stage during its lifetime.
+        class ScopedStage
+        {
+        public:
+            ScopedStage(Profiler& profiler, Stage stage);
+            ~ScopedStage();
+
+        private:
+            Profiler& mProfiler;
+            Stage const mStage;
+            juce::int64 const mStartTime;
+        };
+
+        Profiler() = default;
+        ~Profiler() = default;
+
+        void addDuration(Stage stage, double duration);
+        void updateMemory(size_t size);
+        void reset();
+        Summary getSummary() const;
+
+        //! @brief Measures the duration of a function as a stage.
+        template <typename Fn>
+        auto measure(Stage stage, Fn&& fn)
+        {
+            ScopedStage const scopedStage(*this, stage);
+            return fn();
+        }
+
+        static juce::String getStageName(Stage stage);
+        static size_t getMemorySize(Results const& results);
+        static nlohmann::json toJson(Summary const& summary);
+
+    private:
+        mutable std::mutex mMutex;
+        Summary mSummary;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Profiler)
+    };
+} // namespace Track
+
+ANALYSE_FILE_END
@@ -170,6 +170,54 @@ namespace Track
             juce::GlyphArrangement mGlyphArrangement;
         };
 
+        class LabelCache
+        {
+        public:
+            struct Entry
+            {
+                juce::String text;
+                juce::GlyphArrangement glyphs;
+                int width;
+            };
+
+            static LabelCache& get(juce::Font const& font, juce::String const& unit)
+            {
+                thread_local LabelCache cache;
+                if(cache.mFont != font || cache.mUnit != unit || cache.mEntries.size() > maxEntries)
+                {
+                    cache.mFont = font;
+                    cache.mUnit = unit;
+                    cache.mEntries.clear();
+                }
+                return cache;
+            }
+
+            Entry const& getEntry(std::string const& label)
+            {
+                auto it = mEntries.find(label);
+                if(it != mEntries.end())
+                {
+                    return it->second;
+                }
+                Entry entry;
+                entry.text = juce::String(label) + mUnit;
+                entry.glyphs.addLineOfText(mFont, entry.text, 0.0f, 0.0f);
+                entry.width = juce::roundToInt(entry.glyphs.getBoundingBox(0, -1, true).getWidth());
+                return mEntries.emplace(label, std::move(entry)).first->second;
+            }
+
+        private:
+            LabelCache() = default;
+
+            // The entries are cleared at the beginning of a paint call so
+            // references remain valid during the whole paint
+            static constexpr size_t maxEntries = 16384_z;
+
+            juce::Font mFont{juce::FontOptions{}};
+            juce::String mUnit;
+            std::unordered_map<std::string, Entry> mEntries;
+        };
+
         static constexpr int outsideGridHeight = 16;
         static constexpr int outsideGridWidth = 72;
 
@@ -532,11 +580,12 @@ void Track::Renderer::paintMarkers(juce::Graphics& g, juce::Rectangle<int> const
 
     juce::RectangleList<float> ticks;
     juce::RectangleList<float> durations;
-    std::vector<std::tuple<juce::String, int, int>> labels;
+    std::vector<std::tuple<LabelCache::Entry const*, int, int>> labels;
     auto const showLabel = !colours.text.isTransparent();
     auto const showDuration = !colours.duration.isTransparent();
     auto const font = g.getCurrentFont();
     auto const minTextWidth = juce::GlyphArrangement::getStringWidthInt(font, "...") + 2;
+    auto& labelCache = LabelCache::get(font, unit);
 
     auto const y = fbounds.getY();
     auto const height = fbounds.getHeight();
@@ -597,12 +646,12 @@ void Track::Renderer::paintMarkers(juce::Graphics& g, juce::Rectangle<int> const
 
             if(showLabel && !std::get<2>(*it).empty())
             {
-                auto const text = juce::String(std::get<2>(*it)) + unit;
+                auto const& entry = labelCache.getEntry(std::get<2>(*it));
                 auto const textX = static_cast<int>(std::round(x)) + 2;
-                auto const textWidth = juce::GlyphArrangement::getStringWidthInt(font, text);
+                auto const textWidth = entry.width;
                 if(labels.empty())
                 {
-                    labels.push_back(std::make_tuple(text, textX, textWidth));
+                    labels.push_back(std::make_tuple(&entry, textX, textWidth));
                 }
                 else
                 {
@@ -612,12 +661,12 @@ void Track::Renderer::paintMarkers(juce::Graphics& g, juce::Rectangle<int> const
                     {
                         auto const maxPreviousTextWidth = textX - previousTextX - 2;
                         std::get<2>(labels.back()) = std::min(previousTextWidth, maxPreviousTextWidth);
-                        labels.push_back(std::make_tuple(text, textX, textWidth));
+                        labels.push_back(std::make_tuple(&entry, textX, textWidth));
                     }
                     else
                     {
                         // Marker is too close so we remove the previous one
-                        labels.back() = std::make_tuple(text, textX, textWidth);
+                        labels.back() = std::make_tuple(&entry, textX, textWidth);
                     }
                 }
             }
@@ -673,10 +722,20 @@ void Track::Renderer::paintMarkers(juce::Graphics& g, juce::Rectangle<int> const
             return bounds.getY() + static_cast<int>(std::ceil(labelLayout.position));
         };
         auto const position = getPositionY();
+        auto const baseline = static_cast<float>(position) + (static_cast<float>(fontHeight) - font.getHeight()) / 2.0f + font.getAscent();
         g.setColour(colours.text);
         for(auto const& label : labels)
         {
-            g.drawText(std::get<0>(label), std::get<1>(label), position, std::get<2>(label), fontHeight, juce::Justification::left, true);
+            auto const* entry = std::get<0>(label);
+            if(std::get<2>(label) >= entry->width)
+            {
+                // The label fits so the cached glyphs can be used directly
+                entry->glyphs.draw(g, juce::AffineTransform::translation(static_cast<float>(std::get<1>(label)), baseline));
+            }
+            else
+            {
+                g.drawText(entry->text, std::get<1>(label), position, std::get<2>(label), fontHeight, juce::Justification::left, true);
+            }
         }
     }
 }
@@ -0,0 +1,335 @@
+#include "AnlTrackSharedAnalyzer.h"
+#include "AnlTrackProcessor.h"
+
+ANALYSE_FILE_BEGIN
+
+struct Track::SharedAnalyzer::Analysis
+{
+    ~Analysis()
+    {
+        if(process.valid())
+        {
+            process.wait();
+        }
+    }
+
+    std::string identifier;
+    Plugin::State state;
+    std::unique_ptr<juce::AudioFormatReader> reader;
+    std::unique_ptr<Plugin::Processor> processor;
+    std::vector<size_t> features; // The feature index of each request
+    std::atomic<size_t> numRequests{0_z};
+    std::atomic<float> advancement{0.0f};
+    std::future<void> process;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool ended{false};
+    std::vector<Feature> results; // The results of each request
+};
+
+Track::SharedAnalyzer::Request::Request(std::shared_ptr<Analysis> analysis, size_t index)
+: mAnalysis(std::move(analysis))
+, mIndex(index)
+{
+    mAnalysis->numRequests.fetch_add(1_z);
+}
+
+Track::SharedAnalyzer::Request::~Request()
+{
+    mAnalysis->numRequests.fetch_sub(1_z);
+}
+
+bool Track::SharedAnalyzer::Request::waitForEnd(int milliseconds) const
+{
+    std::unique_lock<std::mutex> lock(mAnalysis->mutex);
+    return mAnalysis->condition.wait_for(lock, std::chrono::milliseconds(milliseconds), [this]()
+                                         {
+                                             return mAnalysis->ended;
+                                         });
+}
+
+float Track::SharedAnalyzer::Request::getAdvancement() const
+{
+    return mAnalysis->advancement.load();
+}
+
+Track::SharedAnalyzer::Feature Track::SharedAnalyzer::Request::getFeature()
+{
+    std::unique_lock<std::mutex> lock(mAnalysis->mutex);
+    MiscWeakAssert(mAnalysis->ended && mIndex < mAnalysis->results.size());
+    if(!mAnalysis->ended || mIndex >= mAnalysis->results.size())
+    {
+        Feature feature;
+        feature.result = juce::Result::fail(juce::translate("Aborted"));
+        return feature;
+    }
+    return std::move(mAnalysis->results[mIndex]);
+}
+
+Track::SharedAnalyzer::SharedAnalyzer(ReaderCreator readerCreator)
+: mReaderCreator(std::move(readerCreator))
+{
+}
+
+Track::SharedAnalyzer::~SharedAnalyzer()
+{
+    cancelPendingUpdate();
+}
+
+std::unique_ptr<Track::SharedAnalyzer::Request> Track::SharedAnalyzer::join(Plugin::Key const& key, Plugin::State const& state)
+{
+    auto it = std::find_if(mPendingAnalyses.cbegin(), mPendingAnalyses.cend(), [&](auto const& analysis)
+                           {
+                               return analysis->identifier == key.identifier && analysis->state == state;
+                           });
+    if(it != mPendingAnalyses.cend())
+    {
+        auto& analysis = *it->get();
+        // The feature is added before the request so an invalid feature doesn't change the analysis
+        analysis.features.push_back(analysis.processor->addFeature(key.feature));
+        MiscDebug("SharedAnalyzer", "Join the analysis of " + juce::String(key.identifier) + " with " + juce::String(key.feature));
+        return std::unique_ptr<Request>(new Request(*it, analysis.features.size() - 1_z));
+    }
+
+    auto reader = mReaderCreator != nullptr ? mReaderCreator() : nullptr;
+    if(reader == nullptr)
+    {
+        return nullptr;
+    }
+    auto processor = Plugin::Processor::create(key, state, *reader.get());
+    if(processor == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto analysis = std::make_shared<Analysis>();
+    analysis->identifier = key.identifier;
+    analysis->state = state;
+    analysis->reader = std::move(reader);
+    analysis->processor = std::move(processor);
+    analysis->features.push_back(0_z);
+    mPendingAnalyses.push_back(analysis);
+    triggerAsyncUpdate();
+    return std::unique_ptr<Request>(new Request(std::move(analysis), 0_z));
+}
+
+void Track::SharedAnalyzer::handleAsyncUpdate()
+{
+    launchPendingAnalyses();
+}
+
+void Track::SharedAnalyzer::launchPendingAnalyses()
+{
+    cancelPendingUpdate();
+    // The analyses without requests have been aborted before being launched
+    for(auto& analysis : mPendingAnalyses)
+    {
+        if(analysis->numRequests.load() > 0_z)
+        {
+            launch(*analysis.get());
+        }
+    }
+    mPendingAnalyses.clear();
+}
+
+void Track::SharedAnalyzer::launch(Analysis& analysis)
+{
+    MiscDebug("SharedAnalyzer", "Launch the analysis of " + juce::String(analysis.identifier) + " for " + juce::String(analysis.features.size()) + " track(s)");
+    analysis.process = std::async(std::launch::async, [&analysis]()
+                                  {
+                                      juce::Thread::setCurrentThreadName("Track::SharedAnalyzer::Process");
+                                      Tracer::ScopedEvent const scopedEvent("Track::SharedAnalyzer::runAnalysis", "analysis");
+                                      Profiler profiler;
+                                      auto processing = Processor::runPluginProcessing(*analysis.processor.get(), {}, profiler, [&](float advancement)
+                                                                                       {
+                                                                                           analysis.advancement.store(advancement);
+                                                                                           return analysis.numRequests.load() > 0_z;
+                                                                                       });
+
+                                      // The durations are shared by the tracks so the sum of the durations of the tracks remains the duration of the analysis
+                                      auto const summary = profiler.getSummary();
+                                      auto const numRequests = static_cast<double>(analysis.features.size());
+                                      auto const readingDuration = summary.durations[static_cast<size_t>(Profiler::Stage::reading)] / numRequests;
+                                      auto const processingDuration = summary.durations[static_cast<size_t>(Profiler::Stage::processing)] / numRequests;
+
+                                      auto& result = std::get<0_z>(processing);
+                                      auto& pluginResults = std::get<1_z>(processing);
+                                      std::vector<Feature> features;
+                                      features.resize(analysis.features.size());
+                                      for(auto index = 0_z; index < analysis.features.size(); ++index)
+                                      {
+                                          auto const featureIndex = analysis.features[index];
+                                          auto& feature = features[index];
+                                          feature.result = result;
+                                          feature.readingDuration = readingDuration;
+                                          feature.processingDuration = processingDuration;
+                                          if(result.failed() || featureIndex >= pluginResults.size())
+                                          {
+                                              continue;
+                                          }
+                                          feature.output = analysis.processor->getOutput(featureIndex);
+                                          feature.description = analysis.processor->getDescription(featureIndex);
+                                          // The results are moved to the last request that uses the feature and copied to the others
+                                          auto const isLast = std::find(std::next(analysis.features.cbegin(), static_cast<long>(index + 1_z)), analysis.features.cend(), featureIndex) == analysis.features.cend();
+                                          if(isLast)
+                                          {
+                                              feature.results = std::move(pluginResults[featureIndex]);
+                                          }
+                                          else
+                                          {
+                                              feature.results = pluginResults[featureIndex];
+                                          }
+                                      }
+
+                                      std::unique_lock<std::mutex> lock(analysis.mutex);
+                                      analysis.results = std::move(features);
+                                      analysis.ended = true;
+                                      lock.unlock();
+                                      analysis.condition.notify_all();
+                                  });
+}
+
+class TrackSharedAnalyzerUnitTest
+: public juce::UnitTest
+{
+public:
+    TrackSharedAnalyzerUnitTest()
+    : juce::UnitTest("SharedAnalyzer", "Track")
+    {
+    }
+
+    ~TrackSharedAnalyzerUnitTest() override = default;
+
+    void runTest() override
+    {
+        // A deterministic signal with a sliding pitch so the centroids change over time
+        class Reader
+        : public juce::AudioFormatReader
+        {
+        public:
+            Reader()
+            : juce::AudioFormatReader(nullptr, "InternalTest")
+            {
+                sampleRate = 44100.0;
+                bitsPerSample = sizeof(float);
+                numChannels = 1;
+                lengthInSamples = 441000;
+                usesFloatingPointData = true;
+            }
+
+            ~Reader() override = default;
+
+            bool readSamples(int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer, juce::int64 startSampleInFile, int numSamples) override
+            {
+                for(int channelIndex = 0; channelIndex < numDestChannels; ++channelIndex)
+                {
+                    auto* channel = reinterpret_cast<float*>(destChannels[channelIndex]) + startOffsetInDestBuffer;
+                    for(int sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex)
+                    {
+                        auto const position = static_cast<juce::int64>(sampleIndex) + startSampleInFile;
+                        auto const time = static_cast<double>(position) / sampleRate;
+                        auto const phase = 2.0 * juce::MathConstants<double>::pi * (220.0 + 110.0 * time) * time;
+                        channel[static_cast<size_t>(sampleIndex)] = position < lengthInSamples ? static_cast<float>(0.5 * std::sin(phase) + 0.25 * std::sin(3.0 * phase)) : 0.0f;
+                    }
+                }
+                return true;
+            }
+        };
+
+        auto const createReader = []() -> std::unique_ptr<juce::AudioFormatReader>
+        {
+            return std::make_unique<Reader>();
+        };
+
+        // The spectral centroid of the vamp example plugins has two outputs
+        Plugin::Key const linearKey{"vamp-example-plugins:spectralcentroid", "linearcentroid"};
+        Plugin::Key const logKey{"vamp-example-plugins:spectralcentroid", "logcentroid"};
+        Plugin::State state;
+        state.blockSize = 1024_z;
+        state.stepSize = 512_z;
+
+        auto const join = [&](Track::SharedAnalyzer& analyzer, Plugin::Key const& key) -> std::unique_ptr<Track::SharedAnalyzer::Request>
+        {
+            try
+            {
+                return analyzer.join(key, state);
+            }
+            catch(std::exception& e)
+            {
+                expect(false, "The vamp example plugins are not available (VAMP_PATH): " + juce::String(e.what()));
+            }
+            return nullptr;
+        };
+
+        auto const getFeature = [&](Track::SharedAnalyzer::Request& request)
+        {
+            expect(request.waitForEnd(60000), "Analysis ended");
+            auto feature = request.getFeature();
+            expect(feature.result.wasOk(), feature.result.getErrorMessage());
+            return feature;
+        };
+
+        auto const expectSameResults = [&](Track::SharedAnalyzer::Feature const& feature, Track::SharedAnalyzer::Feature const& expected)
+        {
+            expectEquals(juce::String(feature.output.identifier), juce::String(expected.output.identifier));
+            expectEquals(feature.results.size(), expected.results.size(), "Num Channels");
+            expect(!expected.results.empty() && !expected.results.front().empty(), "Results");
+            for(auto channel = 0_z; channel < std::min(feature.results.size(), expected.results.size()); ++channel)
+            {
+                auto const& results = feature.results[channel];
+                auto const& expectedResults = expected.results[channel];
+                expectEquals(results.size(), expectedResults.size(), "Num Results");
+                auto const isSame = std::equal(results.cbegin(), results.cend(), expectedResults.cbegin(), expectedResults.cend(), [](auto const& lhs, auto const& rhs)
+                                               {
+                                                   return lhs.timestamp == rhs.timestamp && lhs.values == rhs.values;
+                                               });
+                expect(isSame, "Same Results");
+            }
+        };
+
+        auto const runSeparately = [&](Plugin::Key const& key)
+        {
+            Track::SharedAnalyzer analyzer(createReader);
+            auto request = join(analyzer, key);
+            analyzer.launchPendingAnalyses();
+            return request != nullptr ? getFeature(*request.get()) : Track::SharedAnalyzer::Feature{};
+        };
+
+        auto const linearFeature = runSeparately(linearKey);
+        auto const logFeature = runSeparately(logKey);
+
+        beginTest("shared outputs");
+        {
+            Track::SharedAnalyzer analyzer(createReader);
+            auto linearRequest = join(analyzer, linearKey);
+            auto logRequest = join(analyzer, logKey);
+            expect(linearRequest != nullptr && logRequest != nullptr);
+            analyzer.launchPendingAnalyses();
+            if(linearRequest != nullptr && logRequest != nullptr)
+            {
+                expectSameResults(getFeature(*linearRequest.get()), linearFeature);
+                expectSameResults(getFeature(*logRequest.get()), logFeature);
+            }
+        }
+
+        beginTest("removed request");
+        {
+            Track::SharedAnalyzer analyzer(createReader);
+            auto linearRequest = join(analyzer, linearKey);
+            auto logRequest = join(analyzer, logKey);
+            expect(linearRequest != nullptr && logRequest != nullptr);
+            analyzer.launchPendingAnalyses();
+            // The track of the first output is removed while the analysis is running
+            linearRequest.reset();
+            if(logRequest != nullptr)
+            {
+                expectSameResults(getFeature(*logRequest.get()), logFeature);
+            }
+        }
+    }
+};
+
+static TrackSharedAnalyzerUnitTest trackSharedAnalyzerUnitTest;
+
+ANALYSE_FILE_END
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../Plugin/AnlPluginProcessor.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Track
+{
+    //! @brief Runs the plugin once for the tracks that use different outputs of the same plugin.
+    //! @details The tracks without inputs that use the same plugin with the same parameters, block size, step size
+    //! and window type join the same analysis. The analysis is launched once the message thread is available so
+    //! all the tracks created together (when a document is loaded for example) can join it, then the results of
+    //! each output of the plugin are routed to the tracks that use it. A track that requests an analysis that is
+    //! already launched joins a new analysis. The analyzer must be used from the message thread.
+    class SharedAnalyzer
+    : private juce::AsyncUpdater
+    {
+    public:
+        //! @brief The results of an output of the plugin routed to a track.
+        struct Feature
+        {
+            juce::Result result{juce::Result::ok()};
+            std::vector<std::vector<Plugin::Result>> results; // [channels[results]]
+            Plugin::Output output;
+            Plugin::Description description;
+            double readingDuration{0.0};    // The part of the reading duration of the analysis (in seconds)
+            double processingDuration{0.0}; // The part of the processing duration of the analysis (in seconds)
+        };
+
+    private:
+        struct Analysis;
+
+    public:
+        //! @brief The request of a track that joined an analysis.
+        //! @details The analysis is aborted once all its requests have been deleted.
+        class Request
+        {
+        public:
+            ~Request();
+
+            //! @brief Waits for the end of the analysis and returns true if the analysis has ended.
+            bool waitForEnd(int milliseconds) const;
+            float getAdvancement() const;
+
+            //! @brief Gets the results of the output used by the track once the analysis has ended.
+            Feature getFeature();
+
+        private:
+            friend class SharedAnalyzer;
+            Request(std::shared_ptr<Analysis> analysis, size_t index);
+
+            std::shared_ptr<Analysis> mAnalysis;
+            size_t const mIndex;
+
+            JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Request)
+        };
+
+        using ReaderCreator = std::function<std::unique_ptr<juce::AudioFormatReader>(void)>;
+
+        explicit SharedAnalyzer(ReaderCreator readerCreator);
+        ~SharedAnalyzer() override;
+
+        //! @brief Joins the pending analysis of the plugin with the state or creates a new one.
+        //! @details The method throws the errors of the plugin allocation like Plugin::Processor::create and
+        //! returns nullptr if the audio cannot be read.
+        std::unique_ptr<Request> join(Plugin::Key const& key, Plugin::State const& state);
+
+        //! @brief Launches the pending analyses without waiting for the message thread so the next requests
+        //! don't join them.
+        //! @details This must be called before the tracks are analyzed with new audio files.
+        void launchPendingAnalyses();
+
+    private:
+        // juce::AsyncUpdater
+        void handleAsyncUpdate() override;
+
+        static void launch(Analysis& analysis);
+
+        ReaderCreator mReaderCreator;
+        std::vector<std::shared_ptr<Analysis>> mPendingAnalyses;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedAnalyzer)
+    };
+} // namespace Track
+
+ANALYSE_FILE_END
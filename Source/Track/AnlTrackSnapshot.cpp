@@ -90,7 +90,12 @@ Track::Snapshot::Snapshot(Accessor& accessor, Zoom::Accessor& timeZoomAccessor,
                 {
                     if(Tools::getFrameType(mAccessor) != Track::FrameType::label)
                     {
-                        repaint();
+                        ContentState state;
+                        appendContentState(mAccessor, mTimeZoomAccessor, acsr.getAttr<Transport::AttrType::startPlayhead>(), state);
+                        if(state != mPaintedState)
+                        {
+                            repaint();
+                        }
                     }
                 }
             }
@@ -101,7 +106,12 @@ Track::Snapshot::Snapshot(Accessor& accessor, Zoom::Accessor& timeZoomAccessor,
                 {
                     if(Tools::getFrameType(mAccessor) != Track::FrameType::label)
                     {
-                        repaint();
+                        ContentState state;
+                        appendContentState(mAccessor, mTimeZoomAccessor, acsr.getAttr<Transport::AttrType::runningPlayhead>(), state);
+                        if(state != mPaintedState)
+                        {
+                            repaint();
+                        }
                     }
                 }
             }
@@ -142,6 +152,58 @@ void Track::Snapshot::paint(juce::Graphics& g)
     auto const isPlaying = mTransportAccessor.getAttr<Transport::AttrType::playback>();
     auto const time = isPlaying ? mTransportAccessor.getAttr<Transport::AttrType::runningPlayhead>() : mTransportAccessor.getAttr<Transport::AttrType::startPlayhead>();
     paint(mAccessor, mTimeZoomAccessor, time, g, getLocalBounds(), findColour(Decorator::ColourIds::normalBorderColourId));
+    mPaintedState.clear();
+    appendContentState(mAccessor, mTimeZoomAccessor, time, mPaintedState);
+}
+
+void Track::Snapshot::appendContentState(Accessor const& accessor, Zoom::Accessor const& timeZoomAcsr, double time, ContentState& state)
+{
+    auto const frameType = Tools::getFrameType(accessor);
+    if(!frameType.has_value())
+    {
+        return;
+    }
+    auto const numChannels = accessor.getAttr<AttrType::channelsLayout>().size();
+    switch(frameType.value())
+    {
+        case Track::FrameType::label:
+            break;
+        case Track::FrameType::value:
+        {
+            auto const& results = accessor.getAttr<AttrType::results>();
+            auto const access = results.getReadAccess();
+            if(!static_cast<bool>(access))
+            {
+                // The results cannot be accessed so the state is invalidated
+                state.push_back(std::numeric_limits<float>::quiet_NaN());
+                return;
+            }
+            auto const points = results.getPoints();
+            for(auto channel = 0_z; channel < numChannels; ++channel)
+            {
+                state.push_back(Results::getValue(points, channel, time));
+            }
+        }
+        break;
+        case Track::FrameType::vector:
+        {
+            auto const& globalRange = timeZoomAcsr.getAttr<Zoom::AttrType::globalRange>();
+            auto const& graphics = accessor.getAttr<AttrType::graphics>();
+            for(auto channel = 0_z; channel < numChannels; ++channel)
+            {
+                if(globalRange.isEmpty() || graphics.empty(channel))
+                {
+                    state.push_back({});
+                }
+                else
+                {
+                    auto const width = static_cast<double>(graphics.channels.at(channel).images.back().getWidth());
+                    state.push_back(static_cast<float>(std::floor((time - globalRange.getStart()) / globalRange.getLength() * width)));
+                }
+            }
+        }
+        break;
+    }
 }
 
 void Track::Snapshot::paintGrid(Accessor const& accessor, juce::Graphics& g, juce::Rectangle<int> bounds, juce::Colour const colour)
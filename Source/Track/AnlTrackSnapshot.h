@@ -44,6 +44,11 @@ namespace Track
 
         static void paint(Accessor const& accessor, Zoom::Accessor const& timeZoomAcsr, double time, juce::Graphics& g, juce::Rectangle<int> bounds, juce::Colour const colour);
 
+        // Gets the values (for points) or the image columns (for columns) painted at a time for all the channels
+        // This is used to only repaint the snapshot when the painted content changes while the playhead moves
+        using ContentState = std::vector<std::optional<float>>;
+        static void appendContentState(Accessor const& accessor, Zoom::Accessor const& timeZoomAcsr, double time, ContentState& state);
+
     private:
         static void paintGrid(Accessor const& accessor, juce::Graphics& g, juce::Rectangle<int> bounds, juce::Colour const colour);
         static void paintPoints(Accessor const& accessor, size_t channel, juce::Graphics& g, juce::Rectangle<int> const& bounds, Zoom::Accessor const& timeZoomAcsr, double time);
@@ -56,6 +61,7 @@ namespace Track
         Zoom::Accessor::Listener mZoomListener{typeid(*this).name()};
         Zoom::Grid::Accessor::Listener mGridListener{typeid(*this).name()};
         Transport::Accessor::Listener mTransportListener{typeid(*this).name()};
+        ContentState mPaintedState;
     };
 } // namespace Track
 
@@ -0,0 +1,1114 @@
+#include "AnlTrackResultBinary.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    using Data = Track::Result::Data;
+    using Chunk = Track::Result::Binary::Chunk;
+    using Header = Track::Result::Binary::Header;
+
+    static constexpr size_t alignment = 16_z;
+    static constexpr size_t magicSize = 6_z;
+    static constexpr size_t headerSize = 32_z;
+    static constexpr size_t chunkInfoSize = 48_z;
+    static constexpr size_t checksumSize = 8_z;
+    static constexpr size_t maxChunkFrames = 16384_z;
+    static constexpr size_t maxChunkSize = 4_z * 1024_z * 1024_z;
+
+    size_t alignSize(size_t size)
+    {
+        return (size + alignment - 1_z) & ~(alignment - 1_z);
+    }
+
+    template <typename V>
+    void writeValue(char* ptr, V const& value)
+    {
+        std::memcpy(ptr, &value, sizeof(V));
+    }
+
+    template <typename V>
+    V readValue(char const* ptr)
+    {
+        V value;
+        std::memcpy(&value, ptr, sizeof(V));
+        return value;
+    }
+
+    void readFloats(std::vector<float>& values, char const* ptr, size_t size)
+    {
+        values.resize(size / sizeof(float));
+        if(!values.empty())
+        {
+            std::memcpy(values.data(), ptr, values.size() * sizeof(float));
+        }
+    }
+
+    template <typename T>
+    Data::Type getType()
+    {
+        if constexpr(std::is_same_v<T, Data::Marker>)
+        {
+            return Data::Type::marker;
+        }
+        else if constexpr(std::is_same_v<T, Data::Point>)
+        {
+            return Data::Type::point;
+        }
+        else
+        {
+            return Data::Type::column;
+        }
+    }
+
+    char const* getMagic(Data::Type type, bool compact)
+    {
+        switch(type)
+        {
+            case Data::Type::marker:
+                return compact ? "PTLM03" : "PTLM02";
+            case Data::Type::point:
+                return compact ? "PTLP03" : "PTLP02";
+            case Data::Type::column:
+                return compact ? "PTLC03" : "PTLC02";
+        }
+        return "PTLX02";
+    }
+
+    // A residual is written with a control byte that contains the number of leading zero bytes (high
+    // nibble) and the number of trailing zero bytes (low nibble) followed by the remaining bytes, so a
+    // residual of zero only takes one byte. The control byte 0xff is used for the points without value.
+    static constexpr uint8_t noValueControl = 0xff;
+
+    template <typename V>
+    using bits_t = std::conditional_t<sizeof(V) == sizeof(uint64_t), uint64_t, uint32_t>;
+
+    class CompactWriter
+    {
+    public:
+        CompactWriter(std::vector<char>& buffer)
+        : mBuffer(buffer)
+        {
+        }
+
+        void writeVarint(uint64_t value)
+        {
+            while(value >= 0x80u)
+            {
+                mBuffer.push_back(static_cast<char>((value & 0x7fu) | 0x80u));
+                value >>= 7;
+            }
+            mBuffer.push_back(static_cast<char>(value));
+        }
+
+        void writeBytes(char const* data, size_t size)
+        {
+            mBuffer.insert(mBuffer.end(), data, data + size);
+        }
+
+        void writeNoValue()
+        {
+            mBuffer.push_back(static_cast<char>(noValueControl));
+        }
+
+        template <typename V>
+        void writeResidual(V value, V prediction)
+        {
+            using bits_type = bits_t<V>;
+            auto const residual = readValue<bits_type>(reinterpret_cast<char const*>(&value)) ^ readValue<bits_type>(reinterpret_cast<char const*>(&prediction));
+            auto leading = 0_z;
+            while(leading < sizeof(V) && ((residual >> ((sizeof(V) - 1_z - leading) * 8_z)) & 0xffu) == 0u)
+            {
+                ++leading;
+            }
+            auto trailing = 0_z;
+            while(leading + trailing < sizeof(V) && ((residual >> (trailing * 8_z)) & 0xffu) == 0u)
+            {
+                ++trailing;
+            }
+            mBuffer.push_back(static_cast<char>((leading << 4) | trailing));
+            for(auto index = trailing; index < sizeof(V) - leading; ++index)
+            {
+                mBuffer.push_back(static_cast<char>((residual >> (index * 8_z)) & 0xffu));
+            }
+        }
+
+    private:
+        std::vector<char>& mBuffer;
+    };
+
+    class CompactReader
+    {
+    public:
+        CompactReader(char const* data, size_t size)
+        : mPosition(data)
+        , mEnd(data + size)
+        {
+        }
+
+        bool hasFailed() const noexcept
+        {
+            return mFailed;
+        }
+
+        size_t getRemainingSize() const noexcept
+        {
+            return static_cast<size_t>(mEnd - mPosition);
+        }
+
+        uint64_t readVarint()
+        {
+            uint64_t value = 0u;
+            for(auto shift = 0; shift < 64 && mPosition != mEnd; shift += 7)
+            {
+                auto const byte = static_cast<uint8_t>(*mPosition++);
+                value |= static_cast<uint64_t>(byte & 0x7fu) << shift;
+                if((byte & 0x80u) == 0u)
+                {
+                    return value;
+                }
+            }
+            mFailed = true;
+            return 0u;
+        }
+
+        char const* readBytes(size_t size)
+        {
+            if(size > getRemainingSize())
+            {
+                mFailed = true;
+                return nullptr;
+            }
+            auto const* data = mPosition;
+            mPosition += size;
+            return data;
+        }
+
+        uint8_t readControl()
+        {
+            if(mPosition == mEnd)
+            {
+                mFailed = true;
+                return 0u;
+            }
+            return static_cast<uint8_t>(*mPosition++);
+        }
+
+        template <typename V>
+        V readResidual(uint8_t control, V prediction)
+        {
+            using bits_type = bits_t<V>;
+            auto const leading = static_cast<size_t>(control >> 4);
+            auto const trailing = static_cast<size_t>(control & 0x0fu);
+            if(leading + trailing > sizeof(V) || sizeof(V) - leading - trailing > getRemainingSize())
+            {
+                mFailed = true;
+                return prediction;
+            }
+            auto const numBytes = sizeof(V) - leading - trailing;
+            auto residual = bits_type(0u);
+            if(numBytes > 0_z && getRemainingSize() >= sizeof(uint64_t))
+            {
+                // Reads a whole word and masks the bytes that don't belong to the residual
+                auto const mask = numBytes == sizeof(uint64_t) ? ~uint64_t(0u) : (uint64_t(1u) << (numBytes * 8_z)) - 1u;
+                residual = static_cast<bits_type>((readValue<uint64_t>(mPosition) & mask) << (trailing * 8_z));
+                mPosition += numBytes;
+            }
+            else
+            {
+                for(auto index = trailing; index < sizeof(V) - leading; ++index)
+                {
+                    residual |= static_cast<bits_type>(static_cast<uint8_t>(*mPosition++)) << (index * 8_z);
+                }
+            }
+            residual ^= readValue<bits_type>(reinterpret_cast<char const*>(&prediction));
+            return readValue<V>(reinterpret_cast<char const*>(&residual));
+        }
+
+        template <typename V>
+        V readResidual(V prediction)
+        {
+            return readResidual(readControl(), prediction);
+        }
+
+    private:
+        char const* mPosition;
+        char const* const mEnd;
+        bool mFailed{false};
+    };
+
+    // The values are predicted with the same bin of the previous frame, or with the previous bin if the
+    // previous frame has less bins.
+    void writeCompactFloats(CompactWriter& writer, std::vector<float> const& values, std::vector<float>& previous)
+    {
+        writer.writeVarint(static_cast<uint64_t>(values.size()));
+        for(auto index = 0_z; index < values.size(); ++index)
+        {
+            auto const prediction = index < previous.size() ? previous[index] : (index > 0_z ? values[index - 1_z] : 0.0f);
+            writer.writeResidual(values[index], prediction);
+        }
+        previous = values;
+    }
+
+    bool readCompactFloats(CompactReader& reader, std::vector<float>& values, std::vector<float>& previous)
+    {
+        auto const size = reader.readVarint();
+        if(reader.hasFailed() || size > reader.getRemainingSize())
+        {
+            return false;
+        }
+        values.resize(static_cast<size_t>(size));
+        for(auto index = 0_z; index < values.size(); ++index)
+        {
+            auto const prediction = index < previous.size() ? previous[index] : (index > 0_z ? values[index - 1_z] : 0.0f);
+            values[index] = reader.readResidual(prediction);
+        }
+        previous = values;
+        return !reader.hasFailed();
+    }
+
+    template <typename T>
+    std::vector<char> encodeCompactChunk(typename std::vector<T>::const_iterator first, typename std::vector<T>::const_iterator last)
+    {
+        std::vector<char> buffer;
+        CompactWriter writer(buffer);
+        auto previousTime = 0.0;
+        auto step = 0.0;
+        auto previousDuration = 0.0;
+        auto previousValue = 0.0f;
+        std::vector<float> previousValues;
+        std::vector<float> previousExtras;
+        std::map<std::string, uint64_t> labels;
+        for(auto it = first; it != last; ++it)
+        {
+            // The time is predicted on the step grid of the two previous frames
+            auto const time = std::get<0_z>(*it);
+            writer.writeResidual(time, previousTime + step);
+            step = it != first ? time - previousTime : 0.0;
+            previousTime = time;
+
+            auto const duration = std::get<1_z>(*it);
+            writer.writeResidual(duration, previousDuration);
+            previousDuration = duration;
+
+            if constexpr(std::is_same_v<T, Data::Marker>)
+            {
+                auto const& label = std::get<2_z>(*it);
+                auto const labelIt = labels.find(label);
+                if(labelIt != labels.cend())
+                {
+                    writer.writeVarint(labelIt->second);
+                }
+                else
+                {
+                    writer.writeVarint(0u);
+                    writer.writeVarint(static_cast<uint64_t>(label.size()));
+                    writer.writeBytes(label.data(), label.size());
+                    labels.emplace(label, static_cast<uint64_t>(labels.size() + 1_z));
+                }
+            }
+            else if constexpr(std::is_same_v<T, Data::Point>)
+            {
+                auto const& value = std::get<2_z>(*it);
+                if(value.has_value())
+                {
+                    writer.writeResidual(*value, previousValue);
+                    previousValue = *value;
+                }
+                else
+                {
+                    writer.writeNoValue();
+                }
+            }
+            else
+            {
+                writeCompactFloats(writer, std::get<2_z>(*it), previousValues);
+            }
+            writeCompactFloats(writer, std::get<3_z>(*it), previousExtras);
+        }
+        buffer.resize(alignSize(buffer.size()), '\0');
+        return buffer;
+    }
+
+    template <typename T>
+    std::optional<juce::String> appendCompactChunk(Chunk const& chunk, char const* data, size_t size, std::vector<T>& frames)
+    {
+        // The chunk must end before the checksum
+        if(size < checksumSize || chunk.offset > size - checksumSize || chunk.size > size - checksumSize - chunk.offset)
+        {
+            return juce::translate("Parsing error - chunk");
+        }
+        auto const numFrames = static_cast<size_t>(chunk.numFrames);
+        // Each frame takes at least 4 bytes (time, duration, value & extras)
+        if(numFrames > static_cast<size_t>(chunk.size) / 4_z)
+        {
+            return juce::translate("Parsing error - num frames");
+        }
+
+        CompactReader reader(data + chunk.offset, static_cast<size_t>(chunk.size));
+        auto previousTime = 0.0;
+        auto step = 0.0;
+        auto previousDuration = 0.0;
+        auto previousValue = 0.0f;
+        std::vector<float> previousValues;
+        std::vector<float> previousExtras;
+        std::vector<std::string> labels;
+        frames.reserve(frames.size() + numFrames);
+        for(auto index = 0_z; index < numFrames; ++index)
+        {
+            T frame;
+            auto const time = reader.readResidual(previousTime + step);
+            step = index > 0_z ? time - previousTime : 0.0;
+            previousTime = time;
+            std::get<0_z>(frame) = time;
+
+            previousDuration = reader.readResidual(previousDuration);
+            std::get<1_z>(frame) = previousDuration;
+
+            if constexpr(std::is_same_v<T, Data::Marker>)
+            {
+                auto const labelIndex = reader.readVarint();
+                if(labelIndex == 0u)
+                {
+                    auto const labelSize = reader.readVarint();
+                    auto const* label = reader.readBytes(static_cast<size_t>(labelSize));
+                    if(label == nullptr)
+                    {
+                        return juce::translate("Parsing error - values");
+                    }
+                    labels.emplace_back(label, static_cast<size_t>(labelSize));
+                    std::get<2_z>(frame) = labels.back();
+                }
+                else if(labelIndex <= labels.size())
+                {
+                    std::get<2_z>(frame) = labels[static_cast<size_t>(labelIndex - 1u)];
+                }
+                else
+                {
+                    return juce::translate("Parsing error - values");
+                }
+            }
+            else if constexpr(std::is_same_v<T, Data::Point>)
+            {
+                auto const control = reader.readControl();
+                if(control != noValueControl)
+                {
+                    previousValue = reader.readResidual(control, previousValue);
+                    std::get<2_z>(frame) = previousValue;
+                }
+            }
+            else
+            {
+                if(!readCompactFloats(reader, std::get<2_z>(frame), previousValues))
+                {
+                    return juce::translate("Parsing error - values");
+                }
+            }
+            if(!readCompactFloats(reader, std::get<3_z>(frame), previousExtras))
+            {
+                return juce::translate("Parsing error - extra");
+            }
+            if(reader.hasFailed())
+            {
+                return juce::translate("Parsing error - values");
+            }
+            frames.push_back(std::move(frame));
+        }
+        return {};
+    }
+
+    // FNV-1a applied on 64-bit words, all the blocks of the file are aligned on 16 bytes
+    class Checksum
+    {
+    public:
+        void update(char const* data, size_t size)
+        {
+            MiscWeakAssert(size % sizeof(uint64_t) == 0_z);
+            for(auto index = 0_z; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t))
+            {
+                mValue = (mValue ^ readValue<uint64_t>(data + index)) * 1099511628211ull;
+            }
+        }
+
+        uint64_t getValue() const noexcept
+        {
+            return mValue;
+        }
+
+    private:
+        uint64_t mValue{14695981039346656037ull};
+    };
+
+    // The positions of the blocks in a chunk, the value and extra ends are byte positions in their data block
+    struct Layout
+    {
+        size_t times;
+        size_t durations;
+        size_t values;
+        size_t valueData;
+        size_t extras;
+        size_t extraData;
+        size_t size;
+    };
+
+    Layout getLayout(Data::Type type, size_t numFrames, size_t valueDataSize, size_t extraDataSize)
+    {
+        Layout layout;
+        layout.times = 0_z;
+        layout.durations = layout.times + alignSize(numFrames * sizeof(double));
+        layout.values = layout.durations + alignSize(numFrames * sizeof(double));
+        layout.valueData = layout.values + alignSize(numFrames * (type == Data::Type::point ? sizeof(uint8_t) : sizeof(uint64_t)));
+        layout.extras = layout.valueData + alignSize(valueDataSize);
+        layout.extraData = layout.extras + alignSize(numFrames * sizeof(uint64_t));
+        layout.size = layout.extraData + alignSize(extraDataSize);
+        return layout;
+    }
+
+    template <typename T>
+    size_t getValueDataSize(T const& frame)
+    {
+        if constexpr(std::is_same_v<T, Data::Marker>)
+        {
+            return std::get<2_z>(frame).size();
+        }
+        else if constexpr(std::is_same_v<T, Data::Point>)
+        {
+            return sizeof(float);
+        }
+        else
+        {
+            return std::get<2_z>(frame).size() * sizeof(float);
+        }
+    }
+
+    template <typename T>
+    bool writeChannels(std::ostream& stream, std::vector<std::vector<T>> const& channelsData, Zoom::Range timeRange, std::set<size_t> const& channels, bool compact, std::atomic<bool> const& shouldAbort)
+    {
+        using Iterator = typename std::vector<T>::const_iterator;
+        struct Entry
+        {
+            Chunk chunk;
+            Iterator first;
+            Iterator last;
+            size_t valueDataSize;
+            size_t extraDataSize;
+        };
+
+        auto const type = getType<T>();
+        std::vector<Entry> entries;
+        auto numChannels = 0_z;
+        for(auto index = 0_z; index < channelsData.size(); ++index)
+        {
+            if(!channels.empty() && channels.count(index) == 0_z)
+            {
+                continue;
+            }
+            auto const& frames = channelsData.at(index);
+            auto it = std::lower_bound(frames.cbegin(), frames.cend(), timeRange.getStart(), Track::Result::lower_cmp<T>);
+            auto const end = std::upper_bound(it, frames.cend(), timeRange.getEnd(), Track::Result::upper_cmp<T>);
+            while(it != end)
+            {
+                Entry entry{{static_cast<uint64_t>(numChannels), 0u, 0u, 0u, std::get<0_z>(*it), std::get<0_z>(*it)}, it, it, 0_z, 0_z};
+                while(entry.last != end && entry.chunk.numFrames < maxChunkFrames && getLayout(type, static_cast<size_t>(entry.chunk.numFrames), entry.valueDataSize, entry.extraDataSize).size < maxChunkSize)
+                {
+                    auto const& frame = *entry.last;
+                    entry.valueDataSize += getValueDataSize(frame);
+                    entry.extraDataSize += std::get<3_z>(frame).size() * sizeof(float);
+                    entry.chunk.end = std::max(entry.chunk.end, std::get<0_z>(frame) + std::get<1_z>(frame));
+                    ++entry.chunk.numFrames;
+                    ++entry.last;
+                }
+                it = entry.last;
+                entries.push_back(entry);
+            }
+            ++numChannels;
+        }
+
+        // The compact chunks are encoded before writing the header because their sizes are required
+        std::vector<std::vector<char>> compactChunks;
+        if(compact)
+        {
+            compactChunks.reserve(entries.size());
+            for(auto const& entry : entries)
+            {
+                if(shouldAbort)
+                {
+                    return false;
+                }
+                compactChunks.push_back(encodeCompactChunk<T>(entry.first, entry.last));
+            }
+        }
+
+        auto offset = headerSize + entries.size() * chunkInfoSize;
+        for(auto index = 0_z; index < entries.size(); ++index)
+        {
+            auto& entry = entries[index];
+            entry.chunk.offset = static_cast<uint64_t>(offset);
+            entry.chunk.size = static_cast<uint64_t>(compact ? compactChunks.at(index).size() : getLayout(type, static_cast<size_t>(entry.chunk.numFrames), entry.valueDataSize, entry.extraDataSize).size);
+            offset += static_cast<size_t>(entry.chunk.size);
+        }
+
+        Checksum checksum;
+        std::vector<char> buffer(headerSize + entries.size() * chunkInfoSize, '\0');
+        std::memcpy(buffer.data(), getMagic(type, compact), magicSize);
+        writeValue(buffer.data() + 8_z, static_cast<uint64_t>(numChannels));
+        writeValue(buffer.data() + 16_z, static_cast<uint64_t>(entries.size()));
+        for(auto index = 0_z; index < entries.size(); ++index)
+        {
+            auto const& chunk = entries.at(index).chunk;
+            auto* ptr = buffer.data() + headerSize + index * chunkInfoSize;
+            writeValue(ptr, chunk.channel);
+            writeValue(ptr + 8_z, chunk.numFrames);
+            writeValue(ptr + 16_z, chunk.offset);
+            writeValue(ptr + 24_z, chunk.size);
+            writeValue(ptr + 32_z, chunk.start);
+            writeValue(ptr + 40_z, chunk.end);
+        }
+        checksum.update(buffer.data(), buffer.size());
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        if(compact)
+        {
+            for(auto const& compactChunk : compactChunks)
+            {
+                if(shouldAbort)
+                {
+                    return false;
+                }
+                checksum.update(compactChunk.data(), compactChunk.size());
+                stream.write(compactChunk.data(), static_cast<std::streamsize>(compactChunk.size()));
+            }
+        }
+        else
+        {
+            for(auto const& entry : entries)
+            {
+                if(shouldAbort)
+                {
+                    return false;
+                }
+
+                auto const layout = getLayout(type, static_cast<size_t>(entry.chunk.numFrames), entry.valueDataSize, entry.extraDataSize);
+                buffer.assign(layout.size, '\0');
+                auto* data = buffer.data();
+                auto valueEnd = 0_z;
+                auto extraEnd = 0_z;
+                auto index = 0_z;
+                for(auto it = entry.first; it != entry.last; ++it, ++index)
+                {
+                    writeValue(data + layout.times + index * sizeof(double), std::get<0_z>(*it));
+                    writeValue(data + layout.durations + index * sizeof(double), std::get<1_z>(*it));
+                    if constexpr(std::is_same_v<T, Data::Point>)
+                    {
+                        auto const& value = std::get<2_z>(*it);
+                        writeValue(data + layout.values + index * sizeof(uint8_t), static_cast<uint8_t>(value.has_value() ? 1 : 0));
+                        writeValue(data + layout.valueData + index * sizeof(float), value.value_or(0.0f));
+                    }
+                    else
+                    {
+                        auto const& value = std::get<2_z>(*it);
+                        auto const valueSize = getValueDataSize(*it);
+                        if(valueSize > 0_z)
+                        {
+                            std::memcpy(data + layout.valueData + valueEnd, value.data(), valueSize);
+                        }
+                        valueEnd += valueSize;
+                        writeValue(data + layout.values + index * sizeof(uint64_t), static_cast<uint64_t>(valueEnd));
+                    }
+                    auto const& extra = std::get<3_z>(*it);
+                    if(!extra.empty())
+                    {
+                        std::memcpy(data + layout.extraData + extraEnd, extra.data(), extra.size() * sizeof(float));
+                    }
+                    extraEnd += extra.size() * sizeof(float);
+                    writeValue(data + layout.extras + index * sizeof(uint64_t), static_cast<uint64_t>(extraEnd));
+                }
+                checksum.update(data, layout.size);
+                stream.write(data, static_cast<std::streamsize>(layout.size));
+            }
+        }
+
+        auto const value = checksum.getValue();
+        stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        return stream.good();
+    }
+
+    template <typename T>
+    std::optional<juce::String> appendChunk(Chunk const& chunk, char const* data, size_t size, std::vector<T>& frames)
+    {
+        auto const type = getType<T>();
+        // The chunk must end before the checksum
+        if(size < checksumSize || chunk.offset > size - checksumSize || chunk.size > size - checksumSize - chunk.offset)
+        {
+            return juce::translate("Parsing error - chunk");
+        }
+        auto const chunkSize = static_cast<size_t>(chunk.size);
+        auto const numFrames = static_cast<size_t>(chunk.numFrames);
+        if(numFrames > chunkSize / sizeof(double))
+        {
+            return juce::translate("Parsing error - num frames");
+        }
+        if(numFrames == 0_z)
+        {
+            return {};
+        }
+
+        // Each block is checked before reading the end positions that give the size of the next blocks
+        auto const* ptr = data + chunk.offset;
+        if(getLayout(type, numFrames, 0_z, 0_z).valueData > chunkSize)
+        {
+            return juce::translate("Parsing error - values");
+        }
+        auto const valueDataSize = type == Data::Type::point ? numFrames * sizeof(float) : static_cast<size_t>(readValue<uint64_t>(ptr + getLayout(type, numFrames, 0_z, 0_z).values + (numFrames - 1_z) * sizeof(uint64_t)));
+        if(valueDataSize > chunkSize || getLayout(type, numFrames, valueDataSize, 0_z).extraData > chunkSize)
+        {
+            return juce::translate("Parsing error - values");
+        }
+        auto const extraDataSize = static_cast<size_t>(readValue<uint64_t>(ptr + getLayout(type, numFrames, valueDataSize, 0_z).extras + (numFrames - 1_z) * sizeof(uint64_t)));
+        if(extraDataSize > chunkSize || getLayout(type, numFrames, valueDataSize, extraDataSize).size > chunkSize)
+        {
+            return juce::translate("Parsing error - extra");
+        }
+        auto const layout = getLayout(type, numFrames, valueDataSize, extraDataSize);
+        if(layout.size != chunkSize)
+        {
+            return juce::translate("Parsing error - chunk");
+        }
+
+        frames.reserve(frames.size() + numFrames);
+        auto valueStart = 0_z;
+        auto extraStart = 0_z;
+        for(auto index = 0_z; index < numFrames; ++index)
+        {
+            T frame;
+            std::get<0_z>(frame) = readValue<double>(ptr + layout.times + index * sizeof(double));
+            std::get<1_z>(frame) = readValue<double>(ptr + layout.durations + index * sizeof(double));
+            if constexpr(std::is_same_v<T, Data::Point>)
+            {
+                if(readValue<uint8_t>(ptr + layout.values + index * sizeof(uint8_t)) != 0)
+                {
+                    std::get<2_z>(frame) = readValue<float>(ptr + layout.valueData + index * sizeof(float));
+                }
+            }
+            else
+            {
+                auto const valueEnd = static_cast<size_t>(readValue<uint64_t>(ptr + layout.values + index * sizeof(uint64_t)));
+                if(valueEnd < valueStart || valueEnd > valueDataSize)
+                {
+                    return juce::translate("Parsing error - values");
+                }
+                if constexpr(std::is_same_v<T, Data::Marker>)
+                {
+                    std::get<2_z>(frame).assign(ptr + layout.valueData + valueStart, valueEnd - valueStart);
+                }
+                else
+                {
+                    if((valueEnd - valueStart) % sizeof(float) != 0_z)
+                    {
+                        return juce::translate("Parsing error - values");
+                    }
+                    readFloats(std::get<2_z>(frame), ptr + layout.valueData + valueStart, valueEnd - valueStart);
+                }
+                valueStart = valueEnd;
+            }
+            auto const extraEnd = static_cast<size_t>(readValue<uint64_t>(ptr + layout.extras + index * sizeof(uint64_t)));
+            if(extraEnd < extraStart || extraEnd > extraDataSize || (extraEnd - extraStart) % sizeof(float) != 0_z)
+            {
+                return juce::translate("Parsing error - extra");
+            }
+            readFloats(std::get<3_z>(frame), ptr + layout.extraData + extraStart, extraEnd - extraStart);
+            extraStart = extraEnd;
+            frames.push_back(std::move(frame));
+        }
+        return {};
+    }
+
+    template <typename T>
+    std::variant<Data, juce::String> readChannels(Header const& header, char const* data, size_t size, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+    {
+        std::vector<std::vector<T>> channels(header.numChannels);
+        for(auto const& chunk : header.chunks)
+        {
+            channels[static_cast<size_t>(chunk.channel)].reserve(channels[static_cast<size_t>(chunk.channel)].size() + static_cast<size_t>(chunk.numFrames));
+        }
+        for(auto index = 0_z; index < header.chunks.size(); ++index)
+        {
+            if(shouldAbort)
+            {
+                return {};
+            }
+            auto const& chunk = header.chunks.at(index);
+            auto const error = header.compact ? appendCompactChunk(chunk, data, size, channels[static_cast<size_t>(chunk.channel)]) : appendChunk(chunk, data, size, channels[static_cast<size_t>(chunk.channel)]);
+            if(error.has_value())
+            {
+                return {error.value()};
+            }
+            advancement.store(static_cast<float>(index + 1_z) / static_cast<float>(header.chunks.size()));
+        }
+        return {Data(std::move(channels))};
+    }
+
+    template <typename T>
+    std::variant<Track::Result::ChannelData, juce::String> readChunkFrames(Header const& header, Chunk const& chunk, char const* data, size_t size)
+    {
+        std::vector<T> frames;
+        auto const error = header.compact ? appendCompactChunk(chunk, data, size, frames) : appendChunk(chunk, data, size, frames);
+        if(error.has_value())
+        {
+            return {error.value()};
+        }
+        return {Track::Result::ChannelData(std::move(frames))};
+    }
+} // namespace
+
+bool Track::Result::Binary::isIndexed(char const* data, size_t size)
+{
+    if(data == nullptr || size < magicSize || std::memcmp(data, "PTL", 3_z) != 0 || data[4] != '0' || (data[5] != '2' && data[5] != '3'))
+    {
+        return false;
+    }
+    return data[3] == 'M' || data[3] == 'P' || data[3] == 'C';
+}
+
+bool Track::Result::Binary::write(std::ostream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, bool compact, std::atomic<bool> const& shouldAbort)
+{
+    if(auto const markers = data.getMarkers())
+    {
+        return writeChannels(stream, *markers, timeRange, channels, compact, shouldAbort);
+    }
+    if(auto const points = data.getPoints())
+    {
+        return writeChannels(stream, *points, timeRange, channels, compact, shouldAbort);
+    }
+    if(auto const columns = data.getColumns())
+    {
+        return writeChannels(stream, *columns, timeRange, channels, compact, shouldAbort);
+    }
+    return false;
+}
+
+std::variant<Track::Result::Binary::Header, juce::String> Track::Result::Binary::readHeader(char const* data, size_t size)
+{
+    if(!isIndexed(data, size))
+    {
+        return {juce::translate("Parsing error - type")};
+    }
+    if(size < headerSize + checksumSize)
+    {
+        return {juce::translate("Parsing error - header")};
+    }
+
+    Header header;
+    header.type = data[3] == 'M' ? Data::Type::marker : (data[3] == 'P' ? Data::Type::point : Data::Type::column);
+    header.numChannels = static_cast<size_t>(readValue<uint64_t>(data + 8_z));
+    header.compact = data[5] == '3';
+    auto const numChunks = static_cast<size_t>(readValue<uint64_t>(data + 16_z));
+    if(numChunks > (size - headerSize - checksumSize) / chunkInfoSize)
+    {
+        return {juce::translate("Parsing error - chunks")};
+    }
+    header.chunks.resize(numChunks);
+    for(auto index = 0_z; index < numChunks; ++index)
+    {
+        auto const* ptr = data + headerSize + index * chunkInfoSize;
+        auto& chunk = header.chunks[index];
+        chunk.channel = readValue<uint64_t>(ptr);
+        chunk.numFrames = readValue<uint64_t>(ptr + 8_z);
+        chunk.offset = readValue<uint64_t>(ptr + 16_z);
+        chunk.size = readValue<uint64_t>(ptr + 24_z);
+        chunk.start = readValue<double>(ptr + 32_z);
+        chunk.end = readValue<double>(ptr + 40_z);
+        if(chunk.channel >= header.numChannels)
+        {
+            return {juce::translate("Parsing error - channels")};
+        }
+    }
+    return {std::move(header)};
+}
+
+std::variant<Track::Result::ChannelData, juce::String> Track::Result::Binary::readChunk(Header const& header, Chunk const& chunk, char const* data, size_t size)
+{
+    switch(header.type)
+    {
+        case Data::Type::marker:
+            return readChunkFrames<Data::Marker>(header, chunk, data, size);
+        case Data::Type::point:
+            return readChunkFrames<Data::Point>(header, chunk, data, size);
+        case Data::Type::column:
+            return readChunkFrames<Data::Column>(header, chunk, data, size);
+    }
+    return {juce::translate("Parsing error - type")};
+}
+
+std::variant<Track::Result::Data, juce::String> Track::Result::Binary::read(char const* data, size_t size, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    auto const header = readHeader(data, size);
+    if(auto const* error = std::get_if<juce::String>(&header))
+    {
+        return {*error};
+    }
+
+    if(size % sizeof(uint64_t) != 0_z)
+    {
+        return {juce::translate("Parsing error - size")};
+    }
+    Checksum checksum;
+    checksum.update(data, size - checksumSize);
+    if(checksum.getValue() != readValue<uint64_t>(data + size - checksumSize))
+    {
+        return {juce::translate("Parsing error - checksum")};
+    }
+
+    auto const& info = std::get<Header>(header);
+    switch(info.type)
+    {
+        case Data::Type::marker:
+            return readChannels<Data::Marker>(info, data, size, shouldAbort, advancement);
+        case Data::Type::point:
+            return readChannels<Data::Point>(info, data, size, shouldAbort, advancement);
+        case Data::Type::column:
+            return readChannels<Data::Column>(info, data, size, shouldAbort, advancement);
+    }
+    return {juce::translate("Parsing error - type")};
+}
+
+Track::Result::Binary::Reader::Reader(juce::File const& file, size_t cacheSize)
+: mFile(file, juce::MemoryMappedFile::AccessMode::readOnly)
+, mCacheSize(cacheSize)
+{
+    // The checksum is not verified because it would require reading the whole file but the
+    // bounds of each chunk are still validated when it is decoded.
+    auto const* data = static_cast<char const*>(mFile.getData());
+    if(data == nullptr)
+    {
+        mError = juce::translate("The file FLNAME cannot be mapped in memory").replace("FLNAME", file.getFullPathName());
+        return;
+    }
+    auto header = readHeader(data, mFile.getSize());
+    if(auto const* error = std::get_if<juce::String>(&header))
+    {
+        mError = *error;
+        return;
+    }
+    mHeader = std::move(std::get<Header>(header));
+}
+
+juce::Result Track::Result::Binary::Reader::getStatus() const
+{
+    return mError.isEmpty() ? juce::Result::ok() : juce::Result::fail(mError);
+}
+
+Track::Result::Binary::Header const& Track::Result::Binary::Reader::getHeader() const noexcept
+{
+    return mHeader;
+}
+
+std::optional<Zoom::Range> Track::Result::Binary::Reader::getTimeRange() const
+{
+    if(mHeader.chunks.empty())
+    {
+        return {};
+    }
+    auto range = Zoom::Range(mHeader.chunks.front().start, mHeader.chunks.front().end);
+    for(auto const& chunk : mHeader.chunks)
+    {
+        range = range.getUnionWith({chunk.start, std::max(chunk.start, chunk.end)});
+    }
+    return range;
+}
+
+std::variant<std::shared_ptr<Track::Result::ChannelData const>, juce::String> Track::Result::Binary::Reader::getChunk(size_t index)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    auto it = mCache.find(index);
+    if(it != mCache.end())
+    {
+        it->second.lastAccess = ++mAccessCounter;
+        return {it->second.data};
+    }
+
+    auto const& chunk = mHeader.chunks.at(index);
+    auto result = readChunk(mHeader, chunk, static_cast<char const*>(mFile.getData()), mFile.getSize());
+    if(auto const* error = std::get_if<juce::String>(&result))
+    {
+        return {*error};
+    }
+    auto data = std::make_shared<ChannelData const>(std::move(std::get<ChannelData>(result)));
+    auto const size = static_cast<size_t>(chunk.size) + std::visit([](auto const& frames)
+                                                                   {
+                                                                       return frames.size() * sizeof(typename std::decay_t<decltype(frames)>::value_type);
+                                                                   },
+                                                                   *data);
+
+    while(!mCache.empty() && mCacheUsage + size > mCacheSize)
+    {
+        auto const oldest = std::min_element(mCache.cbegin(), mCache.cend(), [](auto const& lhs, auto const& rhs)
+                                             {
+                                                 return lhs.second.lastAccess < rhs.second.lastAccess;
+                                             });
+        mCacheUsage -= oldest->second.size;
+        mCache.erase(oldest);
+    }
+    mCache[index] = {data, size, ++mAccessCounter};
+    mCacheUsage += size;
+    return {data};
+}
+
+std::variant<Track::Result::ChannelData, juce::String> Track::Result::Binary::Reader::getFrames(size_t channel, Zoom::Range const& timeRange)
+{
+    if(mError.isNotEmpty())
+    {
+        return {mError};
+    }
+    if(channel >= mHeader.numChannels)
+    {
+        return {juce::translate("Invalid channel")};
+    }
+
+    // Returns all the frames that overlap the time range (including the frames that start before)
+    auto const collect = [&]<typename T>(std::vector<T> frames) -> std::variant<ChannelData, juce::String>
+    {
+        for(auto index = 0_z; index < mHeader.chunks.size(); ++index)
+        {
+            auto const& chunk = mHeader.chunks.at(index);
+            if(chunk.channel != channel || chunk.end < timeRange.getStart() || chunk.start > timeRange.getEnd())
+            {
+                continue;
+            }
+            auto const result = getChunk(index);
+            if(auto const* error = std::get_if<juce::String>(&result))
+            {
+                return {*error};
+            }
+            auto const& chunkFrames = std::get<std::vector<T>>(*std::get<std::shared_ptr<ChannelData const>>(result));
+            std::copy_if(chunkFrames.cbegin(), chunkFrames.cend(), std::back_inserter(frames), [&](T const& frame)
+                         {
+                             return std::get<0_z>(frame) <= timeRange.getEnd() && std::get<0_z>(frame) + std::get<1_z>(frame) >= timeRange.getStart();
+                         });
+        }
+        return {ChannelData(std::move(frames))};
+    };
+
+    switch(mHeader.type)
+    {
+        case Data::Type::marker:
+            return collect(std::vector<Data::Marker>{});
+        case Data::Type::point:
+            return collect(std::vector<Data::Point>{});
+        case Data::Type::column:
+            return collect(std::vector<Data::Column>{});
+    }
+    return {juce::translate("Parsing error - type")};
+}
+
+std::variant<Track::Result::Data, juce::String> Track::Result::Binary::Reader::getData(Zoom::Range const& timeRange, std::atomic<bool> const& shouldAbort)
+{
+    auto const collect = [&]<typename T>(std::vector<std::vector<T>> channels) -> std::variant<Data, juce::String>
+    {
+        for(auto channel = 0_z; channel < mHeader.numChannels; ++channel)
+        {
+            if(shouldAbort)
+            {
+                return {};
+            }
+            auto result = getFrames(channel, timeRange);
+            if(auto const* error = std::get_if<juce::String>(&result))
+            {
+                return {*error};
+            }
+            channels.push_back(std::move(std::get<std::vector<T>>(std::get<ChannelData>(result))));
+        }
+        return {Data(std::move(channels))};
+    };
+
+    if(mError.isNotEmpty())
+    {
+        return {mError};
+    }
+    switch(mHeader.type)
+    {
+        case Data::Type::marker:
+            return collect(std::vector<Data::Markers>{});
+        case Data::Type::point:
+            return collect(std::vector<Data::Points>{});
+        case Data::Type::column:
+            return collect(std::vector<Data::Columns>{});
+    }
+    return {juce::translate("Parsing error - type")};
+}
+
+std::variant<Track::Result::Binary::Summary, juce::String> Track::Result::Binary::Reader::getSummary(std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    if(mError.isNotEmpty())
+    {
+        return {mError};
+    }
+
+    Summary summary;
+    auto const addValue = [&](float value)
+    {
+        summary.valueRange = summary.valueRange.has_value() ? summary.valueRange->getUnionWith(value) : Zoom::Range::emptyRange(value);
+    };
+    auto const addFrame = [&]<typename T>(T const& frame)
+    {
+        if constexpr(std::is_same_v<T, Data::Point>)
+        {
+            summary.numBins = 1_z;
+            if(std::get<2_z>(frame).has_value())
+            {
+                addValue(std::get<2_z>(frame).value());
+            }
+        }
+        else if constexpr(std::is_same_v<T, Data::Column>)
+        {
+            summary.numBins = std::max(summary.numBins, std::get<2_z>(frame).size());
+            if(!std::get<2_z>(frame).empty())
+            {
+                auto const [min, max] = std::minmax_element(std::get<2_z>(frame).cbegin(), std::get<2_z>(frame).cend());
+                addValue(*min);
+                addValue(*max);
+            }
+        }
+        auto const& extras = std::get<3_z>(frame);
+        for(auto index = 0_z; index < extras.size(); ++index)
+        {
+            if(index >= summary.extraRanges.size())
+            {
+                summary.extraRanges.push_back(Zoom::Range::emptyRange(extras.at(index)));
+            }
+            else
+            {
+                summary.extraRanges[index] = summary.extraRanges.at(index).getUnionWith(extras.at(index));
+            }
+        }
+    };
+
+    if(mHeader.type == Data::Type::marker)
+    {
+        summary.valueRange = Zoom::Range::emptyRange(0.0);
+    }
+    for(auto index = 0_z; index < mHeader.chunks.size(); ++index)
+    {
+        if(shouldAbort)
+        {
+            return {};
+        }
+        auto const result = readChunk(mHeader, mHeader.chunks.at(index), static_cast<char const*>(mFile.getData()), mFile.getSize());
+        if(auto const* error = std::get_if<juce::String>(&result))
+        {
+            return {*error};
+        }
+        std::visit([&](auto const& frames)
+                   {
+                       for(auto const& frame : frames)
+                       {
+                           addFrame(frame);
+                       }
+                   },
+                   std::get<ChannelData>(result));
+        advancement.store(static_cast<float>(index + 1_z) / static_cast<float>(mHeader.chunks.size()));
+    }
+    return {std::move(summary)};
+}
+
+ANALYSE_FILE_END
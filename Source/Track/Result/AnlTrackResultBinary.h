@@ -0,0 +1,103 @@
+#pragma once
+
+#include "AnlTrackResultModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Track
+{
+    namespace Result
+    {
+        namespace Binary
+        {
+            // The version 2 of the binary format (PTLM02, PTLP02 & PTLC02) starts with a header that contains
+            // the number of channels and a table of chunks. Each chunk covers a contiguous time range of a
+            // channel and stores its times, durations, values and extras in blocks aligned on 16 bytes so
+            // they can be copied directly from a memory-mapped file. The file ends with a checksum of all the
+            // preceding bytes. The version 3 (PTLM03, PTLP03 & PTLC03) is the compact variant of the version 2
+            // with the same header and table of chunks, but each chunk is a byte stream where the times, the
+            // durations, the values and the extras are XORed with a prediction (the step grid of the previous
+            // times, the previous duration, the value of the same bin in the previous frame) so only the non-zero
+            // bytes of the residuals are stored, and the labels are coded with a dictionary. The version 1
+            // (PTLM01, PTLP01 & PTLC01) is a sequence of frames without index.
+            struct Chunk
+            {
+                uint64_t channel;   // the index of the channel
+                uint64_t numFrames; // the number of frames
+                uint64_t offset;    // the position of the chunk from the beginning of the file
+                uint64_t size;      // the size of the chunk in bytes
+                double start;       // the time of the first frame
+                double end;         // the end time (time + duration) of the last ending frame
+            };
+
+            struct Header
+            {
+                Data::Type type{Data::Type::marker};
+                size_t numChannels{0_z};
+                bool compact{false};
+                std::vector<Chunk> chunks;
+            };
+
+            // The information of the results that doesn't depend on the frames that are in memory
+            struct Summary
+            {
+                size_t numBins{0_z};
+                std::optional<Zoom::Range> valueRange;
+                std::vector<Zoom::Range> extraRanges;
+            };
+
+            bool isIndexed(char const* data, size_t size);
+
+            bool write(std::ostream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, bool compact, std::atomic<bool> const& shouldAbort);
+
+            std::variant<Header, juce::String> readHeader(char const* data, size_t size);
+            std::variant<ChannelData, juce::String> readChunk(Header const& header, Chunk const& chunk, char const* data, size_t size);
+            std::variant<Data, juce::String> read(char const* data, size_t size, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+
+            // Keeps an indexed file (version 2 or 3) memory-mapped and only decodes the chunks that overlap the
+            // requested time ranges. The decoded chunks are kept in a cache whose size is limited (the least
+            // recently used chunks are released first), so that long results don't need to be loaded in memory.
+            class Reader
+            {
+            public:
+                static constexpr size_t defaultCacheSize = 64_z * 1024_z * 1024_z;
+
+                Reader(juce::File const& file, size_t cacheSize = defaultCacheSize);
+                ~Reader() = default;
+
+                juce::Result getStatus() const;
+                Header const& getHeader() const noexcept;
+                std::optional<Zoom::Range> getTimeRange() const;
+
+                std::variant<ChannelData, juce::String> getFrames(size_t channel, Zoom::Range const& timeRange);
+                std::variant<Data, juce::String> getData(Zoom::Range const& timeRange, std::atomic<bool> const& shouldAbort);
+
+                // Decodes all the chunks one by one without keeping them in the cache
+                std::variant<Summary, juce::String> getSummary(std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+
+            private:
+                std::variant<std::shared_ptr<ChannelData const>, juce::String> getChunk(size_t index);
+
+                struct CacheEntry
+                {
+                    std::shared_ptr<ChannelData const> data;
+                    size_t size;
+                    uint64_t lastAccess;
+                };
+
+                juce::MemoryMappedFile const mFile;
+                Header mHeader;
+                juce::String mError;
+                size_t const mCacheSize;
+                std::mutex mMutex;
+                std::map<size_t, CacheEntry> mCache;
+                size_t mCacheUsage{0_z};
+                uint64_t mAccessCounter{0u};
+
+                JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Reader)
+            };
+        } // namespace Binary
+    } // namespace Result
+} // namespace Track
+
+ANALYSE_FILE_END
@@ -37,6 +37,8 @@ namespace Track
                 , puredata
                 , max
                 , sdif
+                , npy
+                , npz
             };
             
             enum class ColumnSeparator
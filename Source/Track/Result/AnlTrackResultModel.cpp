@@ -1,4 +1,5 @@
 #include "AnlTrackResultModel.h"
+#include "AnlTrackResultBinary.h"
 
 ANALYSE_FILE_BEGIN
 
@@ -179,6 +180,39 @@ public:
         }
     }
 
+    Impl(std::shared_ptr<Binary::Reader> reader, Binary::Summary const& summary)
+    : mInfo(std::make_shared<Info>())
+    {
+        MiscWeakAssert(mInfo != nullptr && reader != nullptr);
+        if(mInfo == nullptr || reader == nullptr)
+        {
+            return;
+        }
+        mInfo->reader = reader;
+        mInfo->summary = summary;
+        auto const numChannels = reader->getHeader().numChannels;
+        switch(reader->getHeader().type)
+        {
+            case Type::marker:
+                mInfo->data = std::make_shared<std::vector<Markers>>(numChannels);
+                break;
+            case Type::point:
+                mInfo->data = std::make_shared<std::vector<Points>>(numChannels);
+                break;
+            case Type::column:
+                mInfo->data = std::make_shared<std::vector<Columns>>(numChannels);
+                break;
+        }
+        std::unique_lock<std::mutex> lock(mInfo->accessMutex);
+        auto const access = doGetAccess(true);
+        MiscWeakAssert(access);
+        if(access)
+        {
+            updated();
+            doReleaseAccess(true);
+        }
+    }
+
     ~Impl()
     {
         std::unique_lock<std::mutex> lock(mInfo->accessMutex);
@@ -389,6 +423,55 @@ public:
         return mInfo->extraRanges.at(index);
     }
 
+    std::shared_ptr<Binary::Reader> getReader() const noexcept
+    {
+        // The reader is never changed once the results are created
+        MiscWeakAssert(mInfo != nullptr);
+        return mInfo != nullptr ? mInfo->reader : nullptr;
+    }
+
+    std::optional<Zoom::Range> getPage() const noexcept
+    {
+        MiscWeakAssert(mInfo != nullptr);
+        if(mInfo == nullptr)
+        {
+            return {};
+        }
+        std::unique_lock<std::mutex> lock(mInfo->accessMutex);
+        MiscWeakAssert(hasAccess(true));
+        if(!hasAccess(true))
+        {
+            return {};
+        }
+        return mInfo->page;
+    }
+
+    bool setPage(Zoom::Range const& range, std::atomic<bool> const& shouldAbort)
+    {
+        auto const reader = getReader();
+        if(reader == nullptr)
+        {
+            return false;
+        }
+        // The frames are read before the access is requested so the results can still be read meanwhile
+        auto result = reader->getData(range, shouldAbort);
+        auto const* pageData = std::get_if<Data>(&result);
+        if(pageData == nullptr || shouldAbort.load())
+        {
+            return false;
+        }
+        auto frames = pageData->mImpl->mInfo->data;
+        std::unique_lock<std::mutex> lock(mInfo->accessMutex);
+        if(!doGetAccess(false))
+        {
+            return false;
+        }
+        mInfo->data = std::move(frames);
+        mInfo->page = range;
+        doReleaseAccess(false);
+        return true;
+    }
+
     inline bool operator==(Impl const& rhs) const noexcept
     {
         return mInfo == rhs.mInfo;
@@ -551,6 +634,13 @@ private:
             mInfo->numBins.reset();
             mInfo->valueRange.reset();
         }
+        // The number of columns is the one of the page because it is used to render the frames in memory
+        if(mInfo->summary.has_value())
+        {
+            mInfo->numBins = mInfo->summary->numBins;
+            mInfo->valueRange = mInfo->summary->valueRange;
+            mInfo->extraRanges = mInfo->summary->extraRanges;
+        }
     }
 
     using DataType = std::variant<std::shared_ptr<std::vector<Markers>>, std::shared_ptr<std::vector<Points>>, std::shared_ptr<std::vector<Columns>>>;
@@ -564,6 +654,9 @@ private:
         std::optional<size_t> numBins{};
         std::optional<Zoom::Range> valueRange{};
         std::vector<Zoom::Range> extraRanges;
+        std::shared_ptr<Binary::Reader> reader;
+        std::optional<Binary::Summary> summary;
+        std::optional<Zoom::Range> page;
         std::mutex accessMutex;
         size_t accessCounter{0_z};
 
@@ -599,6 +692,11 @@ Track::Result::Data::Data(std::vector<Columns>&& columns)
 {
 }
 
+Track::Result::Data::Data(std::shared_ptr<Binary::Reader> reader, Binary::Summary const& summary)
+: mImpl(std::make_unique<Impl>(reader, summary))
+{
+}
+
 Track::Result::Data::~Data()
 {
     // Necessary for the private implementation deletion
@@ -755,6 +853,42 @@ std::optional<Zoom::Range> Track::Result::Data::getExtraRange(size_t index) cons
     return mImpl->getExtraRange(index);
 }
 
+bool Track::Result::Data::isPaged() const noexcept
+{
+    MiscWeakAssert(mImpl != nullptr);
+    return mImpl != nullptr && mImpl->getReader() != nullptr;
+}
+
+std::optional<Zoom::Range> Track::Result::Data::getPage() const noexcept
+{
+    MiscWeakAssert(mImpl != nullptr);
+    if(mImpl == nullptr)
+    {
+        return {};
+    }
+    return mImpl->getPage();
+}
+
+bool Track::Result::Data::setPage(Zoom::Range const& range, std::atomic<bool> const& shouldAbort) const
+{
+    MiscWeakAssert(mImpl != nullptr);
+    if(mImpl == nullptr)
+    {
+        return false;
+    }
+    return mImpl->setPage(range, shouldAbort);
+}
+
+std::variant<Track::Result::Data, juce::String> Track::Result::Data::loadFrames(Zoom::Range const& range, std::atomic<bool> const& shouldAbort) const
+{
+    auto const reader = mImpl != nullptr ? mImpl->getReader() : nullptr;
+    if(reader == nullptr)
+    {
+        return {*this};
+    }
+    return reader->getData(range, shouldAbort);
+}
+
 bool Track::Result::Data::operator==(Data const& rhs) const noexcept
 {
     return mImpl == rhs.mImpl;
@@ -10,6 +10,12 @@ namespace Track
     {
         class Data;
 
+        namespace Binary
+        {
+            class Reader;
+            struct Summary;
+        } // namespace Binary
+
         class Access
         {
         public:
@@ -64,6 +70,10 @@ namespace Track
             Data(std::vector<Markers>&& markers);
             Data(std::vector<Points>&& points);
             Data(std::vector<Columns>&& columns);
+            // The paged results only keep in memory the frames of a time range (the page) that are read from an
+            // indexed file, the number of channels, the number of bins and the ranges of the values and the extras
+            // are those of the whole file
+            Data(std::shared_ptr<Binary::Reader> reader, Binary::Summary const& summary);
             ~Data();
 
             Data& operator=(Data const& rhs);
@@ -86,6 +96,14 @@ namespace Track
             std::optional<Zoom::Range> getValueRange() const noexcept;
             std::optional<Zoom::Range> getExtraRange(size_t index) const noexcept;
 
+            bool isPaged() const noexcept;
+            std::optional<Zoom::Range> getPage() const noexcept;
+            // Replaces the frames of the page in place (the data are shared by the copies of the results)
+            bool setPage(Zoom::Range const& range, std::atomic<bool> const& shouldAbort) const;
+            // Returns results in memory with the frames of the paged results that overlap the time range
+            // (the results are returned as they are if they are not paged)
+            std::variant<Data, juce::String> loadFrames(Zoom::Range const& range, std::atomic<bool> const& shouldAbort) const;
+
             bool operator==(Data const& rhd) const noexcept;
             bool operator!=(Data const& rhd) const noexcept;
 
@@ -14,6 +14,24 @@ namespace
                                  .withButton(juce::translate("Ok"));
         juce::AlertWindow::showAsync(options, nullptr);
     }
+
+    // The paged results are modified in memory with all their frames
+    std::optional<Track::Results> getModifiableResults(Track::Accessor const& accessor)
+    {
+        std::atomic<bool> const shouldAbort{false};
+        auto results = accessor.getAttr<Track::AttrType::results>().loadFrames({-1.0, std::numeric_limits<double>::max()}, shouldAbort);
+        if(auto const* error = std::get_if<juce::String>(&results))
+        {
+            auto const options = juce::MessageBoxOptions()
+                                     .withIconType(juce::AlertWindow::WarningIcon)
+                                     .withTitle(juce::translate("Results cannot be accessed!"))
+                                     .withMessage(juce::translate("The results cannot be read from the file: REASON").replace("REASON", *error))
+                                     .withButton(juce::translate("Ok"));
+            juce::AlertWindow::showAsync(options, nullptr);
+            return {};
+        }
+        return std::get<Track::Results>(results);
+    }
 } // namespace
 
 juce::Range<double> Track::Result::Modifier::getTimeRange(ChannelData const& data)
@@ -400,12 +418,12 @@ bool Track::Result::Modifier::eraseFrames(Accessor& accessor, size_t const chann
         return false;
     };
 
-    auto results(accessor.getAttr<AttrType::results>());
-    if(getAccessAndParse(results))
+    auto results = getModifiableResults(accessor);
+    if(results.has_value() && getAccessAndParse(results.value()))
     {
         auto file = accessor.getAttr<AttrType::file>();
         file.commit = commit;
-        accessor.setAttr<AttrType::results>(results, NotificationType::synchronous);
+        accessor.setAttr<AttrType::results>(results.value(), NotificationType::synchronous);
         accessor.setAttr<AttrType::file>(file, NotificationType::synchronous);
         return true;
     }
@@ -497,12 +515,12 @@ bool Track::Result::Modifier::insertFrames(Accessor& accessor, size_t const chan
         return false;
     };
 
-    auto results(accessor.getAttr<AttrType::results>());
-    if(getAccessAndParse(results))
+    auto results = getModifiableResults(accessor);
+    if(results.has_value() && getAccessAndParse(results.value()))
     {
         auto file = accessor.getAttr<AttrType::file>();
         file.commit = commit;
-        accessor.setAttr<AttrType::results>(results, NotificationType::synchronous);
+        accessor.setAttr<AttrType::results>(results.value(), NotificationType::synchronous);
         accessor.setAttr<AttrType::file>(file, NotificationType::synchronous);
         return true;
     }
@@ -560,12 +578,12 @@ bool Track::Result::Modifier::resetFrameDurations(Accessor& accessor, size_t con
         return false;
     };
 
-    auto results(accessor.getAttr<AttrType::results>());
-    if(getAccessAndParse(results))
+    auto results = getModifiableResults(accessor);
+    if(results.has_value() && getAccessAndParse(results.value()))
     {
         auto file = accessor.getAttr<AttrType::file>();
         file.commit = commit;
-        accessor.setAttr<AttrType::results>(results, NotificationType::synchronous);
+        accessor.setAttr<AttrType::results>(results.value(), NotificationType::synchronous);
         accessor.setAttr<AttrType::file>(file, NotificationType::synchronous);
         return true;
     }
@@ -0,0 +1,683 @@
+#include "AnlTrackResultNumpy.h"
+#include <charconv>
+
+ANALYSE_FILE_BEGIN
+
+namespace
+{
+    using Data = Track::Result::Data;
+    using Array = Track::Result::Numpy::Array;
+
+    static constexpr char const* magic = "\x93NUMPY";
+    static constexpr size_t magicSize = 6_z;
+    static constexpr size_t alignment = 64_z;
+    static constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+
+    template <typename T>
+    using Frames = std::vector<std::vector<T const*>>;
+
+    // Gathers the frames of the selected channels that are in the time range and that pass the thresholds
+    template <typename T>
+    Frames<T> getFrames(std::vector<std::vector<T>> const& channelsData, Zoom::Range timeRange, std::set<size_t> const& channels, std::vector<std::optional<float>> const& extraThresholds)
+    {
+        Frames<T> frames;
+        for(auto index = 0_z; index < channelsData.size(); ++index)
+        {
+            if(!channels.empty() && channels.count(index) == 0_z)
+            {
+                continue;
+            }
+            auto const& channelData = channelsData.at(index);
+            auto it = std::lower_bound(channelData.cbegin(), channelData.cend(), timeRange.getStart(), Track::Result::lower_cmp<T>);
+            auto const end = std::upper_bound(it, channelData.cend(), timeRange.getEnd(), Track::Result::upper_cmp<T>);
+            auto& channelFrames = frames.emplace_back();
+            channelFrames.reserve(static_cast<size_t>(std::distance(it, end)));
+            for(; it != end; ++it)
+            {
+                if(Track::Result::passThresholds(*it, extraThresholds))
+                {
+                    channelFrames.push_back(&(*it));
+                }
+            }
+        }
+        return frames;
+    }
+
+    template <typename T>
+    size_t getMaxNumFrames(Frames<T> const& frames)
+    {
+        return std::accumulate(frames.cbegin(), frames.cend(), 0_z, [](auto const value, auto const& channelFrames)
+                               {
+                                   return std::max(value, channelFrames.size());
+                               });
+    }
+
+    template <size_t index, typename T>
+    size_t getMaxSize(std::vector<T const*> const& channelFrames)
+    {
+        return std::accumulate(channelFrames.cbegin(), channelFrames.cend(), 0_z, [](auto const value, auto const* frame)
+                               {
+                                   return std::max(value, std::get<index>(*frame).size());
+                               });
+    }
+
+    bool writeBlock(std::ostream& stream, void const* data, size_t size)
+    {
+        return size == 0_z || static_cast<bool>(stream.write(static_cast<char const*>(data), static_cast<std::streamsize>(size)));
+    }
+
+    bool writeMatrixChannels(std::ostream& stream, Frames<Data::Point> const& frames, std::atomic<bool> const& shouldAbort)
+    {
+        auto const numFrames = getMaxNumFrames(frames);
+        auto const header = Track::Result::Numpy::getHeader("<f4", {frames.size(), numFrames});
+        if(!writeBlock(stream, header.data(), header.size()))
+        {
+            return false;
+        }
+        std::vector<float> buffer;
+        buffer.reserve(numFrames);
+        for(auto const& channelFrames : frames)
+        {
+            if(shouldAbort)
+            {
+                return false;
+            }
+            buffer.clear();
+            for(auto const* frame : channelFrames)
+            {
+                buffer.push_back(std::get<2_z>(*frame).value_or(nan));
+            }
+            buffer.resize(numFrames, nan);
+            if(!writeBlock(stream, buffer.data(), buffer.size() * sizeof(float)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool writeMatrixChannels(std::ostream& stream, Frames<Data::Column> const& frames, std::atomic<bool> const& shouldAbort)
+    {
+        auto const numFrames = getMaxNumFrames(frames);
+        auto const numBins = std::accumulate(frames.cbegin(), frames.cend(), 0_z, [](auto const value, auto const& channelFrames)
+                                             {
+                                                 return std::max(value, getMaxSize<2_z>(channelFrames));
+                                             });
+        auto const header = Track::Result::Numpy::getHeader("<f4", {frames.size(), numFrames, numBins});
+        if(!writeBlock(stream, header.data(), header.size()))
+        {
+            return false;
+        }
+        // The values are written directly from the results, only the missing bins are padded
+        std::vector<float> const padding(numBins, nan);
+        for(auto const& channelFrames : frames)
+        {
+            if(shouldAbort)
+            {
+                return false;
+            }
+            for(auto const* frame : channelFrames)
+            {
+                auto const& values = std::get<2_z>(*frame);
+                if(!writeBlock(stream, values.data(), values.size() * sizeof(float)) || !writeBlock(stream, padding.data(), (numBins - values.size()) * sizeof(float)))
+                {
+                    return false;
+                }
+            }
+            for(auto index = channelFrames.size(); index < numFrames; ++index)
+            {
+                if(!writeBlock(stream, padding.data(), padding.size() * sizeof(float)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template <typename V, typename F>
+    std::vector<char> createArray(std::vector<size_t> const& shape, F&& fill)
+    {
+        static_assert(std::is_same_v<V, float> || std::is_same_v<V, double> || std::is_same_v<V, uint64_t>);
+        auto const header = Track::Result::Numpy::getHeader(std::is_same_v<V, float> ? "<f4" : (std::is_same_v<V, double> ? "<f8" : "<u8"), shape);
+        auto const numElements = std::accumulate(shape.cbegin(), shape.cend(), 1_z, std::multiplies<size_t>());
+        std::vector<char> buffer(header.size() + numElements * sizeof(V));
+        std::memcpy(buffer.data(), header.data(), header.size());
+        fill(buffer.data() + header.size());
+        return buffer;
+    }
+
+    template <typename V>
+    char* writeValues(char* ptr, V const* values, size_t size)
+    {
+        if(size > 0_z)
+        {
+            std::memcpy(ptr, values, size * sizeof(V));
+        }
+        return ptr + size * sizeof(V);
+    }
+
+    template <typename T>
+    bool writeArchiveChannels(juce::OutputStream& stream, Frames<T> const& frames, std::atomic<bool> const& shouldAbort)
+    {
+        // The arrays must remain valid until the builder writes the archive
+        std::vector<std::vector<char>> arrays;
+        juce::ZipFile::Builder builder;
+        auto const time = juce::Time::getCurrentTime();
+        auto const addArray = [&](juce::String const& name, std::vector<char>&& array)
+        {
+            arrays.push_back(std::move(array));
+            builder.addEntry(new juce::MemoryInputStream(arrays.back().data(), arrays.back().size(), false), 0, name, time);
+        };
+
+        for(auto channel = 0_z; channel < frames.size(); ++channel)
+        {
+            if(shouldAbort)
+            {
+                return false;
+            }
+            auto const& channelFrames = frames.at(channel);
+            auto const numFrames = channelFrames.size();
+            auto const suffix = juce::String(channel) + ".npy";
+            addArray("times_" + suffix, createArray<double>({numFrames}, [&](char* ptr)
+                                                            {
+                                                                for(auto const* frame : channelFrames)
+                                                                {
+                                                                    ptr = writeValues(ptr, &std::get<0_z>(*frame), 1_z);
+                                                                }
+                                                            }));
+            addArray("durations_" + suffix, createArray<double>({numFrames}, [&](char* ptr)
+                                                                {
+                                                                    for(auto const* frame : channelFrames)
+                                                                    {
+                                                                        ptr = writeValues(ptr, &std::get<1_z>(*frame), 1_z);
+                                                                    }
+                                                                }));
+            if constexpr(std::is_same_v<T, Data::Point>)
+            {
+                addArray("values_" + suffix, createArray<float>({numFrames}, [&](char* ptr)
+                                                                {
+                                                                    for(auto const* frame : channelFrames)
+                                                                    {
+                                                                        auto const value = std::get<2_z>(*frame).value_or(nan);
+                                                                        ptr = writeValues(ptr, &value, 1_z);
+                                                                    }
+                                                                }));
+            }
+            else
+            {
+                auto const numBins = getMaxSize<2_z>(channelFrames);
+                std::vector<float> const padding(numBins, nan);
+                addArray("values_" + suffix, createArray<float>({numFrames, numBins}, [&](char* ptr)
+                                                                {
+                                                                    for(auto const* frame : channelFrames)
+                                                                    {
+                                                                        auto const& values = std::get<2_z>(*frame);
+                                                                        ptr = writeValues(ptr, values.data(), values.size());
+                                                                        ptr = writeValues(ptr, padding.data(), numBins - values.size());
+                                                                    }
+                                                                }));
+            }
+            // The sizes are required to restore the values and the extras that end with NaN
+            addArray("sizes_" + suffix, createArray<uint64_t>({numFrames, 2_z}, [&](char* ptr)
+                                                              {
+                                                                  for(auto const* frame : channelFrames)
+                                                                  {
+                                                                      uint64_t sizes[2_z];
+                                                                      if constexpr(std::is_same_v<T, Data::Point>)
+                                                                      {
+                                                                          sizes[0_z] = std::get<2_z>(*frame).has_value() ? 1_z : 0_z;
+                                                                      }
+                                                                      else
+                                                                      {
+                                                                          sizes[0_z] = static_cast<uint64_t>(std::get<2_z>(*frame).size());
+                                                                      }
+                                                                      sizes[1_z] = static_cast<uint64_t>(std::get<3_z>(*frame).size());
+                                                                      ptr = writeValues(ptr, sizes, 2_z);
+                                                                  }
+                                                              }));
+            auto const numExtras = getMaxSize<3_z>(channelFrames);
+            if(numExtras > 0_z)
+            {
+                std::vector<float> const padding(numExtras, nan);
+                addArray("extras_" + suffix, createArray<float>({numFrames, numExtras}, [&](char* ptr)
+                                                                {
+                                                                    for(auto const* frame : channelFrames)
+                                                                    {
+                                                                        auto const& extras = std::get<3_z>(*frame);
+                                                                        ptr = writeValues(ptr, extras.data(), extras.size());
+                                                                        ptr = writeValues(ptr, padding.data(), numExtras - extras.size());
+                                                                    }
+                                                                }));
+            }
+        }
+        return !shouldAbort && builder.writeToStream(stream, nullptr);
+    }
+
+    std::string_view trimStart(std::string_view text)
+    {
+        auto const position = text.find_first_not_of(" \t");
+        return position == std::string_view::npos ? std::string_view{} : text.substr(position);
+    }
+
+    // Returns the text that follows the key of the dictionary of the header
+    std::string_view getEntry(std::string_view dictionary, std::string_view key)
+    {
+        for(auto const quote : {'\'', '"'})
+        {
+            auto const quotedKey = std::string(1_z, quote) + std::string(key) + std::string(1_z, quote);
+            auto const position = dictionary.find(quotedKey);
+            if(position != std::string_view::npos)
+            {
+                auto const value = trimStart(dictionary.substr(position + quotedKey.size()));
+                return value.empty() || value.front() != ':' ? std::string_view{} : trimStart(value.substr(1_z));
+            }
+        }
+        return {};
+    }
+
+    template <typename V>
+    void copyValues(Array const& array, size_t offset, size_t size, V* output)
+    {
+        if(array.type == 'u')
+        {
+            for(auto index = 0_z; index < size; ++index)
+            {
+                uint64_t value;
+                std::memcpy(&value, array.data + (offset + index) * sizeof(uint64_t), sizeof(uint64_t));
+                output[index] = static_cast<V>(value);
+            }
+        }
+        else if(array.itemSize == sizeof(V))
+        {
+            if(size > 0_z)
+            {
+                std::memcpy(output, array.data + offset * sizeof(V), size * sizeof(V));
+            }
+        }
+        else if(array.itemSize == sizeof(float))
+        {
+            for(auto index = 0_z; index < size; ++index)
+            {
+                float value;
+                std::memcpy(&value, array.data + (offset + index) * sizeof(float), sizeof(float));
+                output[index] = static_cast<V>(value);
+            }
+        }
+        else
+        {
+            for(auto index = 0_z; index < size; ++index)
+            {
+                double value;
+                std::memcpy(&value, array.data + (offset + index) * sizeof(double), sizeof(double));
+                output[index] = static_cast<V>(value);
+            }
+        }
+    }
+
+    template <typename V>
+    V getValue(Array const& array, size_t index)
+    {
+        V value;
+        copyValues(array, index, 1_z, &value);
+        return value;
+    }
+
+    // If the number of values is not defined, the NaN at the end are considered as padding
+    std::vector<float> getValues(Array const& array, size_t offset, size_t size, std::optional<size_t> numValues = {})
+    {
+        std::vector<float> values(numValues.has_value() ? std::min(*numValues, size) : size);
+        copyValues(array, offset, values.size(), values.data());
+        while(!numValues.has_value() && !values.empty() && std::isnan(values.back()))
+        {
+            values.pop_back();
+        }
+        return values;
+    }
+
+    // Returns an empty array if the entry doesn't exist
+    std::variant<Array, juce::String> readEntry(juce::ZipFile& zipFile, juce::String const& name, juce::MemoryBlock& block)
+    {
+        auto const index = zipFile.getIndexOfFileName(name);
+        if(index < 0)
+        {
+            return {Array{}};
+        }
+        std::unique_ptr<juce::InputStream> stream(zipFile.createStreamForEntry(index));
+        if(stream == nullptr)
+        {
+            return {juce::translate("Parsing error - NAME").replace("NAME", name)};
+        }
+        stream->readIntoMemoryBlock(block);
+        return Track::Result::Numpy::readArray(static_cast<char const*>(block.getData()), block.getSize());
+    }
+} // namespace
+
+std::string Track::Result::Numpy::getHeader(char const* descr, std::vector<size_t> const& shape)
+{
+    std::string dictionary = "{'descr': '" + std::string(descr) + "', 'fortran_order': False, 'shape': (";
+    for(auto index = 0_z; index < shape.size(); ++index)
+    {
+        dictionary += (index > 0_z ? ", " : "") + std::to_string(shape.at(index));
+    }
+    dictionary += shape.size() == 1_z ? ",), }" : "), }";
+
+    // The version 2.0 is only required if the dictionary is too long for the version 1.0
+    auto const getSize = [&](size_t prefixSize)
+    {
+        return (prefixSize + dictionary.size() + 1_z + alignment - 1_z) / alignment * alignment;
+    };
+    auto const useVersion2 = getSize(magicSize + 4_z) - magicSize - 4_z > static_cast<size_t>(std::numeric_limits<uint16_t>::max());
+    auto const prefixSize = useVersion2 ? magicSize + 6_z : magicSize + 4_z;
+    auto const length = getSize(prefixSize) - prefixSize;
+    dictionary.append(length - dictionary.size() - 1_z, ' ');
+    dictionary.push_back('\n');
+
+    std::string header(magic, magicSize);
+    header.push_back(useVersion2 ? '\x02' : '\x01');
+    header.push_back('\x00');
+    for(auto index = 0_z; index < prefixSize - magicSize - 2_z; ++index)
+    {
+        header.push_back(static_cast<char>((length >> (index * 8_z)) & 0xff));
+    }
+    return header + dictionary;
+}
+
+std::variant<Track::Result::Numpy::Array, juce::String> Track::Result::Numpy::readArray(char const* data, size_t size)
+{
+    if(data == nullptr || size < magicSize + 4_z || std::memcmp(data, magic, magicSize) != 0)
+    {
+        return {juce::translate("Parsing error - magic")};
+    }
+    auto const version = static_cast<uint8_t>(data[magicSize]);
+    if(version < 1 || version > 3)
+    {
+        return {juce::translate("Parsing error - version")};
+    }
+    auto const prefixSize = version == 1 ? magicSize + 4_z : magicSize + 6_z;
+    if(size < prefixSize)
+    {
+        return {juce::translate("Parsing error - header")};
+    }
+    auto length = 0_z;
+    for(auto index = 0_z; index < prefixSize - magicSize - 2_z; ++index)
+    {
+        length |= static_cast<size_t>(static_cast<uint8_t>(data[magicSize + 2_z + index])) << (index * 8_z);
+    }
+    if(length > size - prefixSize)
+    {
+        return {juce::translate("Parsing error - header")};
+    }
+    std::string_view const dictionary(data + prefixSize, length);
+
+    Array array;
+    auto const descr = getEntry(dictionary, "descr");
+    if(descr.size() < 5_z || (descr.front() != '\'' && descr.front() != '"') || descr.at(4_z) != descr.front())
+    {
+        return {juce::translate("Parsing error - descr")};
+    }
+    if(descr.substr(1_z, 3_z) == "<f4")
+    {
+        array.itemSize = sizeof(float);
+    }
+    else if(descr.substr(1_z, 3_z) == "<f8")
+    {
+        array.itemSize = sizeof(double);
+    }
+    else if(descr.substr(1_z, 3_z) == "<u8")
+    {
+        array.type = 'u';
+        array.itemSize = sizeof(uint64_t);
+    }
+    else
+    {
+        return {juce::translate("Parsing error - the data type DESCR is not supported").replace("DESCR", juce::String(std::string(descr.substr(1_z, 3_z))))};
+    }
+
+    if(getEntry(dictionary, "fortran_order").substr(0_z, 5_z) != "False")
+    {
+        return {juce::translate("Parsing error - the Fortran order is not supported")};
+    }
+
+    auto shape = getEntry(dictionary, "shape");
+    auto const shapeEnd = shape.find(')');
+    if(shape.empty() || shape.front() != '(' || shapeEnd == std::string_view::npos)
+    {
+        return {juce::translate("Parsing error - shape")};
+    }
+    shape = trimStart(shape.substr(1_z, shapeEnd - 1_z));
+    auto numElements = 1_z;
+    while(!shape.empty())
+    {
+        auto dimension = 0_z;
+        auto const result = std::from_chars(shape.data(), shape.data() + shape.size(), dimension);
+        if(result.ec != std::errc())
+        {
+            return {juce::translate("Parsing error - shape")};
+        }
+        if(dimension > 0_z && numElements > std::numeric_limits<size_t>::max() / dimension)
+        {
+            return {juce::translate("Parsing error - shape")};
+        }
+        numElements *= dimension;
+        array.shape.push_back(dimension);
+        shape = trimStart(shape.substr(static_cast<size_t>(result.ptr - shape.data())));
+        if(!shape.empty() && shape.front() == ',')
+        {
+            shape = trimStart(shape.substr(1_z));
+        }
+    }
+
+    array.data = data + prefixSize + length;
+    if(numElements > (size - prefixSize - length) / array.itemSize)
+    {
+        return {juce::translate("Parsing error - eof")};
+    }
+    array.size = numElements * array.itemSize;
+    return {std::move(array)};
+}
+
+bool Track::Result::Numpy::writeMatrix(std::ostream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, std::vector<std::optional<float>> const& extraThresholds, std::atomic<bool> const& shouldAbort)
+{
+    if(auto const points = data.getPoints())
+    {
+        return writeMatrixChannels(stream, getFrames(*points, timeRange, channels, extraThresholds), shouldAbort);
+    }
+    if(auto const columns = data.getColumns())
+    {
+        return writeMatrixChannels(stream, getFrames(*columns, timeRange, channels, extraThresholds), shouldAbort);
+    }
+    return false;
+}
+
+bool Track::Result::Numpy::writeArchive(juce::OutputStream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, std::vector<std::optional<float>> const& extraThresholds, std::atomic<bool> const& shouldAbort)
+{
+    if(auto const points = data.getPoints())
+    {
+        return writeArchiveChannels(stream, getFrames(*points, timeRange, channels, extraThresholds), shouldAbort);
+    }
+    if(auto const columns = data.getColumns())
+    {
+        return writeArchiveChannels(stream, getFrames(*columns, timeRange, channels, extraThresholds), shouldAbort);
+    }
+    return false;
+}
+
+std::variant<Track::Result::Data, juce::String> Track::Result::Numpy::readMatrix(char const* data, size_t size, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    auto const result = readArray(data, size);
+    if(auto const* error = std::get_if<juce::String>(&result))
+    {
+        return {*error};
+    }
+    auto const& array = std::get<Array>(result);
+    auto const& shape = array.shape;
+    if(shape.empty() || shape.size() > 3_z)
+    {
+        return {juce::translate("Parsing error - shape")};
+    }
+
+    // The matrix doesn't contain the times so the index of the frames is used as time. The frames at the
+    // end of the channels that only contain NaN are considered as padding and are ignored.
+    auto const numChannels = shape.size() > 1_z ? shape.at(0_z) : 1_z;
+    auto const numFrames = shape.size() > 1_z ? shape.at(1_z) : shape.at(0_z);
+    if(shape.size() == 3_z)
+    {
+        auto const numBins = shape.at(2_z);
+        std::vector<Data::Columns> columns(numChannels);
+        for(auto channel = 0_z; channel < numChannels; ++channel)
+        {
+            if(shouldAbort)
+            {
+                return {};
+            }
+            auto& channelColumns = columns[channel];
+            channelColumns.reserve(numFrames);
+            for(auto frame = 0_z; frame < numFrames; ++frame)
+            {
+                channelColumns.emplace_back(static_cast<double>(frame), 0.0, getValues(array, (channel * numFrames + frame) * numBins, numBins), std::vector<float>{});
+            }
+            while(!channelColumns.empty() && std::get<2_z>(channelColumns.back()).empty())
+            {
+                channelColumns.pop_back();
+            }
+            advancement.store(static_cast<float>(channel + 1_z) / static_cast<float>(numChannels));
+        }
+        return {Data(std::move(columns))};
+    }
+
+    std::vector<Data::Points> points(numChannels);
+    for(auto channel = 0_z; channel < numChannels; ++channel)
+    {
+        if(shouldAbort)
+        {
+            return {};
+        }
+        auto& channelPoints = points[channel];
+        channelPoints.reserve(numFrames);
+        for(auto frame = 0_z; frame < numFrames; ++frame)
+        {
+            auto const value = getValue<float>(array, channel * numFrames + frame);
+            channelPoints.emplace_back(static_cast<double>(frame), 0.0, std::isnan(value) ? std::optional<float>{} : std::optional<float>(value), std::vector<float>{});
+        }
+        while(!channelPoints.empty() && !std::get<2_z>(channelPoints.back()).has_value())
+        {
+            channelPoints.pop_back();
+        }
+        advancement.store(static_cast<float>(channel + 1_z) / static_cast<float>(numChannels));
+    }
+    return {Data(std::move(points))};
+}
+
+std::variant<Track::Result::Data, juce::String> Track::Result::Numpy::readArchive(juce::InputStream& stream, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement)
+{
+    juce::ZipFile zipFile(stream);
+    auto numChannels = 0_z;
+    while(zipFile.getIndexOfFileName("values_" + juce::String(numChannels) + ".npy") >= 0)
+    {
+        ++numChannels;
+    }
+    if(numChannels == 0_z)
+    {
+        return {juce::translate("Parsing error - values")};
+    }
+
+    // The times, the durations, the extras and the sizes are optional, if the times are not defined the
+    // index of the frames is used as time and if the sizes are not defined the NaN at the end of the values
+    // and the extras are considered as padding.
+    std::vector<Data::Points> points;
+    std::vector<Data::Columns> columns;
+    std::optional<bool> useColumns;
+    for(auto channel = 0_z; channel < numChannels; ++channel)
+    {
+        if(shouldAbort)
+        {
+            return {};
+        }
+        auto const suffix = juce::String(channel) + ".npy";
+        juce::MemoryBlock valuesBlock, timesBlock, durationsBlock, extrasBlock, sizesBlock;
+        auto const valuesResult = readEntry(zipFile, "values_" + suffix, valuesBlock);
+        auto const timesResult = readEntry(zipFile, "times_" + suffix, timesBlock);
+        auto const durationsResult = readEntry(zipFile, "durations_" + suffix, durationsBlock);
+        auto const extrasResult = readEntry(zipFile, "extras_" + suffix, extrasBlock);
+        auto const sizesResult = readEntry(zipFile, "sizes_" + suffix, sizesBlock);
+        for(auto const* result : {&valuesResult, &timesResult, &durationsResult, &extrasResult, &sizesResult})
+        {
+            if(auto const* error = std::get_if<juce::String>(result))
+            {
+                return {*error};
+            }
+        }
+
+        auto const& values = std::get<Array>(valuesResult);
+        auto const& times = std::get<Array>(timesResult);
+        auto const& durations = std::get<Array>(durationsResult);
+        auto const& extras = std::get<Array>(extrasResult);
+        auto const& sizes = std::get<Array>(sizesResult);
+        if(values.shape.empty() || values.shape.size() > 2_z || (useColumns.has_value() && *useColumns != (values.shape.size() == 2_z)))
+        {
+            return {juce::translate("Parsing error - values")};
+        }
+        useColumns = values.shape.size() == 2_z;
+        auto const numFrames = values.shape.at(0_z);
+        if(times.data != nullptr && times.shape != std::vector<size_t>{numFrames})
+        {
+            return {juce::translate("Parsing error - times")};
+        }
+        if(durations.data != nullptr && durations.shape != std::vector<size_t>{numFrames})
+        {
+            return {juce::translate("Parsing error - durations")};
+        }
+        if(extras.data != nullptr && (extras.shape.size() != 2_z || extras.shape.at(0_z) != numFrames))
+        {
+            return {juce::translate("Parsing error - extras")};
+        }
+        if(sizes.data != nullptr && (sizes.type != 'u' || sizes.shape != std::vector<size_t>{numFrames, 2_z}))
+        {
+            return {juce::translate("Parsing error - sizes")};
+        }
+
+        auto const numExtras = extras.data != nullptr ? extras.shape.at(1_z) : 0_z;
+        auto const getSize = [&](size_t frame, size_t index)
+        {
+            return sizes.data != nullptr ? std::optional<size_t>(getValue<size_t>(sizes, frame * 2_z + index)) : std::optional<size_t>{};
+        };
+        auto const getTime = [&](size_t frame)
+        {
+            return times.data != nullptr ? getValue<double>(times, frame) : static_cast<double>(frame);
+        };
+        auto const getDuration = [&](size_t frame)
+        {
+            return durations.data != nullptr ? getValue<double>(durations, frame) : 0.0;
+        };
+        if(*useColumns)
+        {
+            auto const numBins = values.shape.at(1_z);
+            auto& channelColumns = columns.emplace_back();
+            channelColumns.reserve(numFrames);
+            for(auto frame = 0_z; frame < numFrames; ++frame)
+            {
+                channelColumns.emplace_back(getTime(frame), getDuration(frame), getValues(values, frame * numBins, numBins, getSize(frame, 0_z)), getValues(extras, frame * numExtras, numExtras, getSize(frame, 1_z)));
+            }
+        }
+        else
+        {
+            auto& channelPoints = points.emplace_back();
+            channelPoints.reserve(numFrames);
+            for(auto frame = 0_z; frame < numFrames; ++frame)
+            {
+                auto const value = getValue<float>(values, frame);
+                auto const hasValue = getSize(frame, 0_z).value_or(std::isnan(value) ? 0_z : 1_z) > 0_z;
+                channelPoints.emplace_back(getTime(frame), getDuration(frame), hasValue ? std::optional<float>(value) : std::optional<float>{}, getValues(extras, frame * numExtras, numExtras, getSize(frame, 1_z)));
+            }
+        }
+        advancement.store(static_cast<float>(channel + 1_z) / static_cast<float>(numChannels));
+    }
+    if(*useColumns)
+    {
+        return {Data(std::move(columns))};
+    }
+    return {Data(std::move(points))};
+}
+
+ANALYSE_FILE_END
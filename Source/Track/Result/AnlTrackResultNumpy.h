@@ -0,0 +1,42 @@
+#pragma once
+
+#include "AnlTrackResultModel.h"
+
+ANALYSE_FILE_BEGIN
+
+namespace Track
+{
+    namespace Result
+    {
+        namespace Numpy
+        {
+            // The NPY format starts with a magic string and a header that describes the array with a Python
+            // dictionary (data type, memory order and shape) padded so the raw little-endian data are aligned
+            // on 64 bytes. The NPY matrix only contains the values of the results as 32-bit floats with the
+            // shape (channels, frames) for points and (channels, frames, bins) for columns, the missing values
+            // are NaN. The NPZ format is a zip archive of NPY files that contains for each channel N the times
+            // (times_N.npy), the durations (durations_N.npy), the values (values_N.npy) and the extras
+            // (extras_N.npy) of the frames, and the number of values and extras of each frame (sizes_N.npy)
+            // so the NaN of the results are distinguished from the padding. The markers are not supported.
+            struct Array
+            {
+                char type{'f'};     // the kind of the data ('f' for float, 'u' for unsigned integer)
+                size_t itemSize{0}; // the size of an element in bytes
+                std::vector<size_t> shape;
+                char const* data{nullptr};
+                size_t size{0}; // the size of the data in bytes
+            };
+
+            std::string getHeader(char const* descr, std::vector<size_t> const& shape);
+            std::variant<Array, juce::String> readArray(char const* data, size_t size);
+
+            bool writeMatrix(std::ostream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, std::vector<std::optional<float>> const& extraThresholds, std::atomic<bool> const& shouldAbort);
+            bool writeArchive(juce::OutputStream& stream, Data const& data, Zoom::Range timeRange, std::set<size_t> const& channels, std::vector<std::optional<float>> const& extraThresholds, std::atomic<bool> const& shouldAbort);
+
+            std::variant<Data, juce::String> readMatrix(char const* data, size_t size, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+            std::variant<Data, juce::String> readArchive(juce::InputStream& stream, std::atomic<bool> const& shouldAbort, std::atomic<float>& advancement);
+        } // namespace Numpy
+    } // namespace Result
+} // namespace Track
+
+ANALYSE_FILE_END
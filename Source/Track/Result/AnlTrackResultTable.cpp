@@ -229,6 +229,10 @@ Track::Result::Table::Table(Director& director, Zoom::Accessor& timeZoomAccessor
             case Transport::AttrType::runningPlayhead:
             {
                 auto const playHeadRow = getPlayheadRow();
+                if(attribute != Transport::AttrType::playback && playHeadRow == mPreviousPlayheadRow)
+                {
+                    break;
+                }
                 if(playHeadRow.has_value())
                 {
                     mTable.repaintRow(static_cast<int>(*playHeadRow));